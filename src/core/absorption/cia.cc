@@ -20,6 +20,7 @@
 #include "double_imanip.h"
 #include "file.h"
 #include "interp.h"
+#include "matpack_arena.h"
 #include "matpack_concepts.h"
 
 inline constexpr Numeric SPEED_OF_LIGHT = Constant::speed_of_light;
@@ -37,12 +38,13 @@ Numeric CIARecord::Extract(const Numeric& frequency,
                            const Numeric& temperature,
                            const Numeric& T_extrapolfac,
                            const Index& robust) const {
-  Vector result(1);
-  const Vector freqvec(1, frequency);
+  // Called per frequency, so keep the scratch off the heap
+  matpack::scratch_data<Numeric, 1> result(1);
+  const matpack::scratch_data<Numeric, 1> freqvec({1}, frequency);
 
-  Extract(result, freqvec, temperature, T_extrapolfac, robust);
+  Extract(result.view(), freqvec.view(), temperature, T_extrapolfac, robust);
 
-  return result[0];
+  return result.view()[0];
 }
 
 Index CIARecord::DatasetCount() const { return mdata.size(); }
@@ -287,11 +289,11 @@ void CIARecord::Extract(VectorView res,
                         const Index& robust) const {
   res = 0;
 
-  Vector result(res.nelem());
+  matpack::scratch_data<Numeric, 1> result(res.nelem());
   for (auto& this_cia : mdata) {
     cia_interpolation(
-        result, f_grid, temperature, this_cia, T_extrapolfac, robust);
-    res += result;
+        result.view(), f_grid, temperature, this_cia, T_extrapolfac, robust);
+    res += result.view();
   }
 }
 
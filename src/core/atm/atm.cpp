@@ -3,6 +3,8 @@
 #include <matpack.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <iomanip>
 #include <limits>
 #include <optional>
@@ -181,6 +183,74 @@ bool FieldMap::Map<Atm::Data,
 }
 
 namespace Atm {
+namespace {
+//! The outputs of a MultiFunctionalData at a position
+struct MultiFunctionalEntry {
+  Size id{std::numeric_limits<Size>::max()};
+  std::array<Numeric, 3> pos{};
+  Vector values{};
+};
+
+//! The latest outputs of the current thread, replaced in round-robin order
+struct MultiFunctionalCache {
+  static constexpr Size size = 8;
+
+  std::array<MultiFunctionalEntry, size> entries{};
+  Size next{0};
+
+  template <typename Func>
+  const Vector &operator()(Size id,
+                           const std::array<Numeric, 3> &pos,
+                           Func &&compute) {
+    for (auto &e : entries) {
+      if (e.id == id and e.pos == pos) return e.values;
+    }
+
+    auto &e  = entries[next];
+    next     = (next + 1) % size;
+    e.id     = std::numeric_limits<Size>::max();
+    e.values = compute();
+    e.pos    = pos;
+    e.id     = id;
+    return e.values;
+  }
+};
+
+thread_local MultiFunctionalCache multi_functional_cache;
+
+std::atomic<Size> multi_functional_count{0};
+}  // namespace
+
+MultiFunctionalData::MultiFunctionalData(func_t func, Size nout)
+    : f(std::make_shared<const func_t>(std::move(func))),
+      n(nout),
+      id(multi_functional_count++) {
+  ARTS_USER_ERROR_IF(not *f, "The function is not set")
+}
+
+Numeric MultiFunctionalData::operator()(Size i,
+                                        Numeric alt,
+                                        Numeric lat,
+                                        Numeric lon) const {
+  const Vector &v =
+      multi_functional_cache(id, {alt, lat, lon}, [&]() -> Vector {
+        Vector out = (*f)(alt, lat, lon);
+        ARTS_USER_ERROR_IF(static_cast<Size>(out.size()) != n,
+                           "Expected {} outputs, got {}",
+                           n,
+                           out.size())
+        return out;
+      });
+  return v[i];
+}
+
+FunctionalData MultiFunctionalData::component(Size i) const {
+  ARTS_USER_ERROR_IF(i >= n, "Output {} out of range for {} outputs", i, n)
+  return FunctionalData{[cpy = *this, i](Numeric alt, Numeric lat, Numeric lon) {
+    return cpy(i, alt, lat, lon);
+  }};
+}
+
 Point::Point(const IsoRatioOption isots_key) {
   switch (isots_key) {
     case IsoRatioOption::Builtin: {
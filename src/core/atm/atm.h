@@ -22,6 +22,7 @@
 #include <functional>
 #include <iosfwd>
 #include <limits>
+#include <memory>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -173,6 +174,44 @@ struct FunctionalDataAlwaysThrow {
   Numeric operator()(Numeric, Numeric, Numeric) const { ARTS_USER_ERROR("{}", error) }
 };
 
+/*! Functional data with several outputs
+
+Some data, e.g., the three components of a magnetic field model, are much
+cheaper to compute together than one by one.  The function computes all the
+outputs at a position.  The outputs at the latest few positions are memoized
+per thread, so the FunctionalData of all the outputs together only call the
+function once per position when a Field is evaluated at a point.
+*/
+class MultiFunctionalData {
+ public:
+  using func_t = std::function<Vector(Numeric, Numeric, Numeric)>;
+
+ private:
+  std::shared_ptr<const func_t> f;
+  Size n;
+  Size id;
+
+ public:
+  /*! Create the functional data
+
+  @param[in] func The function computing all outputs at (alt, lat, lon)
+  @param[in] nout The number of outputs of func
+  */
+  MultiFunctionalData(func_t func, Size nout);
+
+  //! The number of outputs
+  [[nodiscard]] Size size() const { return n; }
+
+  //! Output i at a position
+  [[nodiscard]] Numeric operator()(Size i,
+                                   Numeric alt,
+                                   Numeric lat,
+                                   Numeric lon) const;
+
+  //! The FunctionalData of output i
+  [[nodiscard]] FunctionalData component(Size i) const;
+};
+
 template <typename T>
 concept isGriddedField3 = std::is_same_v<std::remove_cvref_t<T>, GriddedField3>;
 
@@ -14,9 +14,11 @@
 #define BIFSTREAM_H_INCLUDED
 
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 
 #include "binio.h"
+#include "binmap.h"
 #include "debug.h"
 
 //! Binary output file stream class
@@ -30,18 +32,7 @@ class bifstream final : public binistream, public std::ifstream {
 
   explicit bifstream(const char* name,
                      std::ios::openmode mode = std::ios::in | std::ios::binary)
-      : std::ifstream(name, mode) {
-    // Open a second file descriptor for fast array reading
-    if (!(this->mfilep = fopen(name, "rb"))) {
-      ARTS_USER_ERROR("Failed to open {}", name);
-    }
-  }
-
-   ~bifstream() final {
-    if (mfilep) {
-      fclose(mfilep);
-    }
-  }
+      : std::ifstream(name, mode), mfile(name) {}
 
   void seek(long spos, Offset offs) final;
   std::streampos pos() final;
@@ -50,16 +41,26 @@ class bifstream final : public binistream, public std::ifstream {
   void getRaw(char* c, std::streamsize n) final {
     if (n <= 8) {
       this->read(c, n);
-    } else {
-      fseek(mfilep, this->tellg(), SEEK_SET);
-      size_t nread = fread(c, sizeof(char), n, mfilep);
-      ARTS_USER_ERROR_IF((std::streamsize)nread != n,
+    } else if (mfile.empty()) {
+      this->read(c, n);
+      ARTS_USER_ERROR_IF(this->gcount() != n,
                          "Unexpectedly reached end of binary input file.");
-      seek(nread, Add);
+    } else {
+      // Copy arrays directly from the memory map of the file
+      const std::streamoff offset = this->tellg();
+      ARTS_USER_ERROR_IF(
+          offset < 0 or static_cast<std::size_t>(offset + n) > mfile.size(),
+          "Unexpectedly reached end of binary input file.");
+      std::memcpy(c, mfile.data() + offset, n);
+      seek(static_cast<long>(n), Add);
     }
   }
 
-private : FILE* mfilep{nullptr};
+  //! The memory map of the file
+  [[nodiscard]] const binmap& map() const { return mfile; }
+
+ private:
+  binmap mfile{};
 };
 
 /* Overloaded input operators */
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////
+//   File description
+////////////////////////////////////////////////////////////////////////////
+/*!
+  \file   binmap.cc
+
+  \brief This file contains the class implementation of binmap.
+
+*/
+
+#include "binmap.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+#include "debug.h"
+
+namespace {
+void unmap(char* data, [[maybe_unused]] std::size_t size) {
+#ifdef _WIN32
+  UnmapViewOfFile(data);
+#else
+  munmap(data, size);
+#endif
+}
+}  // namespace
+
+#ifdef _WIN32
+binmap::binmap(const char* name) {
+  HANDLE file = CreateFileA(name,
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  ARTS_USER_ERROR_IF(file == INVALID_HANDLE_VALUE, "Failed to open {}", name)
+
+  LARGE_INTEGER st{};
+  if (not GetFileSizeEx(file, &st)) {
+    CloseHandle(file);
+    ARTS_USER_ERROR("Failed to get the size of {}", name)
+  }
+
+  msize = static_cast<std::size_t>(st.QuadPart);
+  if (msize > 0) {
+    // Copy-on-write, as MAP_PRIVATE
+    HANDLE mapping =
+        CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    void* ptr = mapping ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, msize)
+                        : nullptr;
+    if (mapping) CloseHandle(mapping);
+    if (ptr == nullptr) {
+      CloseHandle(file);
+      msize = 0;
+      ARTS_USER_ERROR("Failed to map {} into memory", name)
+    }
+    mdata = static_cast<char*>(ptr);
+  }
+
+  // The view stays valid after the handles are closed
+  CloseHandle(file);
+}
+#else
+binmap::binmap(const char* name) {
+  const int fd = open(name, O_RDONLY);
+  ARTS_USER_ERROR_IF(fd < 0, "Failed to open {}", name)
+
+  struct stat st {};
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    ARTS_USER_ERROR("Failed to get the size of {}", name)
+  }
+
+  msize = static_cast<std::size_t>(st.st_size);
+  if (msize > 0) {
+    void* ptr =
+        mmap(nullptr, msize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (ptr == MAP_FAILED) {
+      close(fd);
+      msize = 0;
+      ARTS_USER_ERROR("Failed to map {} into memory", name)
+    }
+    mdata = static_cast<char*>(ptr);
+  }
+
+  // The map stays valid after the file descriptor is closed
+  close(fd);
+}
+#endif
+
+binmap::binmap(binmap&& other) noexcept
+    : mdata(std::exchange(other.mdata, nullptr)),
+      msize(std::exchange(other.msize, 0)) {}
+
+binmap& binmap::operator=(binmap&& other) noexcept {
+  if (this != &other) {
+    if (mdata) unmap(mdata, msize);
+    mdata = std::exchange(other.mdata, nullptr);
+    msize = std::exchange(other.msize, 0);
+  }
+  return *this;
+}
+
+binmap::~binmap() {
+  if (mdata) unmap(mdata, msize);
+}
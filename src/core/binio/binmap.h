@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////
+//   File description
+////////////////////////////////////////////////////////////////////////////
+/*!
+  \file   binmap.h
+
+  \brief This file contains the class declaration of binmap.
+
+*/
+
+#ifndef BINMAP_H_INCLUDED
+#define BINMAP_H_INCLUDED
+
+#include <cstddef>
+
+//! Memory map of a binary file
+/*!
+  The whole file is mapped privately.  The pages of the file are shared
+  with every other process that maps or reads the same file, and a page is
+  only copied if it is written to.  Nothing is ever written back to the
+  file.  This is mmap with MAP_PRIVATE on POSIX systems and a FILE_MAP_COPY
+  view on Windows, where the file cannot be removed while it is mapped.
+*/
+class binmap {
+ public:
+  binmap() = default;
+
+  explicit binmap(const char* name);
+
+  binmap(const binmap&)            = delete;
+  binmap& operator=(const binmap&) = delete;
+
+  binmap(binmap&& other) noexcept;
+  binmap& operator=(binmap&& other) noexcept;
+
+  ~binmap();
+
+  [[nodiscard]] char* data() const { return mdata; }
+  [[nodiscard]] std::size_t size() const { return msize; }
+  [[nodiscard]] bool empty() const { return msize == 0; }
+
+ private:
+  char* mdata{nullptr};
+  std::size_t msize{0};
+};
+
+#endif
@@ -8,13 +8,19 @@
 
 #include "covariance_matrix.h"
 
+#include <Eigen/SparseCholesky>
+#include <algorithm>
+#include <map>
+#include <optional>
 #include <queue>
 #include <tuple>
 #include <utility>
+#include <variant>
 #include <vector>
 #include <ostream>
 
 #include "lin_alg.h"
+#include "matpack_eigen.h"
 #include "matpack_math.h"
 
 BlockMatrix &BlockMatrix::operator=(std::shared_ptr<Matrix> dense) {
@@ -206,6 +212,309 @@ MatrixView operator+=(MatrixView A, const Block &B) {
   return A;
 }
 
+//------------------------------------------------------------------------------
+// Factorizations
+//------------------------------------------------------------------------------
+namespace {
+/*! The inverse of a covariance matrix with Markov correlation
+ *
+ * In a Markov, e.g. exponential 1D, correlation the correlation between two
+ * elements is the product of the correlations of the neighbouring elements
+ * between them. The inverse of such a covariance matrix is tridiagonal.
+ */
+struct MarkovInverse {
+  //! The diagonal of the inverse
+  Vector diag;
+
+  //! The upper diagonal of the inverse
+  Vector upper;
+
+  //! Multiply the inverse by X
+  [[nodiscard]] Eigen::MatrixXd mult(const Eigen::MatrixXd &X) const {
+    const Index n = diag.size();
+    Eigen::MatrixXd Y(X.rows(), X.cols());
+    for (Index i = 0; i < n; i++) {
+      Y.row(i) = diag[i] * X.row(i);
+      if (i > 0) Y.row(i) += upper[i - 1] * X.row(i - 1);
+      if (i < n - 1) Y.row(i) += upper[i] * X.row(i + 1);
+    }
+    return Y;
+  }
+
+  //! The inverse as a sparse matrix
+  [[nodiscard]] Sparse sparse() const {
+    const Index n = diag.size();
+    Sparse S(n, n);
+    for (Index i = 0; i < n; i++) {
+      if (i > 0) S.rw(i, i - 1) = upper[i - 1];
+      S.rw(i, i) = diag[i];
+      if (i < n - 1) S.rw(i, i + 1) = upper[i];
+    }
+    return S;
+  }
+};
+
+/*! The tridiagonal inverse of C, if C has Markov correlation
+ *
+ * @param C A covariance matrix
+ * @return The inverse if the correlations of C match a Markov correlation
+ *         within an absolute tolerance of 1e-10
+ */
+std::optional<MarkovInverse> markov_inverse(const Matrix &C) {
+  constexpr Numeric tolerance = 1e-10;
+
+  const Index n = C.nrows();
+
+  Vector sigma(n);
+  for (Index i = 0; i < n; i++) {
+    if (not(C(i, i) > 0.0)) return std::nullopt;
+    sigma[i] = std::sqrt(C(i, i));
+  }
+
+  Vector rho(std::max<Index>(n - 1, 0));
+  for (Index i = 0; i < n - 1; i++) {
+    rho[i] = C(i, i + 1) / (sigma[i] * sigma[i + 1]);
+    if (not(std::abs(rho[i]) < 1.0)) return std::nullopt;
+  }
+
+  for (Index i = 0; i < n; i++) {
+    Numeric r = 1.0;
+    for (Index j = i + 1; j < n; j++) {
+      r *= rho[j - 1];
+      const Numeric s = sigma[i] * sigma[j];
+      if (std::abs(C(i, j) / s - r) > tolerance or
+          std::abs(C(j, i) / s - r) > tolerance) {
+        return std::nullopt;
+      }
+    }
+  }
+
+  MarkovInverse out{.diag = Vector(n, 1.0),
+                    .upper = Vector(std::max<Index>(n - 1, 0))};
+  for (Index i = 0; i < n - 1; i++) {
+    const Numeric a  = 1.0 / (1.0 - rho[i] * rho[i]);
+    out.diag[i]     += a - 1.0;
+    out.diag[i + 1] += a - 1.0;
+    out.upper[i]     = -rho[i] * a / (sigma[i] * sigma[i + 1]);
+  }
+  for (Index i = 0; i < n; i++) out.diag[i] /= sigma[i] * sigma[i];
+
+  return out;
+}
+
+using DenseLLT  = Eigen::LLT<Eigen::MatrixXd>;
+using SparseLLT = Eigen::SimplicialLLT<Eigen::SparseMatrix<Numeric>>;
+}  // namespace
+
+/*! The factorization of a set of correlated blocks of a covariance matrix
+ *
+ * The retrieval quantities of the set are mapped to a continuous square
+ * matrix, in the order of their indices, which is then factorized.
+ */
+class CovarianceFactor {
+  std::vector<Index> indices_{};
+  std::vector<Range> ranges_{};
+  Index n_{0};
+
+  std::variant<MarkovInverse, DenseLLT, SparseLLT> data_{};
+
+  //! The rows of A that belong to the set, as a continuous matrix
+  [[nodiscard]] Eigen::MatrixXd gather(ConstMatrixView A) const {
+    Eigen::MatrixXd X(n_, A.ncols());
+    Index i0 = 0;
+    for (const Range &r : ranges_) {
+      for (Index i = 0; i < r.extent; i++) {
+        for (Index j = 0; j < A.ncols(); j++) {
+          X(i0 + i, j) = A(r.offset + i, j);
+        }
+      }
+      i0 += r.extent;
+    }
+    return X;
+  }
+
+  //! Add the continuous X to the rows of C that belong to the set
+  void scatter_add(MatrixView C, const Eigen::MatrixXd &X) const {
+    Index i0 = 0;
+    for (const Range &r : ranges_) {
+      for (Index i = 0; i < r.extent; i++) {
+        for (Index j = 0; j < C.ncols(); j++) {
+          C(r.offset + i, j) += X(i0 + i, j);
+        }
+      }
+      i0 += r.extent;
+    }
+  }
+
+  [[nodiscard]] Eigen::MatrixXd solve(const Eigen::MatrixXd &B) const {
+    if (const auto *m = std::get_if<MarkovInverse>(&data_)) return m->mult(B);
+    if (const auto *d = std::get_if<DenseLLT>(&data_)) return d->solve(B);
+    return std::get<SparseLLT>(data_).solve(B);
+  }
+
+ public:
+  explicit CovarianceFactor(const std::vector<const Block *> &blocks) {
+    std::map<Index, Index> start{};
+    for (const Block *b : blocks) {
+      Index ci, cj;
+      std::tie(ci, cj) = b->get_indices();
+      if (ci == cj) {
+        indices_.push_back(ci);
+        ranges_.push_back(b->get_row_range());
+        start[ci]  = n_;
+        n_        += b->nrows();
+      }
+    }
+
+    constexpr std::string_view error =
+        "Error factorizing block of covariance matrix. Make sure that it is "
+        "symmetric, positive definite or provide the inverse manually.";
+
+    if (std::ranges::all_of(blocks, &Block::is_sparse)) {
+      std::vector<Eigen::Triplet<Numeric>> triplets;
+      for (const Block *b : blocks) {
+        Index ci, cj;
+        std::tie(ci, cj) = b->get_indices();
+        const auto &S = b->get_sparse().matrix;
+        for (Index k = 0; k < S.outerSize(); ++k) {
+          for (Eigen::SparseMatrix<Numeric, Eigen::RowMajor>::InnerIterator it(
+                   S, k);
+               it;
+               ++it) {
+            triplets.emplace_back(
+                start[ci] + it.row(), start[cj] + it.col(), it.value());
+            if (ci != cj) {
+              triplets.emplace_back(
+                  start[cj] + it.col(), start[ci] + it.row(), it.value());
+            }
+          }
+        }
+      }
+
+      Eigen::SparseMatrix<Numeric> A(n_, n_);
+      A.setFromTriplets(triplets.begin(), triplets.end());
+
+      auto &llt = data_.emplace<SparseLLT>();
+      llt.compute(A);
+      ARTS_USER_ERROR_IF(llt.info() != Eigen::Success, "{}", error)
+      return;
+    }
+
+    if (blocks.size() == 1) {
+      if (auto m = markov_inverse(blocks.front()->get_dense())) {
+        data_ = std::move(*m);
+        return;
+      }
+    }
+
+    Eigen::MatrixXd A = Eigen::MatrixXd::Zero(n_, n_);
+    for (const Block *b : blocks) {
+      Index ci, cj;
+      std::tie(ci, cj) = b->get_indices();
+      const Matrix B =
+          b->is_dense() ? b->get_dense() : Matrix(b->get_sparse());
+      for (Index i = 0; i < B.nrows(); i++) {
+        for (Index j = 0; j < B.ncols(); j++) {
+          A(start[ci] + i, start[cj] + j) = B(i, j);
+          A(start[cj] + j, start[ci] + i) = B(i, j);
+        }
+      }
+    }
+
+    auto &llt = data_.emplace<DenseLLT>(A);
+    ARTS_USER_ERROR_IF(llt.info() != Eigen::Success, "{}", error)
+  }
+
+  //! Whether the retrieval quantity i is in the set
+  [[nodiscard]] bool has(Index i) const {
+    return std::ranges::find(indices_, i) != indices_.end();
+  }
+
+  //! The first retrieval quantity in the set
+  [[nodiscard]] Index front() const { return indices_.front(); }
+
+  //! C += inv(S) * B for the rows and columns of the set
+  void add_inv_mult(MatrixView C, ConstMatrixView B) const {
+    scatter_add(C, solve(gather(B)));
+  }
+
+  //! C += A * inv(S) for the rows and columns of the set
+  void add_mult_inv(MatrixView C, ConstMatrixView A) const {
+    scatter_add(transpose(C), solve(gather(transpose(A))));
+  }
+
+  //! Set the rows of the set in diag to the diagonal of inv(S)
+  void inverse_diagonal(VectorView diag) const {
+    Eigen::VectorXd d(n_);
+    if (const auto *m = std::get_if<MarkovInverse>(&data_)) {
+      for (Index i = 0; i < n_; i++) d[i] = m->diag[i];
+    } else if (const auto *l = std::get_if<DenseLLT>(&data_)) {
+      // inv(S) = inv(L)^T inv(L), so solve one column of inv(L) at a time
+      Eigen::VectorXd e(n_);
+      for (Index i = 0; i < n_; i++) {
+        e.setZero();
+        e[i] = 1.0;
+        l->matrixL().solveInPlace(e);
+        d[i] = e.squaredNorm();
+      }
+    } else {
+      // As above, but P S P^T = L L^T
+      const auto &l = std::get<SparseLLT>(data_);
+      Eigen::VectorXd e(n_);
+      for (Index i = 0; i < n_; i++) {
+        e.setZero();
+        e[l.permutationP().indices()[i]] = 1.0;
+        l.matrixL().solveInPlace(e);
+        d[i] = e.squaredNorm();
+      }
+    }
+
+    Index i0 = 0;
+    for (const Range &r : ranges_) {
+      for (Index i = 0; i < r.extent; i++) diag[r.offset + i] = d[i0 + i];
+      i0 += r.extent;
+    }
+  }
+
+  /*! Append the blocks of the inverse
+   *
+   * Note that blocks that are implicitly zero in the covariance matrix may be
+   * non-zero in the inverse, so there may be more inverse blocks than blocks.
+   */
+  void add_inverse_blocks(std::vector<Block> &inverses) const {
+    if (const auto *m = std::get_if<MarkovInverse>(&data_)) {
+      const Range &r = ranges_.front();
+      inverses.emplace_back(r,
+                            r,
+                            std::make_pair(indices_.front(), indices_.front()),
+                            std::make_shared<Sparse>(m->sparse()));
+      return;
+    }
+
+    const Eigen::MatrixXd A = solve(Eigen::MatrixXd::Identity(n_, n_));
+
+    Index i0 = 0;
+    for (std::size_t bi = 0; bi < indices_.size(); bi++) {
+      Index j0 = i0;
+      for (std::size_t bj = bi; bj < indices_.size(); bj++) {
+        auto B = std::make_shared<Matrix>(ranges_[bi].extent,
+                                          ranges_[bj].extent);
+        for (Index i = 0; i < ranges_[bi].extent; i++) {
+          for (Index j = 0; j < ranges_[bj].extent; j++) {
+            (*B)(i, j) = A(i0 + i, j0 + j);
+          }
+        }
+        inverses.emplace_back(ranges_[bi],
+                              ranges_[bj],
+                              std::make_pair(indices_[bi], indices_[bj]),
+                              std::move(B));
+        j0 += ranges_[bj].extent;
+      }
+      i0 += ranges_[bi].extent;
+    }
+  }
+};
+
 //------------------------------------------------------------------------------
 // Covariance Matrix
 //------------------------------------------------------------------------------
@@ -237,11 +546,13 @@ CovarianceMatrix::operator Matrix() const {
 }
 
 Matrix CovarianceMatrix::get_inverse() const {
+  compute_inverse();
+
   Index n = nrows();
   Matrix A(n, n);
   A = 0.0;
 
-  for (const Block &c : inverses_) {
+  for (const Block &c : inverse_blocks()) {
     MatrixView Aview = A(c.get_row_range(), c.get_column_range());
     if (c.is_dense()) {
       Aview = c.get_dense();
@@ -468,15 +779,38 @@ void CovarianceMatrix::generate_blocks(
 }
 
 void CovarianceMatrix::compute_inverse() const {
+  compute_factors();
+  if (not factor_inverses_.empty()) return;
+
+  for (const auto &f : factors_) f->add_inverse_blocks(factor_inverses_);
+}
+
+std::vector<Block> CovarianceMatrix::inverse_blocks() const {
+  std::vector<Block> out;
+  for (const Block &c : inverses_) {
+    if (not is_factorized(c.get_indices().first)) out.push_back(c);
+  }
+  for (const Block &c : factor_inverses_) out.push_back(c);
+  return out;
+}
+
+void CovarianceMatrix::clear_factors() {
+  factors_.clear();
+  factor_inverses_.clear();
+}
+
+void CovarianceMatrix::compute_factors() const {
+  if (not factors_.empty()) return;
+
   std::vector<std::vector<const Block *>> correlation_blocks{};
   generate_blocks(correlation_blocks);
   for (std::vector<const Block *> &cb : correlation_blocks) {
-    invert_correlation_block(inverses_, cb);
+    factorize_correlation_block(cb);
   }
 }
 
-void CovarianceMatrix::invert_correlation_block(
-    std::vector<Block> &inverses, std::vector<const Block *> &blocks) const {
+void CovarianceMatrix::factorize_correlation_block(
+    std::vector<const Block *> &blocks) const {
   // Can't compute inverse of empty block.
   ARTS_ASSERT(blocks.size() > 0);
 
@@ -495,100 +829,22 @@ void CovarianceMatrix::invert_correlation_block(
   };
   if (std::all_of(blocks.begin(), blocks.end(), block_has_inverse)) return;
 
-  // Otherwise go on to precompute the inverse of a block consisting
-  // of correlations between multiple retrieval quantities.
-
-  // The single blocks corresponding to a set of correlated retrieval quantities
-  // can be distributed freely over the covariance matrix, so we need to establish
-  // a mapping to a continuous square matrix to compute the inverse. This is done by
-  // mapping the coordinates of each block to a start row and extent in the continuous
-  // matrix A. We also record which retrieval quantity indices belong to this
-  // set of retrieval quantities.
-  Index n = 0;
-  std::map<Index, Index> block_start{};
-  std::map<Index, Index> block_extent{};
-  std::map<Index, Index> block_start_cont{};
-  std::map<Index, Index> block_extent_cont{};
-  std::vector<Index> block_indices{};
-
-  for (size_t i = 0; i < blocks.size(); ++i) {
-    Index ci, cj;
-    std::tie(ci, cj) = blocks[i]->get_indices();
-
-    if (ci == cj) {
-      Index extent = blocks[i]->get_row_range().extent;
-      block_start.insert(std::make_pair(ci, blocks[i]->get_row_range().offset));
-      block_extent.insert(
-          std::make_pair(ci, blocks[i]->get_row_range().extent));
-      block_start_cont.insert(std::make_pair(ci, n));
-      block_extent_cont.insert(std::make_pair(ci, extent));
-      block_indices.push_back(ci);
-      n += extent;
-    }
-  }
-
-  // Copy blocks into a single dense matrix.
-  Matrix A(n, n);
-  A = 0.0;
-
-  for (size_t i = 0; i < blocks.size(); ++i) {
-    Index ci, cj;
-    std::tie(ci, cj) = blocks[i]->get_indices();
-    Range row_range(block_start_cont[ci], block_extent_cont[ci]);
-    Range column_range(block_start_cont[cj], block_extent_cont[cj]);
-    MatrixView A_view = A(row_range, column_range);
+  factors_.push_back(std::make_shared<const CovarianceFactor>(blocks));
+}
 
-    if (blocks[i]->is_dense()) {
-      A_view = blocks[i]->get_dense();
-    } else {
-      A_view = static_cast<const Matrix>(blocks[i]->get_sparse());
-    }
-  }
-
-  for (Index i = 0; i < n; ++i) {
-    for (Index j = i + 1; j < n; ++j) {
-      A(j, i) = A(i, j);
-    }
-  }
-  inv(A, A);
-
-  // // Invert matrix using LAPACK.
-  // char uplo = 'L';
-  // int  ni, info1(0), info2(0);
-  // ni = static_cast<int>(n);
-  // lapack::dpotrf_(&uplo, &ni, A.get_raw_data(), &ni, &info1);
-  // lapack::dpotri_(&uplo, &ni, A.get_raw_data(), &ni, &info2);
-  // if ((info1 != 0) || info2 !=0) {
-  //     throw std::runtime_error("Error inverting block of covariance matrix."
-  //                              "Make sure that it is symmetric, positive definite"
-  //                              "or provide the inverse manually.");
-  // }
-
-  // Now we need to disassemble the matrix inverse bach to the separate block in the
-  // covariance matrix. Note, however, that blocks that previously were implicitly
-  // zero are now non-zero, i.e. the inverse may contain more blocks than the covariance
-  // matrix itself.
-  for (Index bi : block_indices) {
-    for (Index bj : block_indices) {
-      if (bi <= bj) {
-        Range row_range_A(block_start_cont[bi], block_extent_cont[bi]);
-        Range column_range_A(block_start_cont[bj], block_extent_cont[bj]);
-        Range row_range(block_start[bi], block_extent[bi]);
-        Range column_range(block_start[bj], block_extent[bj]);
-        MatrixView A_view = A(row_range_A, column_range_A);
-        inverses.push_back(Block(row_range,
-                                 column_range,
-                                 std::make_pair(bi, bj),
-                                 std::make_shared<Matrix>(A_view)));
-      }
-    }
-  }
+bool CovarianceMatrix::is_factorized(Index i) const {
+  return std::ranges::any_of(factors_,
+                             [i](const auto &f) { return f->has(i); });
 }
 
-void CovarianceMatrix::add_correlation(Block c) { correlations_.push_back(c); }
+void CovarianceMatrix::add_correlation(Block c) {
+  correlations_.push_back(c);
+  clear_factors();
+}
 
 void CovarianceMatrix::add_correlation_inverse(Block c) {
   inverses_.push_back(c);
+  clear_factors();
 }
 
 Vector CovarianceMatrix::diagonal() const {
@@ -605,17 +861,19 @@ Vector CovarianceMatrix::diagonal() const {
 }
 
 Vector CovarianceMatrix::inverse_diagonal() const {
-  compute_inverse();
+  compute_factors();
 
   Vector diag(nrows());
   for (const Block &b : inverses_) {
     Index i, j;
     std::tie(i, j) = b.get_indices();
 
-    if (i == j) {
+    if (i == j and not is_factorized(i)) {
       diag[b.get_row_range()] = b.diagonal();
     }
   }
+
+  for (const auto &f : factors_) f->inverse_diagonal(diag);
   return diag;
 }
 
@@ -650,33 +908,53 @@ void mult(VectorView w, const CovarianceMatrix &A, ConstVectorView v) {
 }
 
 void mult_inv(MatrixView C, ConstMatrixView A, const CovarianceMatrix &B) {
+  B.compute_factors();
+
   C = 0.0;
   Matrix T(C);
   for (const Block &c : B.inverses_) {
+    if (B.is_factorized(c.get_indices().first)) continue;
     T = 0.0;
     mult(T, A, c);
     C += T;
   }
+
+  for (const auto &f : B.factors_) f->add_mult_inv(C, A);
 }
 
 void mult_inv(MatrixView C, const CovarianceMatrix &A, ConstMatrixView B) {
+  A.compute_factors();
+
   C = 0.0;
   Matrix T(C);
   for (const Block &c : A.inverses_) {
+    if (A.is_factorized(c.get_indices().first)) continue;
     T = 0.0;
     mult(T, c, B);
     C += T;
   }
+
+  for (const auto &f : A.factors_) f->add_inv_mult(C, B);
 }
 
 void solve(VectorView w, const CovarianceMatrix &A, ConstVectorView v) {
+  A.compute_factors();
+
   w = 0.0;
   Vector t(w);
   for (const Block &c : A.inverses_) {
+    if (A.is_factorized(c.get_indices().first)) continue;
     t = 0.0;
     mult(t, c, v);
     w += t;
   }
+
+  if (A.factors_.empty()) return;
+
+  Matrix W(w.size(), 1, 0.0), V(v.size(), 1);
+  V(joker, 0) = v;
+  for (const auto &f : A.factors_) f->add_inv_mult(W, V);
+  w += W(joker, 0);
 }
 
 MatrixView operator+=(MatrixView A, const CovarianceMatrix &B) {
@@ -687,7 +965,8 @@ MatrixView operator+=(MatrixView A, const CovarianceMatrix &B) {
 }
 
 void add_inv(MatrixView A, const CovarianceMatrix &B) {
-  for (const Block &c : B.inverses_) {
+  B.compute_inverse();
+  for (const Block &c : B.inverse_blocks()) {
     A += c;
   }
 }
@@ -21,8 +21,10 @@
 #include <iosfwd>
 #include <memory>
 #include <utility>
+#include <vector>
 
 class CovarianceMatrix;
+class CovarianceFactor;
 
 //------------------------------------------------------------------------------
 // Type Aliases
@@ -205,8 +207,9 @@ void add_inv(MatrixView A, const Block &);
  *
  * Computing inverses of covariance matrices is handled indirectly by providing
  * mult_inv methods that multiply the inverse of the covariance matrix by a given
- * vector or matrix. This, however, requires previously having computed the inverse
- * of the matrix using the compute_inverse method.
+ * vector or matrix. These use the inverse blocks provided by the user and
+ * otherwise Cholesky factors of the correlated blocks, which are computed
+ * by compute_factors as needed.
  */
 class CovarianceMatrix {
  public:
@@ -261,14 +264,20 @@ class CovarianceMatrix {
      * @return Reference to the std::vector holding the block
      * objects of this covariance matrix.
      */
-  std::vector<Block> &get_blocks() { return correlations_; };
+  std::vector<Block> &get_blocks() {
+    clear_factors();
+    return correlations_;
+  };
 
   /** Blocks of the inverse covariance matrix.
      *
      * @return Reference to the std::vector holding the blocks
      * objects of the inverse of the covariance matrix.
      */
-  std::vector<Block> &get_inverse_blocks() { return inverses_; };
+  std::vector<Block> &get_inverse_blocks() {
+    clear_factors();
+    return inverses_;
+  };
 
   /**
      * Checks that the covariance matrix contains one diagonal block per retrieval
@@ -311,11 +320,27 @@ class CovarianceMatrix {
 
   /**
      * Compute the inverse of this correlation matrix. This function must be executed
-     * after all block have been added to the covariance matrix and before any of the
-     * mult_inv or add_inv methods is used.
+     * after all block have been added to the covariance matrix. It is called by
+     * the add_inv and get_inverse methods if needed.
+     *
+     * The inverse blocks are computed from the factors of compute_factors. They
+     * are kept apart from the inverse blocks provided by the user, and are
+     * forgotten with the factors whenever blocks are added.
      */
   void compute_inverse() const;
 
+  /**
+     * Compute the Cholesky factors of all sets of correlated blocks that have
+     * no inverse provided by the user. This function must be executed after
+     * all block have been added to the covariance matrix. It is called by
+     * the mult_inv and solve methods if needed.
+     *
+     * Sets of only sparse blocks get a sparse Cholesky factor, and a single
+     * dense block with exponential, i.e. Markov, correlation gets its
+     * tridiagonal inverse. Other sets get a dense Cholesky factor.
+     */
+  void compute_factors() const;
+
   /** Add block to covariance matrix.
      *
      * This function add a given block to the covariance matrix.
@@ -348,8 +373,8 @@ class CovarianceMatrix {
   /** Diagonal of the inverse of the covariance matrix as vector
      *
      * Extracts the diagonal elements from the inverse of the covariance matrix.
-     * This can trigger the computation of the inverse of the matrix, if it has
-     * not been provided by the user.
+     * This can trigger the computation of the factors of the matrix, if its
+     * inverse has not been provided by the user, but not of the inverse itself.
      *
      * @return A vector containing the diagonal elements.
      */
@@ -378,12 +403,20 @@ class CovarianceMatrix {
 
  private:
   void generate_blocks(std::vector<std::vector<const Block *>> &) const;
-  void invert_correlation_block(std::vector<Block> &inverses,
-                                std::vector<const Block *> &blocks) const;
+  void factorize_correlation_block(std::vector<const Block *> &blocks) const;
   bool has_inverse(IndexPair indices) const;
+  bool is_factorized(Index i) const;
+
+  //! The inverse blocks of the user and of compute_inverse
+  std::vector<Block> inverse_blocks() const;
+
+  //! Forget the factors and the inverse blocks computed from them
+  void clear_factors();
 
   std::vector<Block> correlations_;
-  mutable std::vector<Block> inverses_;
+  std::vector<Block> inverses_;
+  mutable std::vector<std::shared_ptr<const CovarianceFactor>> factors_;
+  mutable std::vector<Block> factor_inverses_;
 };
 
 void mult(MatrixView, ConstMatrixView, const CovarianceMatrix &);
@@ -0,0 +1,108 @@
+#include <disort-test.h>
+
+#include <tuple>
+
+//! The largest absolute difference of a and b relative to the largest of b
+Numeric relative_difference(const auto& a, const auto& b) {
+  ARTS_USER_ERROR_IF(a.shape() != b.shape(), "Bad shapes")
+
+  const auto x = a.flat_view();
+  const auto y = b.flat_view();
+
+  Numeric diff = 0.0, scale = 0.0;
+  for (Index i = 0; i < x.size(); i++) {
+    diff  = std::max(diff, std::abs(x[i] - y[i]));
+    scale = std::max(scale, std::abs(y[i]));
+  }
+  return diff / scale;
+}
+
+//! The fixed-size solvers must give the same results as Lapack
+void test_fixed_solve(const Index NQuad) try {
+  const AscendingGrid tau_arr{0.5, 1., 2., 4., 8.};
+  const Vector omega_arr{0.9, 0.8, 0.99, 0.6, 0.95};
+  const Index NLayers = tau_arr.size();
+
+  Matrix Leg_coeffs_all(NLayers, 32);
+  for (Index i = 0; i < NLayers; i++) {
+    for (Index l = 0; l < 32; l++) {
+      Leg_coeffs_all(i, l) = std::pow(0.5 + 0.1 * static_cast<Numeric>(i), l);
+    }
+  }
+
+  // Both the direct beam and the sources need solves of size NQuad
+  const Numeric mu0  = 0.6;
+  const Numeric I0   = Constant::pi / mu0;
+  const Numeric phi0 = 0.9 * Constant::pi;
+  Matrix b_neg(NQuad, NQuad / 2, 0);
+  b_neg[0] = 1;
+  Matrix b_pos(NQuad, NQuad / 2, 0);
+  b_pos[0] = 1;
+  const std::vector<disort::BDRF> BDRF_Fourier_modes{
+      disort::BDRF{[](auto c, auto&, auto&) { c = 0.3; }}};
+  Matrix s_poly_coeffs(NLayers, 2);
+  for (auto&& v : s_poly_coeffs) v = {1.5, -0.5};
+  const Vector f_arr{Leg_coeffs_all(joker, NQuad)};
+
+  const Index NLeg     = NQuad;
+  const Index NFourier = NQuad;
+
+  const Vector taus{0.1, 0.75, 3.0, 7.5};
+  const Vector phis{0.0, 1.5, 3.0, 4.5};
+
+  const auto compute = [&](bool fixed_nquad_solver) {
+    const disort::main_data dis(NQuad,
+                                NLeg,
+                                NFourier,
+                                tau_arr,
+                                omega_arr,
+                                Leg_coeffs_all,
+                                b_pos,
+                                b_neg,
+                                f_arr,
+                                s_poly_coeffs,
+                                BDRF_Fourier_modes,
+                                mu0,
+                                I0,
+                                phi0,
+                                fixed_nquad_solver);
+    return std::tuple{compute_u(dis, taus, phis, true),
+                      compute_u0(dis, taus),
+                      compute_flux(dis, taus)};
+  };
+
+  const auto [u, u0, flux]             = compute(true);
+  const auto [u_ref, u0_ref, flux_ref] = compute(false);
+
+  const auto check = [NQuad](const char* what, Numeric diff) {
+    constexpr Numeric tolerance = 1e-10;
+    std::cout << std::format("NQuad {}: {} differs by {}\n", NQuad, what, diff);
+    ARTS_USER_ERROR_IF(
+        not(diff < tolerance),
+        "{} differs by {} between the fixed-size and Lapack solvers",
+        what,
+        diff)
+  };
+
+  check("u", relative_difference(u, u_ref));
+  check("u0", relative_difference(u0, u0_ref));
+
+  const auto& [up, down_diffuse, down_direct]             = flux;
+  const auto& [up_ref, down_diffuse_ref, down_direct_ref] = flux_ref;
+  check("flux_up", relative_difference(up, up_ref));
+  check("flux_down_diffuse",
+        relative_difference(down_diffuse, down_diffuse_ref));
+  check("flux_down_direct", relative_difference(down_direct, down_direct_ref));
+} catch (std::exception& e) {
+  throw std::runtime_error(std::format(
+      "Error in test-fixed-solve for NQuad {}:\n{}", NQuad, e.what()));
+}
+
+int main() try {
+  for (Index NQuad = 4; NQuad <= disort::max_fixed_nquad; NQuad += 2) {
+    test_fixed_solve(NQuad);
+  }
+} catch (std::exception& e) {
+  std::cerr << "Error in main:\n" << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -12,6 +12,7 @@
 #include "debug.h"
 #include "legendre.h"
 #include "lin_alg.h"
+#include "matpack_constexpr_lin_alg.h"
 #include "matpack_view.h"
 
 namespace disort {
@@ -31,8 +32,24 @@ Matrix BDRF::operator()(const Vector& a, const Vector& b) const {
 
 std::ostream& operator<<(std::ostream& os, const BDRF&) { return os << "BDRF"; }
 
+/*! Solves A X = B inplace
+
+Systems up to max_fixed_nquad are solved by unrolled fixed-size kernels,
+larger ones by Lapack.  Lapack solves all systems if fixed is false.
+*/
+void solve_nquad_inplace(ExhaustiveVectorView X,
+                         ExhaustiveMatrixView A,
+                         solve_workdata& wo,
+                         const bool fixed) {
+  if (not fixed or
+      not matpack::solve_inplace_fixed<max_fixed_nquad>(X, A)) {
+    solve_inplace(X, A, wo);
+  }
+}
+
 void mathscr_v(ExhaustiveVectorView um,
                mathscr_v_data& data,
+               const bool fixed_nquad_solver,
                const Numeric tau,
                const ExhaustiveConstVectorView& source_poly_coeffs,
                const ExhaustiveConstMatrixView& G,
@@ -48,7 +65,7 @@ void mathscr_v(ExhaustiveVectorView um,
 
   std::ranges::copy(inv_mu, data.k1.begin());
   std::copy(G.elem_begin(), G.elem_end(), data.G.elem_begin());
-  solve_inplace(data.k1, data.G, data.solve_work);
+  solve_nquad_inplace(data.k1, data.G, data.solve_work, fixed_nquad_solver);
 
   for (Index i = 0; i < n; i++) {
     data.cvec[i] = std::pow(tau, n - i);
@@ -110,6 +127,7 @@ void main_data::solve_for_coefs() {
       if (has_source_poly and m_equals_0_bool) {
         mathscr_v(RHS.slice(0, N),
                   comp_data,
+                  fixed_nquad_solver,
                   0.0,
                   source_poly_coeffs[0],
                   G_collect_m[0],
@@ -122,6 +140,7 @@ void main_data::solve_for_coefs() {
           for (Index l = 0; l < ln; l++) {
             mathscr_v(RHS.slice(l * NQuad + N, NQuad),
                       comp_data,
+                      fixed_nquad_solver,
                       tau_arr[l],
                       source_poly_coeffs[l + 1],
                       G_collect_m[l + 1],
@@ -130,6 +149,7 @@ void main_data::solve_for_coefs() {
 
             mathscr_v(RHS.slice(l * NQuad + N, NQuad),
                       comp_data,
+                      fixed_nquad_solver,
                       tau_arr[l],
                       source_poly_coeffs[l],
                       G_collect_m[l],
@@ -143,6 +163,7 @@ void main_data::solve_for_coefs() {
 
         mathscr_v(RHS.slice(n - N, N),
                   comp_data,
+                  fixed_nquad_solver,
                   tau_arr.back(),
                   source_poly_coeffs[ln],
                   G_collect_m[ln],
@@ -154,6 +175,7 @@ void main_data::solve_for_coefs() {
         if (NBDRF > 0) {
           mathscr_v(jvec.slice(0, N),
                     comp_data,
+                    fixed_nquad_solver,
                     tau_arr.back(),
                     source_poly_coeffs[ln],
                     G_collect_m[ln],
@@ -372,7 +394,7 @@ void main_data::diagonalize() {
           jvec.slice(N, N) *= inv_mu_arr.slice(0, N);
 
           std::copy(G.elem_begin(), G.elem_end(), Gml.elem_begin());
-          solve_inplace(jvec, Gml, solve_work);
+          solve_nquad_inplace(jvec, Gml, solve_work, fixed_nquad_solver);
 
           for (Index j = 0; j < NQuad; j++) {
             jvec[j] *= mu0 / (1.0 + K[j] * mu0);
@@ -678,7 +700,8 @@ main_data::main_data(const Index NQuad_,
                      std::vector<BDRF> brdf_fourier_modes_,
                      Numeric mu0_,
                      Numeric I0_,
-                     Numeric phi0_)
+                     Numeric phi0_,
+                     bool fixed_nquad_solver_)
     : NLayers(tau_arr_.size()),
       NQuad(NQuad_),
       NLeg(NLeg_),
@@ -690,6 +713,7 @@ main_data::main_data(const Index NQuad_,
       has_source_poly(Nscoeffs > 0),
       is_multilayer(NLayers > 1),
       has_beam_source(I0_ > 0),
+      fixed_nquad_solver(fixed_nquad_solver_),
       // User data
       tau_arr(std::move(tau_arr_)),
       omega_arr(std::move(omega_arr_)),
@@ -807,6 +831,7 @@ void main_data::u(u_data& data, const Numeric tau, const Numeric phi) const {
     data.src.resize(NQuad, Nscoeffs);
     mathscr_v(data.um[0],
               data.src,
+              fixed_nquad_solver,
               tau,
               source_poly_coeffs[l],
               G_collect[0][l],
@@ -853,6 +878,7 @@ void main_data::u0(u0_data& data, const Numeric tau) const {
     data.src.resize(NQuad, Nscoeffs);
     mathscr_v(data.u0,
               data.src,
+              fixed_nquad_solver,
               tau,
               source_poly_coeffs[l],
               G_collect[0][l],
@@ -1033,6 +1059,7 @@ Numeric main_data::flux_up(flux_data& data, const Numeric tau) const {
     data.src.resize(NQuad, Nscoeffs);
     mathscr_v(data.u0_pos,
               data.src,
+              fixed_nquad_solver,
               tau,
               source_poly_coeffs[l],
               G_collect[0][l],
@@ -1087,6 +1114,7 @@ std::pair<Numeric, Numeric> main_data::flux_down(flux_data& data,
     data.src.resize(NQuad, Nscoeffs);
     mathscr_v(data.u0_neg,
               data.src,
+              fixed_nquad_solver,
               tau,
               source_poly_coeffs[l],
               G_collect[0][l],
@@ -1142,6 +1170,7 @@ void main_data::gridded_flux(ExhaustiveVectorView flux_up,
     if (has_source_poly) {
       mathscr_v(u0,
                 src,
+                fixed_nquad_solver,
                 tau_arr[l],
                 source_poly_coeffs[l],
                 G_collect[0][l],
@@ -1220,6 +1249,7 @@ void main_data::gridded_u(ExhaustiveTensor3View out, const Vector& phi) const {
     if (has_source_poly) {
       mathscr_v(um[0],
                 src,
+                fixed_nquad_solver,
                 tau_arr[l],
                 source_poly_coeffs[l],
                 G_collect[0][l],
@@ -1264,6 +1294,7 @@ void main_data::ungridded_flux(ExhaustiveVectorView flux_up,
     if (has_source_poly) {
       mathscr_v(u0,
                 src,
+                fixed_nquad_solver,
                 tau[il],
                 source_poly_coeffs[l],
                 G_collect[0][l],
@@ -1360,6 +1391,7 @@ void main_data::ungridded_u(ExhaustiveTensor3View out,
     if (has_source_poly) {
       mathscr_v(um[0],
                 src,
+                fixed_nquad_solver,
                 tau[il],
                 source_poly_coeffs[l],
                 G_collect[0][l],
@@ -14,6 +14,9 @@
 #include "sorted_grid.h"
 
 namespace disort {
+//! The largest NQuad whose systems are solved by the fixed-size kernels
+inline constexpr Index max_fixed_nquad = 16;
+
 struct BDRF {
   using func = std::function<void(ExhaustiveMatrixView,
                                   const ExhaustiveConstVectorView&,
@@ -106,6 +109,9 @@ class main_data {
   bool is_multilayer{false};
   bool has_beam_source{false};
 
+  //! Solve systems up to max_fixed_nquad by the fixed-size kernels, not Lapack
+  bool fixed_nquad_solver{true};
+
   //! User inputs
   AscendingGrid tau_arr{};                 // [NLayers]
   Vector omega_arr{};                      // [NLayers]
@@ -206,7 +212,8 @@ class main_data {
             std::vector<BDRF> brdf_fourier_modes,
             Numeric mu0,
             Numeric I0,
-            Numeric phi0);
+            Numeric phi0,
+            bool fixed_nquad_solver = true);
 
   /** Get the index of the tau value closest to the given tau
     *
@@ -72,6 +72,14 @@ void propmat::set_bands(std::shared_ptr<ArrayOfAbsorptionBand> lines_) {
   lines.set_model(std::move(lines_));
 }
 
+void propmat::update_bands(const std::vector<Size>& changed) {
+  lines.update_bands(changed);
+}
+
+bool propmat::shares_bands(const ArrayOfAbsorptionBand& x) const {
+  return lines.shares_bands(x);
+}
+
 void propmat::set_cia(std::shared_ptr<ArrayOfCIARecord> cia_) {
   cia.set_model(std::move(cia_));
 }
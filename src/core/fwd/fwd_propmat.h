@@ -3,6 +3,7 @@
 #include <lbl.h>
 
 #include <memory>
+#include <vector>
 
 #include "atm.h"
 #include "fwd_cia.h"
@@ -43,6 +44,12 @@ class propmat {
   void set_ciaextrap(Numeric extrap);
   void set_ciarobust(Index robust);
   void set_bands(std::shared_ptr<ArrayOfAbsorptionBand> lines);
+
+  //! Recompute only the changed bands of the bands that were changed in place
+  void update_bands(const std::vector<Size>& changed);
+
+  //! Whether the line absorption is computed from these bands
+  [[nodiscard]] bool shares_bands(const ArrayOfAbsorptionBand& x) const;
   void set_cia(std::shared_ptr<ArrayOfCIARecord> cia);
   void set_predef(std::shared_ptr<PredefinedModelData> predef);
   void set_model(std::shared_ptr<ArrayOfXsecRecord> xsec);
@@ -171,6 +171,36 @@ spectral_radiance::spectral_radiance(
   }
 }
 
+void spectral_radiance::update_bands(const std::vector<Size>& changed) {
+  if (changed.empty()) return;
+
+  auto pms = pm.flat_view();
+  if (arts_omp_in_parallel() or arts_omp_get_max_threads() == 1) {
+    for (auto& p : pms) p.update_bands(changed);
+  } else {
+    String errors{};
+
+#pragma omp parallel for
+    for (Index i = 0; i < pms.size(); i++) {
+      try {
+        pms[i].update_bands(changed);
+      } catch (const std::exception& e) {
+#pragma omp critical
+        errors += e.what();
+      }
+    }
+
+    ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+  }
+}
+
+bool spectral_radiance::shares_bands(const ArrayOfAbsorptionBand& x) const {
+  for (auto& p : pm.flat_view()) {
+    if (not p.shares_bands(x)) return false;
+  }
+  return true;
+}
+
 Stokvec spectral_radiance::operator()(const Numeric f,
                                       const std::vector<path>& path_points,
                                       const Numeric cutoff_transmission) const {
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <iosfwd>
+#include <vector>
 
 #include "atm.h"
 #include "fwd_path.h"
@@ -63,6 +64,19 @@ struct spectral_radiance {
                            const std::vector<path>& path_points,
                            spectral_radiance::as_vector) const;
 
+  /*! Recompute only the changed bands at all atmospheric points
+
+  The bands given at construction must have been changed in place, e.g.,
+  by a retrieval.
+
+  @param[in] changed The sorted positions of the changed bands, see
+  lbl::band_changes::band_indices
+  */
+  void update_bands(const std::vector<Size>& changed);
+
+  //! Whether all atmospheric points compute line absorption from these bands
+  [[nodiscard]] bool shares_bands(const ArrayOfAbsorptionBand& x) const;
+
   [[nodiscard]] const AscendingGrid& altitude() const { return alt; }
   [[nodiscard]] const AscendingGrid& latitude() const { return lat; }
   [[nodiscard]] const AscendingGrid& longitude() const { return lon; }
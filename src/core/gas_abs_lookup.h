@@ -111,6 +111,11 @@ class GasAbsLookup {
 
   friend void nca_read_from_file(const int ncid, GasAbsLookup& gal);
 
+  friend void nca_read_from_file(const int ncid,
+                                 GasAbsLookup& gal,
+                                 const Numeric fmin,
+                                 const Numeric fmax);
+
   friend void nca_write_to_file(const int ncid, const GasAbsLookup& gal);
 
   /** The species tags for which the table is valid */
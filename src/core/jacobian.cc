@@ -50,6 +50,20 @@ void LineTarget::update(ArrayOfAbsorptionBand& absorption_bands,
   set_model(absorption_bands, type, x.slice(x_start, x_size));
 }
 
+void LineTarget::update(ArrayOfAbsorptionBand& absorption_bands,
+                        const Vector& x,
+                        lbl::band_changes& changes) const {
+  const auto sz = static_cast<Size>(x.size());
+  ARTS_USER_ERROR_IF(sz < (x_start + x_size), "Got too small vector.")
+
+  Vector before(x_size), after(x_size);
+  set_state(before, absorption_bands, type);
+  set_model(absorption_bands, type, x.slice(x_start, x_size));
+  set_state(after, absorption_bands, type);
+
+  if (before != after) changes.set(type);
+}
+
 void LineTarget::update(Vector& x,
                         const ArrayOfAbsorptionBand& absorption_bands) const {
   const auto sz = static_cast<Size>(x.size());
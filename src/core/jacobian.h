@@ -159,6 +159,9 @@ struct LineTarget {
 
   void update(ArrayOfAbsorptionBand&, const Vector&) const;
 
+  //! As update(bands, x), and records the target in changes if the bands changed
+  void update(ArrayOfAbsorptionBand&, const Vector&, lbl::band_changes&) const;
+
   void update(Vector&, const ArrayOfAbsorptionBand&) const;
 };
 
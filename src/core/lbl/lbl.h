@@ -1,5 +1,7 @@
 #pragma once
 
+#include "lbl_adaptive_grid.h"
+#include "lbl_band_index.h"
 #include "lbl_data.h"
 #include "lbl_fwd.h"
 #include "lbl_lineshape.h"
@@ -7,5 +9,6 @@
 #include "lbl_lineshape_voigt_ecs.h"
 #include "lbl_lineshape_voigt_lte.h"
 #include "lbl_lineshape_voigt_nlte.h"
+#include "lbl_prune.h"
 #include "lbl_temperature_model.h"
 #include "lbl_zeeman.h"
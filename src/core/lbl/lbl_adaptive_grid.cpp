@@ -0,0 +1,210 @@
+#include "lbl_adaptive_grid.h"
+
+#include <jacobian.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include "debug.h"
+#include "lbl_band_index.h"
+#include "lbl_lineshape.h"
+
+namespace lbl {
+namespace {
+template <typename T>
+Numeric max_abs(const T& x) {
+  Numeric out = 0.0;
+  for (auto v : x.data) out = std::max(out, std::abs(v));
+  return out;
+}
+
+//! The largest deviation of x from the mean of a and b
+template <typename T>
+Numeric max_abs_dev(const T& x, const T& a, const T& b) {
+  Numeric out = 0.0;
+  for (Size i = 0; i < x.data.size(); i++) {
+    out = std::max(out, std::abs(x.data[i] - 0.5 * (a.data[i] + b.data[i])));
+  }
+  return out;
+}
+
+std::vector<Numeric> start_grid(const AscendingGrid& f_coarse,
+                                const SpeciesEnum species,
+                                const std::span<const lbl::band>& bnds,
+                                const bool add_line_centers) {
+  std::vector<Numeric> f(f_coarse.begin(), f_coarse.end());
+
+  if (add_line_centers) {
+    for (const auto& [key, bnd] : bnds) {
+      if (species != SpeciesEnum::Bath and species != key.Species()) continue;
+
+      for (const auto& line : bnd) {
+        if (line.f0 > f_coarse.front() and line.f0 < f_coarse.back()) {
+          f.push_back(line.f0);
+        }
+      }
+    }
+
+    std::ranges::sort(f);
+    const auto [first, last] = std::ranges::unique(f);
+    f.erase(first, last);
+  }
+
+  return f;
+}
+}  // namespace
+
+adaptive_spectrum adaptive_calculate(
+    const AscendingGrid& f_coarse,
+    const SpeciesEnum species,
+    const std::span<const lbl::band>& bnds,
+    const linemixing::isot_map& ecs_data,
+    const voigt::ecs::equivalent_lines_tables& ecs_tables,
+    const AtmPoint& atm,
+    const Vector2 los,
+    const adaptive_settings& settings,
+    const bool no_negative_absorption) {
+  ARTS_USER_ERROR_IF(f_coarse.size() < 2,
+                     "Need at least 2 frequency points, got {}",
+                     f_coarse.size())
+  ARTS_USER_ERROR_IF(settings.rtol <= 0.0,
+                     "The relative tolerance must be positive, got {}",
+                     settings.rtol)
+
+  const band_index index{bnds, species};
+  const Jacobian::Targets jacobian_targets{};
+  PropmatMatrix dpm(0, 0);
+  StokvecMatrix dsv(0, 0);
+
+  const auto calc = [&](const Vector& fs) {
+    std::pair<PropmatVector, StokvecVector> out{PropmatVector(fs.size(), 0.0),
+                                                StokvecVector(fs.size(), 0.0)};
+    dpm.resize(0, fs.size());
+    dsv.resize(0, fs.size());
+    calculate(out.first,
+              out.second,
+              dpm,
+              dsv,
+              fs,
+              jacobian_targets,
+              species,
+              bnds,
+              index,
+              {},
+              ecs_data,
+              ecs_tables,
+              atm,
+              los,
+              no_negative_absorption);
+    return out;
+  };
+
+  std::vector<Numeric> f =
+      start_grid(f_coarse, species, bnds, settings.add_line_centers);
+  std::vector<Propmat> pm;
+  std::vector<Stokvec> sv;
+
+  Vector fmid(f.size());
+  std::ranges::copy(f, fmid.begin());
+  {
+    const auto [pm0, sv0] = calc(fmid);
+    pm.assign(pm0.begin(), pm0.end());
+    sv.assign(sv0.begin(), sv0.end());
+  }
+
+  //! Per interval: the error at the last test, or +inf if never tested
+  std::vector<Numeric> err(f.size() - 1,
+                           std::numeric_limits<Numeric>::infinity());
+
+  std::vector<Size> split;
+  std::vector<Numeric> fnew;
+  std::vector<Propmat> pmnew;
+  std::vector<Stokvec> svnew;
+  std::vector<Numeric> errnew;
+  while (f.size() < settings.max_points) {
+    const Numeric pm_scale =
+        std::ranges::max(pm | std::views::transform(max_abs<Propmat>));
+    const Numeric sv_scale =
+        std::ranges::max(sv | std::views::transform(max_abs<Stokvec>));
+    const Numeric pm_tol = settings.rtol * pm_scale;
+    const Numeric sv_tol = settings.rtol * sv_scale;
+
+    split.clear();
+    for (Size i = 0; i < err.size(); i++) {
+      if (err[i] > 0.0 and f[i + 1] - f[i] >= 2.0 * settings.min_df) {
+        split.push_back(i);
+      }
+    }
+    if (split.empty()) break;
+
+    //! Split the worst intervals first if there is not room for all of them
+    if (const Size room = settings.max_points - f.size(); split.size() > room) {
+      std::ranges::nth_element(
+          split, split.begin() + room, std::greater<>{}, [&err](Size i) {
+            return err[i];
+          });
+      split.resize(room);
+      std::ranges::sort(split);
+    }
+
+    fmid.resize(split.size());
+    for (Size j = 0; j < split.size(); j++) {
+      fmid[j] = 0.5 * (f[split[j]] + f[split[j] + 1]);
+    }
+
+    const auto [pmmid, svmid] = calc(fmid);
+
+    const Size n = f.size() + split.size();
+    fnew.clear();
+    pmnew.clear();
+    svnew.clear();
+    errnew.clear();
+    fnew.reserve(n);
+    pmnew.reserve(n);
+    svnew.reserve(n);
+    errnew.reserve(n - 1);
+
+    Size j = 0;
+    for (Size i = 0; i < err.size(); i++) {
+      fnew.push_back(f[i]);
+      pmnew.push_back(pm[i]);
+      svnew.push_back(sv[i]);
+
+      if (j < split.size() and split[j] == i) {
+        //! Relative to the tolerance so that both parts of the spectrum count
+        const Numeric e = std::max(
+            pm_tol > 0.0 ? max_abs_dev(pmmid[j], pm[i], pm[i + 1]) / pm_tol
+                         : 0.0,
+            sv_tol > 0.0 ? max_abs_dev(svmid[j], sv[i], sv[i + 1]) / sv_tol
+                         : 0.0);
+        const Numeric enew = e > 1.0 ? e : 0.0;
+
+        fnew.push_back(fmid[j]);
+        pmnew.push_back(pmmid[j]);
+        svnew.push_back(svmid[j]);
+        errnew.push_back(enew);
+        errnew.push_back(enew);
+        j++;
+      } else {
+        errnew.push_back(err[i]);
+      }
+    }
+    fnew.push_back(f.back());
+    pmnew.push_back(pm.back());
+    svnew.push_back(sv.back());
+
+    std::swap(f, fnew);
+    std::swap(pm, pmnew);
+    std::swap(sv, svnew);
+    std::swap(err, errnew);
+  }
+
+  return {.f_grid = Vector{std::move(f)},
+          .pm     = PropmatVector{std::move(pm)},
+          .sv     = StokvecVector{std::move(sv)}};
+}
+}  // namespace lbl
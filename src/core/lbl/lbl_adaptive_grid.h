@@ -0,0 +1,74 @@
+#pragma once
+
+#include <rtepack.h>
+#include <sorted_grid.h>
+
+#include <span>
+
+#include "lbl_data.h"
+#include "lbl_lineshape_linemixing.h"
+#include "lbl_lineshape_voigt_ecs.h"
+
+namespace lbl {
+//! A spectrum computed on a frequency grid that was refined for it
+struct adaptive_spectrum {
+  AscendingGrid f_grid{};
+  PropmatVector pm{};
+  StokvecVector sv{};
+};
+
+//! Settings for the refinement of adaptive_calculate
+struct adaptive_settings {
+  //! Relative tolerance of linear interpolation between neighbouring points
+  Numeric rtol{1e-3};
+
+  //! Intervals are not split into parts narrower than this [Hz]
+  Numeric min_df{1.0};
+
+  //! The refinement stops when the grid reaches this many points
+  Size max_points{1'000'000};
+
+  //! Also start from the line centers inside the coarse grid
+  bool add_line_centers{true};
+};
+
+/*! Compute the spectrum on an adaptively refined frequency grid
+
+The refinement starts from the coarse grid, with the centers of the lines
+inside of it added by default.  Each pass evaluates the midpoints of the
+intervals that are still marked for refinement in one call to calculate.
+An interval is split if the spectrum at its midpoint deviates from the
+linear interpolation of its end points by more than rtol times the largest
+absolute value of the spectrum on the grid.  Both halves of a split interval
+are tested again in the next pass.
+
+Flat parts of the spectrum thus keep the spacing of the coarse grid, whereas
+the cores of narrow lines are resolved down to min_df.  If the grid would grow
+beyond max_points, only the intervals with the largest errors are split.
+
+The coarse grid must resolve the spectrum well enough that no line is missed
+in between its points.  Adding the line centers ensures this for lines that
+are not shifted far from their centers.
+
+@param[in] f_coarse The coarse grid to start from
+@param[in] species The species to compute, or SpeciesEnum::Bath for all
+@param[in] bnds The bands
+@param[in] ecs_data The ECS data, see calculate
+@param[in] ecs_tables The tabulated ECS bands, see calculate
+@param[in] atm The atmospheric point
+@param[in] los The line of sight
+@param[in] settings The refinement settings
+@param[in] no_negative_absorption See calculate
+@return The refined grid and the spectrum on it
+*/
+adaptive_spectrum adaptive_calculate(
+    const AscendingGrid& f_coarse,
+    const SpeciesEnum species,
+    const std::span<const lbl::band>& bnds,
+    const linemixing::isot_map& ecs_data,
+    const voigt::ecs::equivalent_lines_tables& ecs_tables,
+    const AtmPoint& atm,
+    const Vector2 los,
+    const adaptive_settings& settings = {},
+    const bool no_negative_absorption = false);
+}  // namespace lbl
@@ -0,0 +1,136 @@
+#include "lbl_band_index.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace lbl {
+namespace {
+//! Only these lineshapes return without doing anything if no lines are active
+bool can_cull(const band_data& bnd) {
+  switch (bnd.lineshape) {
+    case LineByLineLineshape::VP_LTE:
+    case LineByLineLineshape::VP_LTE_MIRROR:
+      return true;
+    case LineByLineLineshape::VP_LINE_NLTE:
+    case LineByLineLineshape::VP_ECS_MAKAROV:
+    case LineByLineLineshape::VP_ECS_HARTMANN:
+      return false;
+  }
+  return false;
+}
+}  // namespace
+
+void band_index::bucket::finalize() {
+  std::ranges::stable_sort(bands, {}, &interval::fmin);
+
+  fmax_max.resize(bands.size());
+  Numeric x = -std::numeric_limits<Numeric>::infinity();
+  for (Size i = 0; i < bands.size(); i++) {
+    x           = std::max(x, bands[i].fmax);
+    fmax_max[i] = x;
+  }
+}
+
+void band_index::bucket::find(std::vector<Size>& out,
+                              Numeric f0,
+                              Numeric f1) const {
+  //! No band before first reaches f0, and no band from last starts below f1
+  const auto first = static_cast<Size>(std::distance(
+      fmax_max.begin(), std::ranges::lower_bound(fmax_max, f0)));
+  const auto last  = static_cast<Size>(std::distance(
+      bands.begin(),
+      std::ranges::upper_bound(bands, f1, {}, &interval::fmin)));
+
+  for (Size i = first; i < last; i++) {
+    if (bands[i].fmax >= f0) out.push_back(bands[i].iband);
+  }
+}
+
+band_index::extent band_index::band_extent(const band& bnd) {
+  constexpr Numeric inf = std::numeric_limits<Numeric>::infinity();
+
+  const auto& [key, data] = bnd;
+
+  extent x{.species = key.Species(),
+           .use     = {true, true},
+           .fmin    = -inf,
+           .fmax    = inf};
+
+  if (can_cull(data)) {
+    x.use = {std::ranges::any_of(
+                 data, [](auto& z) { return not z.on; }, &line::z),
+             std::ranges::any_of(
+                 data, [](auto& z) { return z.on; }, &line::z)};
+
+    if (data.size() != 0 and data.cutoff != LineByLineCutoffType::None) {
+      const auto [lo, hi] = std::ranges::minmax_element(data, {}, &line::f0);
+      const Numeric c     = data.get_cutoff_frequency();
+      x.fmin              = lo->f0 - c;
+      x.fmax              = hi->f0 + c;
+    }
+  }
+
+  return x;
+}
+
+band_index::band_index(const std::span<const band>& bnds,
+                       SpeciesEnum species)
+    : indexed_species(species) {
+  extents.reserve(bnds.size());
+
+  for (Size iband = 0; iband < bnds.size(); iband++) {
+    const extent& x = extents.emplace_back(band_extent(bnds[iband]));
+    if (species != SpeciesEnum::Bath and species != x.species) continue;
+
+    const interval y{.fmin = x.fmin, .fmax = x.fmax, .iband = iband};
+
+    auto& spec_buckets = species_buckets[x.species];
+    for (Size i = 0; i < 2; i++) {
+      if (not x.use[i]) continue;
+      spec_buckets[i].bands.push_back(y);
+      all_buckets[i].bands.push_back(y);
+    }
+  }
+
+  for (auto& b : all_buckets) b.finalize();
+  for (auto& [_, bs] : species_buckets) {
+    for (auto& b : bs) b.finalize();
+  }
+}
+
+bool band_index::matches(const std::span<const band>& bnds) const {
+  if (bnds.size() != extents.size()) return false;
+
+  for (Size iband = 0; iband < bnds.size(); iband++) {
+    const SpeciesEnum spec = bnds[iband].key.Species();
+    if (spec != extents[iband].species) return false;
+
+    //! Bands of other species are not in the index
+    if (indexed_species != SpeciesEnum::Bath and indexed_species != spec) {
+      continue;
+    }
+
+    if (band_extent(bnds[iband]) != extents[iband]) return false;
+  }
+
+  return true;
+}
+
+std::vector<Size> band_index::find(SpeciesEnum species,
+                                   Numeric f0,
+                                   Numeric f1,
+                                   bool zeeman) const {
+  std::vector<Size> out;
+
+  if (species == SpeciesEnum::Bath) {
+    all_buckets[zeeman].find(out, f0, f1);
+  } else if (auto it = species_buckets.find(species);
+             it != species_buckets.end()) {
+    it->second[zeeman].find(out, f0, f1);
+  }
+
+  //! The bands are computed in the order they are given
+  std::ranges::sort(out);
+  return out;
+}
+}  // namespace lbl
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "lbl_data.h"
+
+namespace lbl {
+/*! Lookup of the bands that can contribute to a line-by-line calculation
+
+The bands are bucketed by species and by whether or not they have lines
+with Zeeman splitting.  Inside each bucket the bands are sorted by the lower
+edge of the frequency interval they can contribute to, that is, the range
+of their line centers widened by the cutoff frequency, so that the bands
+overlapping a frequency grid are found by binary search.
+
+Only the lineshapes that are a no-op outside of their cutoff are culled by
+frequency and Zeeman splitting.  Other bands are always returned for their
+species, as their calculations check the band for errors regardless of
+the frequency grid.
+
+The index refers to the bands by their position in the list it was built
+from.  It must be rebuilt if that list is changed.  Build it once for all
+calls on the same bands, e.g., as the *absorption_band_index* of the
+workspace.
+*/
+class band_index {
+  struct interval {
+    //! Lowest frequency the band contributes to
+    Numeric fmin;
+
+    //! Highest frequency the band contributes to
+    Numeric fmax;
+
+    //! Position of the band in the original list
+    Size iband;
+  };
+
+  //! What the index depends on for one band
+  struct extent {
+    SpeciesEnum species;
+
+    //! Whether the band is in the unsplit and the Zeeman bucket
+    std::array<bool, 2> use;
+
+    Numeric fmin;
+
+    Numeric fmax;
+
+    bool operator==(const extent&) const = default;
+  };
+
+  static extent band_extent(const band& bnd);
+
+  struct bucket {
+    //! Sorted by fmin
+    std::vector<interval> bands{};
+
+    //! Running maximum of fmax in bands
+    std::vector<Numeric> fmax_max{};
+
+    void finalize();
+
+    void find(std::vector<Size>& out, Numeric f0, Numeric f1) const;
+  };
+
+  //! Index 0 is for unsplit lines, index 1 is for Zeeman split lines
+  using buckets = std::array<bucket, 2>;
+
+  std::unordered_map<SpeciesEnum, buckets> species_buckets{};
+
+  //! All bands, for SpeciesEnum::Bath
+  buckets all_buckets{};
+
+  //! The extent of every band in the original list
+  std::vector<extent> extents{};
+
+  SpeciesEnum indexed_species{SpeciesEnum::Bath};
+
+ public:
+  band_index() = default;
+
+  /*! Build the index
+
+  @param[in] bnds The bands to index
+  @param[in] species Only index bands of this species, unless it is SpeciesEnum::Bath
+  */
+  explicit band_index(const std::span<const band>& bnds,
+                      SpeciesEnum species = SpeciesEnum::Bath);
+
+  //! The size of the list of bands the index was built from
+  [[nodiscard]] Size size() const { return extents.size(); }
+
+  /*! Whether the index is still valid for the bands
+
+  The bands must be as many as when the index was built, and each indexed
+  band must have the same species, frequency range, cutoff and Zeeman
+  splitting.
+
+  @param[in] bnds The bands to check
+  @return true if the index can be used for the bands
+  */
+  [[nodiscard]] bool matches(const std::span<const band>& bnds) const;
+
+  /*! The positions of the bands that can contribute in [f0, f1]
+
+  @param[in] species The species of the bands, or SpeciesEnum::Bath for all
+  @param[in] f0 The lowest frequency of the grid
+  @param[in] f1 The highest frequency of the grid
+  @param[in] zeeman Whether to look for bands with Zeeman split lines or unsplit lines
+  @return The positions of the bands, in ascending order
+  */
+  [[nodiscard]] std::vector<Size> find(SpeciesEnum species,
+                                       Numeric f0,
+                                       Numeric f1,
+                                       bool zeeman) const;
+};
+}  // namespace lbl
+
+using AbsorptionBandIndex = lbl::band_index;
+
+template <>
+struct std::formatter<AbsorptionBandIndex> {
+  format_tags tags;
+
+  [[nodiscard]] constexpr auto& inner_fmt() { return *this; }
+  [[nodiscard]] constexpr auto& inner_fmt() const { return *this; }
+
+  constexpr std::format_parse_context::iterator parse(
+      std::format_parse_context& ctx) {
+    return parse_format_tags(tags, ctx);
+  }
+
+  template <class FmtContext>
+  FmtContext::iterator format(const AbsorptionBandIndex& v,
+                              FmtContext& ctx) const {
+    return tags.format(ctx, "index of "sv, v.size(), " bands"sv);
+  }
+};
@@ -202,4 +202,33 @@ Numeric& line_key::get_value(std::vector<lbl::band>& b) const {
 const Numeric& line_key::get_value(const std::vector<lbl::band>& b) const {
   return local_get_value(b, *this);
 }
+
+void band_changes::set(const line_key& key) {
+  if (auto ptr = std::ranges::lower_bound(keys, key);
+      ptr == keys.end() or *ptr != key) {
+    keys.insert(ptr, key);
+  }
+}
+
+void band_changes::clear() { keys.clear(); }
+
+bool band_changes::empty() const { return keys.empty(); }
+
+std::vector<Size> band_changes::band_indices(
+    const std::vector<lbl::band>& bands) const {
+  std::vector<QuantumIdentifier> changed_bands;
+  for (auto& key : keys) {
+    if (changed_bands.empty() or changed_bands.back() != key.band) {
+      changed_bands.push_back(key.band);
+    }
+  }
+
+  std::vector<Size> out;
+  for (Size i = 0; i < bands.size(); i++) {
+    if (std::ranges::binary_search(changed_bands, bands[i].key)) {
+      out.push_back(i);
+    }
+  }
+  return out;
+}
 }  // namespace lbl
@@ -221,6 +221,29 @@ struct line_key {
   [[nodiscard]] const Numeric& get_value(const std::vector<lbl::band>&) const;
 };
 
+/*! The line parameters that have changed in a list of bands
+
+Changes are recorded as the keys of the changed parameters, e.g., when
+the bands are updated from a model state vector.  Cached computations
+that depend on the bands can then update only the changed bands.
+*/
+struct band_changes {
+  //! The keys of the changed parameters, sorted and unique
+  std::vector<line_key> keys{};
+
+  //! Record a change of the parameter of key
+  void set(const line_key& key);
+
+  //! Forget all changes
+  void clear();
+
+  [[nodiscard]] bool empty() const;
+
+  //! The sorted positions of the changed bands in bands
+  [[nodiscard]] std::vector<Size> band_indices(
+      const std::vector<lbl::band>& bands) const;
+};
+
 std::ostream& operator<<(std::ostream& os, const std::vector<line>& x);
 
 std::ostream& operator<<(std::ostream& os, const std::vector<band>& x);
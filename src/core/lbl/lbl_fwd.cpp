@@ -2,8 +2,10 @@
 
 #include <physics_funcs.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <limits>
+#include <vector>
 
 #include "configtypes.h"
 #include "debug.h"
@@ -13,10 +15,77 @@
 
 namespace lbl::fwd {
 namespace models {
+namespace {
+/*! Recompute the lines of the changed bands in place
+
+@return false if the changed bands no longer fit the ranges
+*/
+template <typename BandShape, typename Cutoff, typename Spec>
+bool update_changed_bands(BandShape& lines,
+                          BandShape& cutoff_lines,
+                          Cutoff& cutoff,
+                          const std::vector<band_range>& ranges,
+                          const ArrayOfAbsorptionBand& bands,
+                          const AtmPoint& atm,
+                          const zeeman::pol pol,
+                          const LineByLineLineshape lineshape,
+                          const std::vector<Size>& changed,
+                          const Spec& spec) {
+  decltype(BandShape::lines) shapes;
+  std::vector<line_pos> shapes_pos;
+  Cutoff cutoff_this;
+
+  for (const Size iband : changed) {
+    if (iband >= bands.size()) return false;
+
+    auto& [qid, band] = bands[iband];
+    if (band.lineshape != lineshape) continue;
+
+    band_shape_helper(shapes,
+                      shapes_pos,
+                      spec(qid),
+                      band,
+                      atm,
+                      std::numeric_limits<Numeric>::lowest(),
+                      std::numeric_limits<Numeric>::max(),
+                      pol);
+
+    const auto range =
+        std::ranges::lower_bound(ranges, iband, {}, &band_range::band);
+    if (range == ranges.end() or range->band != iband) {
+      if (shapes.empty()) continue;
+      return false;
+    }
+
+    if (shapes.size() != range->count or
+        range->cutoff != (band.cutoff == LineByLineCutoffType::ByLine)) {
+      return false;
+    }
+
+    BandShape b{std::move(shapes), band.cutoff_value};
+    if (range->cutoff) {
+      cutoff_this.resize(b.lines.size());
+      b(cutoff_this);
+
+      std::ranges::copy(b.lines, cutoff_lines.lines.begin() + range->start);
+      std::ranges::copy(cutoff_this, cutoff.begin() + range->start);
+    } else {
+      std::ranges::copy(b.lines, lines.lines.begin() + range->start);
+    }
+
+    shapes = std::move(b.lines);
+  }
+
+  return true;
+}
+}  // namespace
+
 void lte::adapt() try {
   lines.lines.resize(0);
   cutoff_lines.lines.resize(0);
   cutoff.resize(0);
+  ranges.resize(0);
+  nbands = bands ? bands->size() : 0;
 
   if (not bands) {
     return;
@@ -32,7 +101,8 @@ void lte::adapt() try {
   std::vector<line_pos> shapes_pos;
   decltype(cutoff) cutoff_this;
 
-  for (auto& [qid, band] : *bands) {
+  for (Size iband = 0; iband < bands->size(); iband++) {
+    auto& [qid, band] = (*bands)[iband];
     if (band.lineshape != LineByLineLineshape::VP_LTE) continue;
 
     band_shape_helper(shapes,
@@ -52,6 +122,8 @@ void lte::adapt() try {
         cutoff_this.resize(b.lines.size());
         b(cutoff_this);
 
+        ranges.push_back(
+            {iband, true, cutoff_lines.lines.size(), b.lines.size()});
         for (auto& line : b.lines) {
           cutoff_lines.lines.push_back(line);
         }
@@ -61,6 +133,7 @@ void lte::adapt() try {
         }
         break;
       case LineByLineCutoffType::None:
+        ranges.push_back({iband, false, lines.lines.size(), b.lines.size()});
         for (auto& line : b.lines) {
           lines.lines.push_back(line);
         }
@@ -76,6 +149,8 @@ void lte_mirror::adapt() {
   lines.lines.resize(0);
   cutoff_lines.lines.resize(0);
   cutoff.resize(0);
+  ranges.resize(0);
+  nbands = bands ? bands->size() : 0;
 
   if (not bands) {
     return;
@@ -87,7 +162,8 @@ void lte_mirror::adapt() {
   std::vector<line_pos> shapes_pos;
   decltype(cutoff) cutoff_this;
 
-  for (auto& [qid, band] : *bands) {
+  for (Size iband = 0; iband < bands->size(); iband++) {
+    auto& [qid, band] = (*bands)[iband];
     if (band.lineshape != LineByLineLineshape::VP_LTE_MIRROR) continue;
 
     band_shape_helper(shapes,
@@ -107,6 +183,8 @@ void lte_mirror::adapt() {
         cutoff_this.resize(b.lines.size());
         b(cutoff_this);
 
+        ranges.push_back(
+            {iband, true, cutoff_lines.lines.size(), b.lines.size()});
         for (auto& line : b.lines) {
           cutoff_lines.lines.push_back(line);
         }
@@ -116,6 +194,7 @@ void lte_mirror::adapt() {
         }
         break;
       case LineByLineCutoffType::None:
+        ranges.push_back({iband, false, lines.lines.size(), b.lines.size()});
         for (auto& line : b.lines) {
           lines.lines.push_back(line);
         }
@@ -130,6 +209,8 @@ void nlte::adapt() {
   lines.lines.resize(0);
   cutoff_lines.lines.resize(0);
   cutoff.resize(0);
+  ranges.resize(0);
+  nbands = bands ? bands->size() : 0;
 
   if (not bands) {
     return;
@@ -141,7 +222,8 @@ void nlte::adapt() {
   std::vector<line_pos> shapes_pos;
   decltype(cutoff) cutoff_this;
 
-  for (auto& [qid, band] : *bands) {
+  for (Size iband = 0; iband < bands->size(); iband++) {
+    auto& [qid, band] = (*bands)[iband];
     if (band.lineshape != LineByLineLineshape::VP_LINE_NLTE) continue;
 
     band_shape_helper(shapes,
@@ -161,6 +243,8 @@ void nlte::adapt() {
         cutoff_this.resize(b.lines.size());
         b(cutoff_this);
 
+        ranges.push_back(
+            {iband, true, cutoff_lines.lines.size(), b.lines.size()});
         for (auto& line : b.lines) {
           cutoff_lines.lines.push_back(line);
         }
@@ -170,6 +254,7 @@ void nlte::adapt() {
         }
         break;
       case LineByLineCutoffType::None:
+        ranges.push_back({iband, false, lines.lines.size(), b.lines.size()});
         for (auto& line : b.lines) {
           lines.lines.push_back(line);
         }
@@ -293,6 +378,60 @@ void nlte::set(std::shared_ptr<ArrayOfAbsorptionBand> bands_,
   pol   = pol_;
   adapt();
 }
+
+void lte::update_bands(const std::vector<Size>& changed) {
+  if (not bands or not atm or bands->size() != nbands or
+      not update_changed_bands(lines,
+                               cutoff_lines,
+                               cutoff,
+                               ranges,
+                               *bands,
+                               *atm,
+                               pol,
+                               LineByLineLineshape::VP_LTE,
+                               changed,
+                               [](const QuantumIdentifier& qid) {
+                                 return qid.Isotopologue();
+                               })) {
+    adapt();
+  }
+}
+
+void lte_mirror::update_bands(const std::vector<Size>& changed) {
+  if (not bands or not atm or bands->size() != nbands or
+      not update_changed_bands(lines,
+                               cutoff_lines,
+                               cutoff,
+                               ranges,
+                               *bands,
+                               *atm,
+                               pol,
+                               LineByLineLineshape::VP_LTE_MIRROR,
+                               changed,
+                               [](const QuantumIdentifier& qid) {
+                                 return qid.Isotopologue();
+                               })) {
+    adapt();
+  }
+}
+
+void nlte::update_bands(const std::vector<Size>& changed) {
+  if (not bands or not atm or bands->size() != nbands or
+      not update_changed_bands(lines,
+                               cutoff_lines,
+                               cutoff,
+                               ranges,
+                               *bands,
+                               *atm,
+                               pol,
+                               LineByLineLineshape::VP_LINE_NLTE,
+                               changed,
+                               [](const QuantumIdentifier& qid) -> auto& {
+                                 return qid;
+                               })) {
+    adapt();
+  }
+}
 }  // namespace models
 
 line_storage::line_storage(std::shared_ptr<AtmPoint> atm_,
@@ -342,6 +481,16 @@ void line_storage::set_atm(std::shared_ptr<AtmPoint> atm_) {
   atm = std::move(atm_);
 }
 
+void line_storage::update_bands(const std::vector<Size>& changed) {
+  for (auto& m : lte) m.update_bands(changed);
+  for (auto& m : lte_mirror) m.update_bands(changed);
+  for (auto& m : nlte) m.update_bands(changed);
+}
+
+bool line_storage::shares_bands(const ArrayOfAbsorptionBand& x) const {
+  return bands.get() == &x;
+}
+
 std::pair<Complex, Complex> line_storage::operator()(
     const Numeric f, const zeeman::pol pol) const {
   std::array res{lte[static_cast<Size>(pol)](f),
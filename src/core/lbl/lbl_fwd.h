@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "atm.h"
 #include "lbl_data.h"
@@ -10,6 +11,21 @@
 
 namespace lbl::fwd {
 namespace models {
+//! Where the lines of a band are in the flattened lines of a model
+struct band_range {
+  //! The position of the band in the bands
+  Size band;
+
+  //! Whether the lines are in the cutoff lines
+  bool cutoff;
+
+  //! The first line shape of the band
+  Size start;
+
+  //! The number of line shapes of the band
+  Size count;
+};
+
 class lte {
   std::shared_ptr<AtmPoint> atm{};
   std::shared_ptr<ArrayOfAbsorptionBand> bands{};
@@ -20,6 +36,9 @@ class lte {
   voigt::lte::band_shape cutoff_lines{};
   ComplexVector cutoff;
 
+  std::vector<band_range> ranges{};
+  Size nbands{0};
+
   void adapt();
 
  public:
@@ -30,6 +49,15 @@ class lte {
   void set_pol(zeeman::pol pol);
   void set(std::shared_ptr<ArrayOfAbsorptionBand> bands, std::shared_ptr<AtmPoint> atm,
   zeeman::pol pol);
+
+  /*! Recompute only the lines of the changed bands
+
+  The bands must have been changed in place.  Falls back to recomputing all
+  lines if the bands no longer fit the flattened lines.
+
+  @param[in] changed The sorted positions of the changed bands
+  */
+  void update_bands(const std::vector<Size>& changed);
 };
 
 class lte_mirror {
@@ -42,6 +70,9 @@ class lte_mirror {
   voigt::lte_mirror::band_shape cutoff_lines{};
   ComplexVector cutoff;
 
+  std::vector<band_range> ranges{};
+  Size nbands{0};
+
   void adapt();
 
  public:
@@ -52,6 +83,9 @@ class lte_mirror {
   void set_pol(zeeman::pol pol);
   void set(std::shared_ptr<ArrayOfAbsorptionBand> bands, std::shared_ptr<AtmPoint> atm,
   zeeman::pol pol);
+
+  //! See lte::update_bands
+  void update_bands(const std::vector<Size>& changed);
 };
 
 class nlte {
@@ -64,6 +98,9 @@ class nlte {
   voigt::nlte::band_shape cutoff_lines{};
   matpack::matpack_data<std::pair<Complex, Complex>, 1> cutoff;
 
+  std::vector<band_range> ranges{};
+  Size nbands{0};
+
   void adapt();
 
  public:
@@ -74,6 +111,9 @@ class nlte {
   void set_pol(zeeman::pol pol);
   void set(std::shared_ptr<ArrayOfAbsorptionBand> bands, std::shared_ptr<AtmPoint> atm,
   zeeman::pol pol);
+
+  //! See lte::update_bands
+  void update_bands(const std::vector<Size>& changed);
 };
 }  // namespace models
 
@@ -99,5 +139,11 @@ class line_storage {
 
   void set_model(std::shared_ptr<ArrayOfAbsorptionBand> bands);
   void set_atm(std::shared_ptr<AtmPoint> atm);
+
+  //! Recompute only the lines of the changed bands, see models::lte::update_bands
+  void update_bands(const std::vector<Size>& changed);
+
+  //! Whether the lines are computed from these bands
+  [[nodiscard]] bool shares_bands(const ArrayOfAbsorptionBand& x) const;
 };  // struct frequency
 }  // namespace lbl::fwd
@@ -1,9 +1,11 @@
 #include "lbl_lineshape.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 
 #include "debug.h"
+#include "lbl_band_index.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
 #include "lbl_lineshape_voigt_ecs.h"
@@ -81,10 +83,23 @@ void calculate(PropmatVectorView pm,
                const Jacobian::Targets& jacobian_targets,
                const SpeciesEnum species,
                const std::span<const lbl::band>& bnds,
+               const band_index& index,
+               const std::span<const band_selection> selection,
                const linemixing::isot_map& ecs_data,
+               const voigt::ecs::equivalent_lines_tables& ecs_tables,
                const AtmPoint& atm,
                const Vector2 los,
                const bool no_negative_absorption) {
+  ARTS_USER_ERROR_IF(index.size() != bnds.size(),
+                     "The band index is for {} bands but there are {} bands",
+                     index.size(),
+                     bnds.size())
+  ARTS_USER_ERROR_IF(
+      not selection.empty() and selection.size() != bnds.size(),
+      "The selection is for {} bands but there are {} bands",
+      selection.size(),
+      bnds.size())
+
   auto voigt_lte_data = init_voigt_lte_data(f_grid, bnds, atm, los);
   auto voigt_lte_mirror_data =
       init_voigt_lte_mirrored_data(f_grid, bnds, atm, los);
@@ -93,6 +108,7 @@ void calculate(PropmatVectorView pm,
 
   const auto calc_voigt_lte = [&](const QuantumIdentifier& bnd_key,
                                   const band_data& bnd,
+                                  const band_selection* const sel,
                                   const zeeman::pol pol) {
     voigt::lte::calculate(pm,
                           dpm,
@@ -101,6 +117,7 @@ void calculate(PropmatVectorView pm,
                           jacobian_targets,
                           bnd_key,
                           bnd,
+                          sel,
                           atm,
                           pol,
                           no_negative_absorption);
@@ -108,6 +125,7 @@ void calculate(PropmatVectorView pm,
 
   const auto calc_voigt_lte_mirrored = [&](const QuantumIdentifier& bnd_key,
                                            const band_data& bnd,
+                                           const band_selection* const sel,
                                            const zeeman::pol pol) {
     voigt::lte_mirror::calculate(pm,
                                  dpm,
@@ -116,6 +134,7 @@ void calculate(PropmatVectorView pm,
                                  jacobian_targets,
                                  bnd_key,
                                  bnd,
+                                 sel,
                                  atm,
                                  pol,
                                  no_negative_absorption);
@@ -141,6 +160,21 @@ void calculate(PropmatVectorView pm,
   const auto calc_voigt_ecs_linemixing = [&](const QuantumIdentifier& bnd_key,
                                              const band_data& bnd,
                                              const zeeman::pol pol) {
+    if (auto tab = ecs_tables.find(bnd_key); tab != ecs_tables.end()) {
+      voigt::ecs::calculate(pm,
+                            dpm,
+                            *voigt_ecs_data,
+                            f_grid,
+                            jacobian_targets,
+                            bnd_key,
+                            bnd,
+                            tab->second,
+                            atm,
+                            pol,
+                            no_negative_absorption);
+      return;
+    }
+
     auto it = ecs_data.find(bnd_key.Isotopologue());
     if (it == ecs_data.end()) {
       ARTS_USER_ERROR("No ECS data for isotopologue {}", bnd_key.Isotopologue());
@@ -159,15 +193,17 @@ void calculate(PropmatVectorView pm,
                           no_negative_absorption);
   };
 
-  const auto calc_switch = [&](const QuantumIdentifier& bnd_key,
-                               const band_data& bnd,
-                               const zeeman::pol pol) {
+  const auto calc_switch = [&](const Size iband, const zeeman::pol pol) {
+    const auto& [bnd_key, bnd] = bnds[iband];
+    const band_selection* const sel =
+        selection.empty() ? nullptr : &selection[iband];
+
     switch (bnd.lineshape) {
       case LineByLineLineshape::VP_LTE:
-        calc_voigt_lte(bnd_key, bnd, pol);
+        calc_voigt_lte(bnd_key, bnd, sel, pol);
         break;
       case LineByLineLineshape::VP_LTE_MIRROR:
-        calc_voigt_lte_mirrored(bnd_key, bnd, pol);
+        calc_voigt_lte_mirrored(bnd_key, bnd, sel, pol);
         break;
       case LineByLineLineshape::VP_LINE_NLTE:
         calc_voigt_line_nlte(bnd_key, bnd, pol);
@@ -180,20 +216,21 @@ void calculate(PropmatVectorView pm,
     }
   };
 
-  for (auto& [bnd_key, bnd] : bnds) {
-    if (species == bnd_key.Species() or species == SpeciesEnum::Bath) {
-      calc_switch(bnd_key, bnd, zeeman::pol::no);
-    }
+  constexpr Numeric inf = std::numeric_limits<Numeric>::infinity();
+  const Numeric fmin    = f_grid.size() ? f_grid.front() : -inf;
+  const Numeric fmax    = f_grid.size() ? f_grid.back() : inf;
+
+  for (Size iband : index.find(species, fmin, fmax, false)) {
+    calc_switch(iband, zeeman::pol::no);
   }
 
+  const auto zeeman_bands = index.find(species, fmin, fmax, true);
+  if (zeeman_bands.empty()) return;
+
   for (auto pol : {zeeman::pol::pi, zeeman::pol::sm, zeeman::pol::sp}) {
     if (voigt_lte_data) voigt_lte_data->update_zeeman(los, atm.mag, pol);
 
-    for (auto& [bnd_key, bnd] : bnds) {
-      if (species == bnd_key.Species() or species == SpeciesEnum::Bath) {
-        calc_switch(bnd_key, bnd, pol);
-      }
-    }
+    for (Size iband : zeeman_bands) calc_switch(iband, pol);
   }
 }
 }  // namespace lbl
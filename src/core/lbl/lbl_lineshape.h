@@ -1,5 +1,8 @@
+#include "lbl_band_index.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
+#include "lbl_lineshape_voigt_ecs.h"
+#include "lbl_prune.h"
 
 //! FIXME: These functions should be elsewhere?
 namespace Jacobian {
@@ -7,7 +10,21 @@ struct Targets;
 }  // namespace Jacobian
 
 namespace lbl {
-//! NOTE: dpm and dsv are strided as input because the outer dimension is jacobian targets, however, the inner frequency dimension must be contiguous, or the code will terminate.
+/*! Line-by-line calculations of the bands found by a prebuilt index of bnds
+
+NOTE: dpm and dsv are strided as input because the outer dimension is
+jacobian targets, however, the inner frequency dimension must be contiguous,
+or the code will terminate.
+
+The index is built once for the bands, see band_index, and can be shared
+by all calls on them.
+
+ECS bands with an entry in ecs_tables use the tabulated equivalent lines
+instead of diagonalizing their relaxation matrix.
+
+If selection is not empty, it is the output of prune for bnds, and the
+VP_LTE and VP_LTE_MIRROR bands only compute their selected lines.
+*/
 void calculate(PropmatVectorView pm,
                StokvecVectorView sv,
                matpack::matpack_view<Propmat, 2, false, true> dpm,
@@ -16,7 +33,10 @@ void calculate(PropmatVectorView pm,
                const Jacobian::Targets& jacobian_targets,
                const SpeciesEnum species,
                const std::span<const lbl::band>& bnds,
+               const band_index& index,
+               const std::span<const band_selection> selection,
                const linemixing::isot_map& ecs_data,
+               const voigt::ecs::equivalent_lines_tables& ecs_tables,
                const AtmPoint& atm,
                const Vector2 los,
                const bool no_negative_absorption);
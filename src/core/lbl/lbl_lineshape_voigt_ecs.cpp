@@ -6,6 +6,7 @@
 #include <Faddeeva.hh>
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 #include "arts_omp.h"
 #include "atm.h"
@@ -133,7 +134,10 @@ void ComputeData::core_calc_eqv() {
 
 void ComputeData::core_calc(const ExhaustiveConstVectorView& f_grid) {
   core_calc_eqv();
+  core_calc_shape(f_grid);
+}
 
+void ComputeData::core_calc_shape(const ExhaustiveConstVectorView& f_grid) {
   const auto m = vmrs.size();
   const auto n = f_grid.size();
   shape = 0;
@@ -415,6 +419,151 @@ void ComputeData::adapt_single(const QuantumIdentifier& bnd_qid,
   }
 }
 
+namespace {
+//! Line strengths, as the equivalent strengths of a diagonal relaxation matrix
+void lbl_strengths(VectorView str,
+                   const QuantumIdentifier& bnd_qid,
+                   const band_data& bnd,
+                   const Numeric T) {
+  const Numeric QT = PartitionFunctions::Q(T, bnd_qid.Isotopologue());
+
+  for (Size i = 0; i < bnd.size(); i++) {
+    const auto& line = bnd.lines[i];
+    const Numeric pop = line.gu * exp(-line.e0 / (Constant::k * T)) / QT;
+    const Numeric dip2 = 0.25 * Constant::c * Constant::c * line.a /
+                         (Math::pow3(line.f0) * Constant::two_pi);
+    str[i] = pop * dip2;
+  }
+}
+
+//! Line centers and widths, as the equivalent values of a diagonal relaxation matrix
+void lbl_values(ComplexMatrixView val,
+                const band_data& bnd,
+                const AtmPoint& atm,
+                const bool one_by_one) {
+  for (Size i = 0; i < bnd.size(); i++) {
+    const auto& line = bnd.lines[i];
+    if (one_by_one) {
+      for (Size k = 0; k < line.ls.single_models.size(); k++) {
+        const auto& model = line.ls.single_models[k];
+        val(k, i) = Complex(
+            line.f0 + model.D0(line.ls.T0, atm.temperature, atm.pressure),
+            model.G0(line.ls.T0, atm.temperature, atm.pressure));
+      }
+    } else {
+      val(0, i) = Complex(line.f0 + line.ls.D0(atm), line.ls.G0(atm));
+    }
+  }
+}
+}  // namespace
+
+void ComputeData::adapt_tabulated(const QuantumIdentifier& bnd_qid,
+                                  const band_data& bnd,
+                                  const equivalent_lines_table& table,
+                                  const AtmPoint& atm) {
+  const auto n = bnd.size();
+  const bool one_by_one = bnd.front().ls.one_by_one;
+  const auto m = one_by_one ? bnd.front().ls.single_models.size() : 1;
+  const auto nt = table.T.size();
+
+  ARTS_USER_ERROR_IF(
+      table.dval.shape() != std::array{nt, static_cast<Index>(m),
+                                       static_cast<Index>(n)} or
+          table.dstr.shape() != table.dval.shape() or nt < 2,
+      "The equivalent lines table of shape {:B,} does not match the band of {} lines and {} broadening species",
+      table.dval.shape(),
+      n,
+      m)
+
+  const Numeric T = atm.temperature;
+  ARTS_USER_ERROR_IF(T < table.T.front() or T > table.T.back(),
+                     "Temperature {} K is outside the equivalent lines table [{}, {}] K",
+                     T,
+                     table.T.front(),
+                     table.T.back())
+
+  vmrs.resize(m);
+  eqv_strs.resize(m, n);
+  eqv_vals.resize(m, n);
+
+  gd_fac = std::sqrt(Constant::doppler_broadening_const_squared *
+                     atm.temperature / bnd_qid.Isotopologue().mass);
+
+  if (one_by_one) {
+    vmrs = 0;
+    for (Size i = 0; i < m; i++) {
+      const auto spec = bnd.front().ls.single_models[i].species;
+      vmrs[i] = spec == SpeciesEnum::Bath ? 1 - sum(vmrs) : atm[spec];
+    }
+  } else {
+    vmrs = 1;
+  }
+
+  //! The strengths are kept in pop, in band line order
+  pop.resize(n);
+  lbl_strengths(pop, bnd_qid, bnd, T);
+  lbl_values(eqv_vals, bnd, atm, one_by_one);
+
+  const Index it0 = std::clamp<Index>(
+      std::distance(table.T.begin(), std::ranges::upper_bound(table.T, T)) - 1,
+      0,
+      nt - 2);
+  const Numeric w =
+      (T - table.T[it0]) / (table.T[it0 + 1] - table.T[it0]);
+
+  const Numeric x1 = atm.pressure / table.P0;
+  const Numeric x2 = x1 * x1;
+  const Numeric x3 = x2 * x1;
+
+  for (Size k = 0; k < m; k++) {
+    for (Size i = 0; i < n; i++) {
+      const Complex dv =
+          (1 - w) * table.dval(it0, k, i) + w * table.dval(it0 + 1, k, i);
+      const Complex ds =
+          (1 - w) * table.dstr(it0, k, i) + w * table.dstr(it0 + 1, k, i);
+
+      eqv_vals(k, i) += Complex(x2 * dv.real(), x3 * dv.imag());
+      eqv_strs(k, i) = pop[i] * (1.0 + Complex(x2 * ds.real(), x1 * ds.imag()));
+    }
+  }
+}
+
+void calculate(PropmatVectorView pm,
+               matpack::matpack_view<Propmat, 2, false, true>,
+               ComputeData& com_data,
+               const ExhaustiveConstVectorView& f_grid,
+               const Jacobian::Targets& jacobian_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const equivalent_lines_table& table,
+               const AtmPoint& atm,
+               const zeeman::pol pol,
+               const bool no_negative_absorption) {
+  if (pol != zeeman::pol::no) {
+    ARTS_USER_ERROR_IF(
+        std::ranges::any_of(
+            bnd, [](auto& zee) { return zee.on; }, &line::z),
+        "Zeeman effect and ECS in combination is not yet possible.")
+    return;
+  }
+
+  ARTS_USER_ERROR_IF(jacobian_targets.target_count() > 0,
+                     "No Jacobian support.")
+
+  if (bnd.size() == 0) return;
+
+  com_data.adapt_tabulated(bnd_qid, bnd, table, atm);
+  com_data.core_calc_shape(f_grid);
+
+  for (Index i = 0; i < f_grid.size(); ++i) {
+    const auto F = Constant::sqrt_ln_2 / Constant::sqrt_pi *
+                   atm[bnd_qid.Species()] * atm[bnd_qid.Isotopologue()] *
+                   com_data.scl[i] * com_data.shape[i];
+    if (no_negative_absorption and F.real() < 0) continue;
+    pm[i] += zeeman::scale(com_data.npm, F);
+  }
+}
+
 void calculate(PropmatVectorView pm,
                matpack::matpack_view<Propmat, 2, false, true>,
                ComputeData& com_data,
@@ -515,4 +664,67 @@ void equivalent_values(ExhaustiveComplexTensor3View eqv_str,
     }
   }
 }
-}  // namespace lbl::voigt::ecs
\ No newline at end of file
+
+equivalent_lines_table tabulate(ComputeData& com_data,
+                                const QuantumIdentifier& bnd_qid,
+                                const band_data& bnd,
+                                const linemixing::species_data_map& rovib_data,
+                                const AtmPoint& atm,
+                                const Vector& T) {
+  ARTS_USER_ERROR_IF(bnd.size() == 0, "Cannot tabulate an empty band")
+  ARTS_USER_ERROR_IF(T.size() < 2 or not std::ranges::is_sorted(T) or
+                         std::ranges::adjacent_find(T) != T.end(),
+                     "The temperature grid must be ascending with at least "
+                     "two points, got: {:B,}",
+                     T)
+
+  const bool one_by_one = bnd.front().ls.one_by_one;
+  const Index nt = T.size();
+  const Index m =
+      one_by_one ? static_cast<Index>(bnd.front().ls.single_models.size())
+                 : 1;
+  const Index n = static_cast<Index>(bnd.size());
+
+  ComplexTensor3 eqv_str(nt, m, n);
+  ComplexTensor3 eqv_val(nt, m, n);
+  equivalent_values(
+      eqv_str, eqv_val, com_data, bnd_qid, bnd, rovib_data, atm, T);
+
+  equivalent_lines_table table{.P0 = atm.pressure,
+                               .T = T,
+                               .dstr = ComplexTensor3(nt, m, n),
+                               .dval = ComplexTensor3(nt, m, n)};
+
+  Vector str(n);
+  ComplexMatrix val(m, n);
+  ArrayOfIndex eqv_order(n);
+  ArrayOfIndex line_order(n);
+  for (Index it = 0; it < nt; it++) {
+    AtmPoint atm_copy = atm;
+    atm_copy.temperature = T[it];
+
+    lbl_strengths(str, bnd_qid, bnd, T[it]);
+    lbl_values(val, bnd, atm_copy, one_by_one);
+
+    //! The eigenvalues are unordered, pair them with the lines by frequency
+    for (Index k = 0; k < m; k++) {
+      std::iota(eqv_order.begin(), eqv_order.end(), 0);
+      std::iota(line_order.begin(), line_order.end(), 0);
+      std::ranges::sort(eqv_order, {}, [&](Index i) {
+        return eqv_val(it, k, i).real();
+      });
+      std::ranges::sort(
+          line_order, {}, [&](Index i) { return val(k, i).real(); });
+
+      for (Index j = 0; j < n; j++) {
+        const Index ie = eqv_order[j];
+        const Index il = line_order[j];
+        table.dval(it, k, il) = eqv_val(it, k, ie) - val(k, il);
+        table.dstr(it, k, il) = eqv_str(it, k, ie) / str[il] - 1.0;
+      }
+    }
+  }
+
+  return table;
+}
+}  // namespace lbl::voigt::ecs
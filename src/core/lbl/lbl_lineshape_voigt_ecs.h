@@ -2,6 +2,8 @@
 
 #include <rtepack.h>
 
+#include <unordered_map>
+
 #include "array.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
@@ -12,6 +14,49 @@ struct Targets;
 }  // namespace Jacobian
 
 namespace lbl::voigt::ecs {
+/*! Equivalent lines of a band tabulated in temperature
+
+The relaxation matrix is diagonalized once per temperature at a reference
+pressure.  The table keeps the offsets of the equivalent lines from the
+line-by-line values in band line order.  At runtime the offsets are
+linearly interpolated in temperature and scaled to the pressure by the order
+at which they appear in a perturbation expansion of the relaxation matrix:
+line mixing strengths linearly, strength corrections and line shifts
+quadratically, and width corrections cubically.
+
+For bands that are not computed species by species, the broadening species
+mixture of the tabulation is assumed.
+*/
+struct equivalent_lines_table {
+  //! The pressure the table was computed at
+  Numeric P0{};
+
+  //! Ascending temperature grid
+  Vector T{};
+
+  //! Relative offset of the equivalent strengths [T, broadening species or 1, lines]
+  ComplexTensor3 dstr{};
+
+  //! Offset of the equivalent centers and widths [T, broadening species or 1, lines]
+  ComplexTensor3 dval{};
+};
+
+//! Tabulated equivalent lines of the bands, by band identifier
+struct equivalent_lines_tables {
+  std::unordered_map<QuantumIdentifier, equivalent_lines_table> data{};
+
+  equivalent_lines_table& operator[](const QuantumIdentifier& key) {
+    return data[key];
+  }
+  [[nodiscard]] auto find(const QuantumIdentifier& key) const {
+    return data.find(key);
+  }
+  [[nodiscard]] auto begin() const { return data.begin(); }
+  [[nodiscard]] auto end() const { return data.end(); }
+  [[nodiscard]] std::size_t size() const { return data.size(); }
+  [[nodiscard]] bool empty() const { return data.empty(); }
+};
+
 struct ComputeData {
   Numeric gd_fac{};  //! Doppler broadening factor of a band
 
@@ -53,6 +98,7 @@ struct ComputeData {
                      const zeeman::pol pol);
 
   void core_calc_eqv();
+  void core_calc_shape(const ExhaustiveConstVectorView& f_grid);
   void core_calc(const ExhaustiveConstVectorView& f_grid);
   void adapt_single(const QuantumIdentifier& bnd_qid,
                     const band_data& bnd,
@@ -64,6 +110,12 @@ struct ComputeData {
                    const linemixing::species_data_map& rovib_data,
                    const AtmPoint& atm,
                    const bool presorted = false);
+
+  //! Sets the equivalent lines from a table instead of diagonalizing
+  void adapt_tabulated(const QuantumIdentifier& bnd_qid,
+                       const band_data& bnd,
+                       const equivalent_lines_table& table,
+                       const AtmPoint& atm);
 };
 
 void calculate(PropmatVectorView pm,
@@ -78,6 +130,19 @@ void calculate(PropmatVectorView pm,
                const zeeman::pol pol,
                const bool no_negative_absorption);
 
+//! As above, but using tabulated equivalent lines
+void calculate(PropmatVectorView pm,
+               matpack::matpack_view<Propmat, 2, false, true> dpm,
+               ComputeData& com_data,
+               const ExhaustiveConstVectorView& f_grid,
+               const Jacobian::Targets& jacobian_targets,
+               const QuantumIdentifier& bnd_qid,
+               const band_data& bnd,
+               const equivalent_lines_table& table,
+               const AtmPoint& atm,
+               const zeeman::pol pol,
+               const bool no_negative_absorption);
+
 void equivalent_values(ExhaustiveComplexTensor3View eqv_str,
                        ExhaustiveComplexTensor3View eqv_val,
                        ComputeData& com_data,
@@ -86,4 +151,43 @@ void equivalent_values(ExhaustiveComplexTensor3View eqv_str,
                        const linemixing::species_data_map& rovib_data,
                        const AtmPoint& atm,
                        const Vector& T);
+
+/*! Tabulate the equivalent lines of a band
+
+@param[in] com_data Work data
+@param[in] bnd_qid The band identifier
+@param[in] bnd The band
+@param[in] rovib_data The ECS data of the isotopologue
+@param[in] atm The atmospheric point, its pressure and VMRs are used for the table
+@param[in] T The ascending temperature grid
+@return The table
+*/
+equivalent_lines_table tabulate(ComputeData& com_data,
+                                const QuantumIdentifier& bnd_qid,
+                                const band_data& bnd,
+                                const linemixing::species_data_map& rovib_data,
+                                const AtmPoint& atm,
+                                const Vector& T);
 }  // namespace lbl::voigt::ecs
+
+using LinemixingEcsTables = lbl::voigt::ecs::equivalent_lines_tables;
+
+template <>
+struct std::formatter<LinemixingEcsTables> {
+  format_tags tags;
+
+  [[nodiscard]] constexpr auto& inner_fmt() { return *this; }
+  [[nodiscard]] constexpr auto& inner_fmt() const { return *this; }
+
+  constexpr std::format_parse_context::iterator parse(
+      std::format_parse_context& ctx) {
+    return parse_format_tags(tags, ctx);
+  }
+
+  template <class FmtContext>
+  FmtContext::iterator format(const LinemixingEcsTables& v,
+                              FmtContext& ctx) const {
+    return tags.format(
+        ctx, "equivalent lines tables of "sv, v.size(), " bands"sv);
+  }
+};
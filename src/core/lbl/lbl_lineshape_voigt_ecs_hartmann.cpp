@@ -5,22 +5,13 @@
 #include "lbl_lineshape_linemixing.h"
 
 namespace lbl::voigt::ecs::hartmann {
-#if DO_FAST_WIGNER
-#define WIGNER3 fw3jja6
-#define WIGNER6 fw6jja
-#else
-#define WIGNER3 wig3jj
-#define WIGNER6 wig6jj
-#endif
-
 Numeric wig3(const Rational& a,
              const Rational& b,
              const Rational& c,
              const Rational& d,
              const Rational& e,
              const Rational& f) {
-  return WIGNER3(
-      a.toInt(2), b.toInt(2), c.toInt(2), d.toInt(2), e.toInt(2), f.toInt(2));
+  return wigner3j(a, b, c, d, e, f);
 }
 
 Numeric wig6(const Rational& a,
@@ -29,8 +20,7 @@ Numeric wig6(const Rational& a,
              const Rational& d,
              const Rational& e,
              const Rational& f) {
-  return WIGNER6(
-      a.toInt(2), b.toInt(2), c.toInt(2), d.toInt(2), e.toInt(2), f.toInt(2));
+  return wigner6j(a, b, c, d, e, f);
 }
 
 std::function<Numeric(Rational)> erot_selection(const SpeciesIsotope& isot) {
@@ -146,9 +136,6 @@ void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
       W(i, j) = sum * std::exp((erot(Jf_p) - erot(Jf)) / kelvin2joule(T));
     }
   }
-  arts_wigner_thread_free();
-
-  ARTS_USER_ERROR_IF(errno == EDOM, "Cannot compute the wigner symbols")
 
   // Undocumented negative absolute sign
   for (Size i = 0; i < n; i++)
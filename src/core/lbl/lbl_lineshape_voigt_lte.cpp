@@ -370,17 +370,15 @@ struct single_shape_builder {
         G0(ln.ls.single_models[is].G0(ln.ls.T0, atm.temperature, atm.pressure)),
         ispec(is) {}
 
-  [[nodiscard]] single_shape as_zeeman(const Numeric H,
-                                       const zeeman::pol pol,
-                                       const Size iz) const {
-    single_shape s;
-    s.f0     = f0 + H * ln.z.Splitting(ln.qn.val, pol, iz);
-    s.inv_gd = 1.0 / (scaled_gd_part * f0);
-    s.z_imag = G0 * s.inv_gd;
-    s.s      = ln.z.Strength(ln.qn.val, pol, iz) *
-          (ispec == std::numeric_limits<Size>::max()
-               ? line_strength_calc(s.inv_gd, spec, ln, atm)
-               : line_strength_calc(s.inv_gd, spec, ln, atm, ispec));
+  //! A component of a split pattern, from the unsplit shape
+  [[nodiscard]] static single_shape as_zeeman(const single_shape& unsplit,
+                                              const Numeric H,
+                                              const zeeman::model& z,
+                                              const zeeman::split_pattern& zp,
+                                              const Size iz) {
+    single_shape s  = unsplit;
+    s.f0           += H * z.Splitting(zp, iz);
+    s.s            *= zp.strength[iz];
     return s;
   }
 
@@ -461,72 +459,6 @@ single_shape::zFdF::zFdF(const Complex z_)
 
 single_shape::zFdF single_shape::all(const Numeric f) const { return z(f); }
 
-Complex single_shape::df(const Numeric f) const { return s * inv_gd * dF(f); }
-
-Complex single_shape::df0(const Complex ds_df0,
-                          const Complex dz_df0,
-                          const Numeric dz_df0_fac,
-                          const Numeric f) const {
-  const auto [z_, F_, dF_] = all(f);
-  return ds_df0 * F_ + s * (dz_df0 + dz_df0_fac * z_) * dF_;
-}
-
-Complex single_shape::dDV(const Complex ds_dDV,
-                          const Complex dz_dDV,
-                          const Numeric dz_dDV_fac,
-                          const Numeric f) const {
-  const auto [z_, F_, dF_] = all(f);
-  return ds_dDV * F_ + s * (dz_dDV + dz_dDV_fac * z_) * dF_;
-}
-
-Complex single_shape::dD0(const Complex ds_dD0,
-                          const Complex dz_dD0,
-                          const Numeric dz_dD0_fac,
-                          const Numeric f) const {
-  const auto [z_, F_, dF_] = all(f);
-  return ds_dD0 * F_ + s * (dz_dD0 + dz_dD0_fac * z_) * dF_;
-}
-
-Complex single_shape::dG0(const Complex dz_dG0, const Numeric f) const {
-  return s * dz_dG0 * dF(f);
-}
-
-Complex single_shape::dH(const Complex dz_dH, const Numeric f) const {
-  return s * dz_dH * dF(f);
-}
-
-Complex single_shape::dVMR(const Complex ds_dVMR,
-                           const Complex dz_dVMR,
-                           const Numeric dz_dVMR_fac,
-                           const Numeric f) const {
-  const auto [z_, F_, dF_] = all(f);
-  return ds_dVMR * F_ + s * (dz_dVMR + dz_dVMR_fac * z_) * dF_;
-}
-
-Complex single_shape::dT(const Complex ds_dT,
-                         const Complex dz_dT,
-                         const Numeric dz_dT_fac,
-                         const Numeric f) const {
-  const auto [z_, F_, dF_] = all(f);
-  return ds_dT * F_ + s * (dz_dT + dz_dT_fac * z_) * dF_;
-}
-
-Complex single_shape::da(const Complex ds_da, const Numeric f) const {
-  return ds_da * F(f);
-}
-
-Complex single_shape::de0(const Complex ds_de0, const Numeric f) const {
-  return ds_de0 * F(f);
-}
-
-Complex single_shape::dG(const Complex ds_dG, const Numeric f) const {
-  return ds_dG * F(f);
-}
-
-Complex single_shape::dY(const Complex ds_dY, const Numeric f) const {
-  return ds_dY * F(f);
-}
-
 Size count_lines(const band_data& bnd, const zeeman::pol type) {
   return std::transform_reduce(
       bnd.begin(), bnd.end(), Index{}, std::plus<>{}, [type](auto& line) {
@@ -548,10 +480,14 @@ void zeeman_push_back(std::vector<single_shape>& lines,
     lines.emplace_back(s);
     pos.emplace_back(line_pos{.line = iline, .spec = ispec});
   } else {
+    //! The strength of the line is computed once for all its components
+    const single_shape unsplit = s;
+
     const Numeric H = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
-    const auto nz   = static_cast<Size>(line.z.size(line.qn.val, pol));
-    for (Size iz = 0; iz < nz; iz++) {
-      lines.emplace_back(s.as_zeeman(H, pol, iz));
+    const auto& zp  = zeeman::get_split_pattern(line.qn.val, pol);
+    for (Size iz = 0; iz < zp.size(); iz++) {
+      lines.emplace_back(
+          single_shape_builder::as_zeeman(unsplit, H, line.z, zp, iz));
       pos.emplace_back(line_pos{.line = iline, .spec = ispec, .iz = iz});
 
       if (lines.back().s == 0.0) {
@@ -633,6 +569,35 @@ void band_shape_helper(std::vector<single_shape>& lines,
       pos);
 }
 
+void band_shape_helper(std::vector<single_shape>& lines,
+                       std::vector<line_pos>& pos,
+                       const SpeciesIsotope& spec,
+                       const band_data& bnd,
+                       const band_selection& selection,
+                       const AtmPoint& atm,
+                       const Numeric fmin,
+                       const Numeric fmax,
+                       const zeeman::pol pol) {
+  lines.resize(0);
+  pos.resize(0);
+
+  lines.reserve(count_lines(bnd, pol));
+  pos.reserve(lines.capacity());
+
+  //! As for the ByLine cutoff of the band, but with the cutoff of the selection
+  const Numeric c = selection.cutoff;
+  for (Size iline : selection.lines) {
+    const auto& line = bnd.lines[iline];
+    if (line.f0 < fmin - c or line.f0 > fmax + c) continue;
+    lines_push_back(lines, pos, spec, line, atm, pol, iline);
+  }
+
+  bubble_sort_by(
+      [&](const Size l1, const Size l2) { return lines[l1].f0 > lines[l2].f0; },
+      lines,
+      pos);
+}
+
 band_shape::band_shape(std::vector<single_shape>&& ls, const Numeric cut)
     : lines(std::move(ls)), cutoff(cut) {}
 
@@ -643,159 +608,6 @@ Complex band_shape::operator()(const Numeric f) const {
       });
 }
 
-Complex band_shape::df(const Numeric f) const {
-  return std::transform_reduce(
-      lines.begin(), lines.end(), Complex{}, std::plus<>{}, [f](auto& ls) {
-        return ls.df(f);
-      });
-}
-
-Complex band_shape::dH(const ExhaustiveConstComplexVectorView& dz_dH,
-                       const Numeric f) const {
-  ARTS_ASSERT(static_cast<Size>(dz_dH.size()) == lines.size())
-
-  return std::transform_reduce(lines.begin(),
-                               lines.end(),
-                               dz_dH.begin(),
-                               Complex{},
-                               std::plus<>{},
-                               [f](auto& ls, auto& d) { return ls.dH(d, f); });
-}
-
-Complex band_shape::dT(const ExhaustiveConstComplexVectorView& ds_dT,
-                       const ExhaustiveConstComplexVectorView& dz_dT,
-                       const ExhaustiveConstVectorView& dz_dT_fac,
-                       const Numeric f) const {
-  ARTS_ASSERT(ds_dT.size() == dz_dT.size())
-  ARTS_ASSERT(static_cast<Size>(ds_dT.size()) == lines.size())
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    out += lines[i].dT(ds_dT[i], dz_dT[i], dz_dT_fac[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::dVMR(const ExhaustiveConstComplexVectorView& ds_dVMR,
-                         const ExhaustiveConstComplexVectorView& dz_dVMR,
-                         const ExhaustiveConstVectorView& dz_dVMR_fac,
-                         const Numeric f) const {
-  ARTS_ASSERT(ds_dVMR.size() == dz_dVMR.size())
-  ARTS_ASSERT(static_cast<Size>(ds_dVMR.size()) == lines.size())
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    out += lines[i].dVMR(ds_dVMR[i], dz_dVMR[i], dz_dVMR_fac[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::df0(const ExhaustiveConstComplexVectorView ds_df0,
-                        const ExhaustiveConstComplexVectorView dz_df0,
-                        const ExhaustiveConstVectorView dz_df0_fac,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].df0(ds_df0[i], dz_df0[i], dz_df0_fac[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::da(const ExhaustiveConstComplexVectorView ds_da,
-                       const Numeric f,
-                       const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].da(ds_da[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::de0(const ExhaustiveConstComplexVectorView ds_de0,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].de0(ds_de0[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::dDV(const ExhaustiveConstComplexVectorView ds_dDV,
-                        const ExhaustiveConstComplexVectorView dz_dDV,
-                        const ExhaustiveConstVectorView dz_dDV_fac,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].dDV(ds_dDV[i], dz_dDV[i], dz_dDV_fac[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::dD0(const ExhaustiveConstComplexVectorView ds_dD0,
-                        const ExhaustiveConstComplexVectorView dz_dD0,
-                        const ExhaustiveConstVectorView dz_dD0_fac,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].dD0(ds_dD0[i], dz_dD0[i], dz_dD0_fac[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::dG0(const ExhaustiveConstComplexVectorView dz_dG0,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].dG0(dz_dG0[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::dY(const ExhaustiveConstComplexVectorView ds_dY,
-                       const Numeric f,
-                       const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].dY(ds_dY[i], f);
-  }
-
-  return out;
-}
-
-Complex band_shape::dG(const ExhaustiveConstComplexVectorView ds_dG,
-                       const Numeric f,
-                       const std::vector<Size>& filter) const {
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += lines[i].dG(ds_dG[i], f);
-  }
-
-  return out;
-}
-
 Complex band_shape::operator()(const ExhaustiveConstComplexVectorView& cut,
                                const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
@@ -815,321 +627,6 @@ void band_shape::operator()(ExhaustiveComplexVectorView cut) const {
       [cutoff_freq = cutoff](auto& ls) { return ls(ls.f0 + cutoff_freq); });
 }
 
-Complex band_shape::df(const ExhaustiveConstComplexVectorView& cut,
-                       const Numeric f) const {
-  const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
-  return std::transform_reduce(s.begin(),
-                               s.end(),
-                               cs.begin(),
-                               Complex{},
-                               std::plus<>{},
-                               [f](auto& ls, auto& c) { return ls.df(f) - c; });
-}
-
-void band_shape::df(ExhaustiveComplexVectorView cut) const {
-  std::transform(
-      lines.begin(),
-      lines.end(),
-      cut.begin(),
-      [cutoff_freq = cutoff](auto& ls) { return ls.df(ls.f0 + cutoff_freq); });
-}
-
-Complex band_shape::dH(const ExhaustiveConstComplexVectorView& cut,
-                       const ExhaustiveConstComplexVectorView& dz_dH,
-                       const Numeric f) const {
-  ARTS_ASSERT(static_cast<Size>(dz_dH.size()) == lines.size())
-
-  const auto [s, cs, dH] = frequency_spans(cutoff, f, lines, cut, dz_dH);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dH(dH[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dH(ExhaustiveComplexVectorView cut,
-                    const ExhaustiveConstComplexVectorView& df0_dH) const {
-  ARTS_ASSERT(static_cast<Size>(df0_dH.size()) == lines.size())
-
-  std::transform(lines.begin(),
-                 lines.end(),
-                 df0_dH.begin(),
-                 cut.begin(),
-                 [cutoff_freq = cutoff](auto& ls, auto& d) {
-                   return ls.dH(d, ls.f0 + cutoff_freq);
-                 });
-}
-
-Complex band_shape::dT(const ExhaustiveConstComplexVectorView& cut,
-                       const ExhaustiveConstComplexVectorView& ds_dT,
-                       const ExhaustiveConstComplexVectorView& dz_dT,
-                       const ExhaustiveConstVectorView& dz_dT_fac,
-                       const Numeric f) const {
-  ARTS_ASSERT(ds_dT.size() == dz_dT.size())
-  ARTS_ASSERT(static_cast<Size>(ds_dT.size()) == lines.size())
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  const auto [s, cs, ds, dz, dzf] =
-      frequency_spans(cutoff, f, lines, cut, ds_dT, dz_dT, dz_dT_fac);
-
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dT(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dT(ExhaustiveComplexVectorView cut,
-                    const ExhaustiveConstComplexVectorView& ds_dT,
-                    const ExhaustiveConstComplexVectorView& dz_dT,
-                    const ExhaustiveConstVectorView& dz_dT_fac) const {
-  ARTS_ASSERT(ds_dT.size() == dz_dT.size())
-  ARTS_ASSERT(static_cast<Size>(ds_dT.size()) == lines.size())
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    cut[i] =
-        lines[i].dT(ds_dT[i], dz_dT[i], dz_dT_fac[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::dVMR(const ExhaustiveConstComplexVectorView& cut,
-                         const ExhaustiveConstComplexVectorView& ds_dVMR,
-                         const ExhaustiveConstComplexVectorView& dz_dVMR,
-                         const ExhaustiveConstVectorView& dz_dVMR_fac,
-                         const Numeric f) const {
-  ARTS_ASSERT(ds_dVMR.size() == dz_dVMR.size())
-  ARTS_ASSERT(static_cast<Size>(ds_dVMR.size()) == lines.size())
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  const auto [s, cs, ds, dz, dzf] =
-      frequency_spans(cutoff, f, lines, cut, ds_dVMR, dz_dVMR, dz_dVMR_fac);
-
-  for (Size i = 0; i < s.size(); ++i) {
-    out += s[i].dVMR(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dVMR(ExhaustiveComplexVectorView cut,
-                      const ExhaustiveConstComplexVectorView& ds_dVMR,
-                      const ExhaustiveConstComplexVectorView& dz_dVMR,
-                      const ExhaustiveConstVectorView& dz_dVMR_fac) const {
-  ARTS_ASSERT(ds_dVMR.size() == dz_dVMR.size())
-  ARTS_ASSERT(static_cast<Size>(ds_dVMR.size()) == lines.size())
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    cut[i] = lines[i].dVMR(
-        ds_dVMR[i], dz_dVMR[i], dz_dVMR_fac[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::df0(const ExhaustiveConstComplexVectorView& cut,
-                        const ExhaustiveConstComplexVectorView ds_df0,
-                        const ExhaustiveConstComplexVectorView dz_df0,
-                        const ExhaustiveConstVectorView dz_df0_fac,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  const auto [s, cs, ds, dz, dzf] =
-      frequency_spans(cutoff, f, lines, cut, ds_df0, dz_df0, dz_df0_fac);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].df0(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::df0(ExhaustiveComplexVectorView cut,
-                     const ExhaustiveConstComplexVectorView ds_df0,
-                     const ExhaustiveConstComplexVectorView dz_df0,
-                     const ExhaustiveConstVectorView dz_df0_fac,
-                     const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] =
-        lines[i].df0(ds_df0[i], dz_df0[i], dz_df0_fac[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::da(const ExhaustiveConstComplexVectorView& cut,
-                       const ExhaustiveConstComplexVectorView ds_da,
-                       const Numeric f,
-                       const std::vector<Size>& filter) const {
-  const auto [s, cs, ds] = frequency_spans(cutoff, f, lines, cut, ds_da);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].da(ds[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::da(ExhaustiveComplexVectorView cut,
-                    const ExhaustiveConstComplexVectorView ds_da,
-                    const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] = lines[i].da(ds_da[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::de0(const ExhaustiveConstComplexVectorView& cut,
-                        const ExhaustiveConstComplexVectorView ds_de0,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  const auto [s, cs, ds] = frequency_spans(cutoff, f, lines, cut, ds_de0);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].de0(ds[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::de0(ExhaustiveComplexVectorView cut,
-                     const ExhaustiveConstComplexVectorView ds_de0,
-                     const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] = lines[i].de0(ds_de0[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::dDV(const ExhaustiveConstComplexVectorView& cut,
-                        const ExhaustiveConstComplexVectorView ds_dDV,
-                        const ExhaustiveConstComplexVectorView dz_dDV,
-                        const ExhaustiveConstVectorView dz_dDV_fac,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  const auto [s, cs, ds, dz, dzf] =
-      frequency_spans(cutoff, f, lines, cut, ds_dDV, dz_dDV, dz_dDV_fac);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].dDV(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dDV(ExhaustiveComplexVectorView cut,
-                     const ExhaustiveConstComplexVectorView ds_dDV,
-                     const ExhaustiveConstComplexVectorView dz_dDV,
-                     const ExhaustiveConstVectorView dz_dDV_fac,
-                     const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] =
-        lines[i].dDV(ds_dDV[i], dz_dDV[i], dz_dDV_fac[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::dD0(const ExhaustiveConstComplexVectorView& cut,
-                        const ExhaustiveConstComplexVectorView ds_dD0,
-                        const ExhaustiveConstComplexVectorView dz_dD0,
-                        const ExhaustiveConstVectorView dz_dD0_fac,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  const auto [s, cs, ds, dz, dzf] =
-      frequency_spans(cutoff, f, lines, cut, ds_dD0, dz_dD0, dz_dD0_fac);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].dD0(ds[i], dz[i], dzf[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dD0(ExhaustiveComplexVectorView cut,
-                     const ExhaustiveConstComplexVectorView ds_dD0,
-                     const ExhaustiveConstComplexVectorView dz_dD0,
-                     const ExhaustiveConstVectorView dz_dD0_fac,
-                     const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] =
-        lines[i].dD0(ds_dD0[i], dz_dD0[i], dz_dD0_fac[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::dG0(const ExhaustiveConstComplexVectorView& cut,
-                        const ExhaustiveConstComplexVectorView dz_dG0,
-                        const Numeric f,
-                        const std::vector<Size>& filter) const {
-  const auto [s, cs, dz] = frequency_spans(cutoff, f, lines, cut, dz_dG0);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].dG0(dz[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dG0(ExhaustiveComplexVectorView cut,
-                     const ExhaustiveConstComplexVectorView dz_dG0,
-                     const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] = lines[i].dG0(dz_dG0[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::dY(const ExhaustiveConstComplexVectorView& cut,
-                       const ExhaustiveConstComplexVectorView ds_dY,
-                       const Numeric f,
-                       const std::vector<Size>& filter) const {
-  const auto [s, cs, ds] = frequency_spans(cutoff, f, lines, cut, ds_dY);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].dY(ds[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dY(ExhaustiveComplexVectorView cut,
-                    const ExhaustiveConstComplexVectorView ds_dY,
-                    const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] = lines[i].dY(ds_dY[i], lines[i].f0 + cutoff);
-  }
-}
-
-Complex band_shape::dG(const ExhaustiveConstComplexVectorView& cut,
-                       const ExhaustiveConstComplexVectorView ds_dG,
-                       const Numeric f,
-                       const std::vector<Size>& filter) const {
-  const auto [s, cs, ds] = frequency_spans(cutoff, f, lines, cut, ds_dG);
-
-  Complex out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i : filter) {
-    out += s[i].dG(ds[i], f) - cs[i];
-  }
-
-  return out;
-}
-
-void band_shape::dG(ExhaustiveComplexVectorView cut,
-                    const ExhaustiveConstComplexVectorView ds_dG,
-                    const std::vector<Size>& filter) const {
-  for (Size i : filter) {
-    cut[i] = lines[i].dG(ds_dG[i], lines[i].f0 + cutoff);
-  }
-}
-
 void ComputeData::update_zeeman(const Vector2& los,
                                 const Vector3& mag,
                                 const zeeman::pol pol) {
@@ -1147,8 +644,7 @@ ComputeData::ComputeData(const ExhaustiveConstVectorView& f_grid,
                          const zeeman::pol pol)
     : scl(f_grid.size()),
       dscl(f_grid.size()),
-      shape(f_grid.size()),
-      dshape(f_grid.size()) {
+      shape(f_grid.size()) {
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -1163,18 +659,16 @@ ComputeData::ComputeData(const ExhaustiveConstVectorView& f_grid,
   update_zeeman(los, atm.mag, pol);
 }
 
-//! Sizes cut, dcut, dz, ds; sets shape
+//! Sizes cut, dz, ds; sets shape
 void ComputeData::core_calc(const band_shape& shp,
-                            const band_data& bnd,
                             const ExhaustiveConstVectorView& f_grid) {
   cut.resize(shp.size());
   dz.resize(shp.size());
   dz_fac.resize(shp.size());
   ds.resize(shp.size());
-  dcut.resize(shp.size());
   filter.reserve(shp.size());
 
-  if (bnd.cutoff != LineByLineCutoffType::None) {
+  if (std::isfinite(shp.cutoff)) {
     shp(cut);
     std::transform(
         f_grid.begin(), f_grid.end(), shape.begin(), [this, &shp](Numeric f) {
@@ -1188,7 +682,7 @@ void ComputeData::core_calc(const band_shape& shp,
   }
 }
 
-//! Sets dshape and dscl and ds and dz
+//! Sets dscl and ds and dz and dz_fac
 void ComputeData::dt_core_calc(const SpeciesIsotope& spec,
                                const band_shape& shp,
                                const band_data& bnd,
@@ -1240,24 +734,10 @@ void ComputeData::dt_core_calc(const SpeciesIsotope& spec,
                                ls.dG0_dT(line.ls.T0, T, atm.pressure)};
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dT(dcut, ds, dz, dz_fac);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dT(dcut, ds, dz, dz_fac, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dT(ds, dz, dz_fac, f);
-        });
-  }
 }
 
-//! Sets dshape and dscl
+//! Sets dscl and ds and dz and dz_fac
 void ComputeData::df_core_calc(const band_shape& shp,
-                               const band_data& bnd,
                                const ExhaustiveConstVectorView& f_grid,
                                const AtmPoint& atm) {
   std::transform(f_grid.begin(),
@@ -1271,24 +751,16 @@ void ComputeData::df_core_calc(const band_shape& shp,
                    return N * (r * std::exp(-r) - std::expm1(-r)) * c;
                  });
 
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.df(dcut);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.df(dcut, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [&shp](Numeric f) {
-          return shp.df(f);
-        });
+  for (Size i = 0; i < pos.size(); i++) {
+    ds[i]     = 0;
+    dz[i]     = shp.lines[i].inv_gd;
+    dz_fac[i] = 0;
   }
 }
 
-//! Sets dshape and dz
+//! Sets ds and dz and dz_fac
 void ComputeData::dmag_u_core_calc(const band_shape& shp,
                                    const band_data& bnd,
-                                   const ExhaustiveConstVectorView& f_grid,
                                    const AtmPoint& atm,
                                    const zeeman::pol pol) {
   const Numeric H         = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
@@ -1296,28 +768,16 @@ void ComputeData::dmag_u_core_calc(const band_shape& shp,
 
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line = bnd.lines[pos[i].line];
+    ds[i]            = 0;
+    dz_fac[i]        = 0;
     dz[i]            = -shp.lines[pos[i].line].inv_gd * dH_dmag_u *
             line.z.Splitting(line.qn.val, pol, pos[i].iz);
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dH(dcut, dz);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dcut, dz, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dz, f);
-        });
-  }
 }
 
-//! Sets dshape and dz
+//! Sets ds and dz and dz_fac
 void ComputeData::dmag_v_core_calc(const band_shape& shp,
                                    const band_data& bnd,
-                                   const ExhaustiveConstVectorView& f_grid,
                                    const AtmPoint& atm,
                                    const zeeman::pol pol) {
   const Numeric H         = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
@@ -1325,28 +785,16 @@ void ComputeData::dmag_v_core_calc(const band_shape& shp,
 
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line = bnd.lines[pos[i].line];
+    ds[i]            = 0;
+    dz_fac[i]        = 0;
     dz[i]            = -shp.lines[pos[i].line].inv_gd * dH_dmag_v *
             line.z.Splitting(line.qn.val, pol, pos[i].iz);
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dH(dcut, dz);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dcut, dz, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dz, f);
-        });
-  }
 }
 
-//! Sets dshape and dz
+//! Sets ds and dz and dz_fac
 void ComputeData::dmag_w_core_calc(const band_shape& shp,
                                    const band_data& bnd,
-                                   const ExhaustiveConstVectorView& f_grid,
                                    const AtmPoint& atm,
                                    const zeeman::pol pol) {
   const Numeric H         = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
@@ -1354,29 +802,17 @@ void ComputeData::dmag_w_core_calc(const band_shape& shp,
 
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line = bnd.lines[pos[i].line];
+    ds[i]            = 0;
+    dz_fac[i]        = 0;
     dz[i]            = -shp.lines[pos[i].line].inv_gd * dH_dmag_w *
             line.z.Splitting(line.qn.val, pol, pos[i].iz);
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dH(dcut, dz);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dcut, dz, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dz, f);
-        });
-  }
 }
 
-//! Sets ds and dz and dcut and dshape
+//! Sets ds and dz and dz_fac
 void ComputeData::dVMR_core_calc(const SpeciesIsotope& spec,
                                  const band_shape& shp,
                                  const band_data& bnd,
-                                 const ExhaustiveConstVectorView& f_grid,
                                  const AtmPoint& atm,
                                  const zeeman::pol pol,
                                  const SpeciesEnum target_spec) {
@@ -1421,19 +857,6 @@ void ComputeData::dVMR_core_calc(const SpeciesIsotope& spec,
       dz[i] = 0;
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dVMR(dcut, ds, dz, dz_fac);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dVMR(dcut, ds, dz, dz_fac, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dVMR(ds, dz, dz_fac, f);
-        });
-  }
 }
 
 void ComputeData::set_filter(const line_key& key) {
@@ -1457,11 +880,10 @@ void ComputeData::set_filter(const line_key& key) {
   }
 }
 
-//! Sets dshape and ds and dz and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::df0_core_calc(const SpeciesIsotope& spec,
                                 const band_shape& shp,
                                 const band_data& bnd,
-                                const ExhaustiveConstVectorView& f_grid,
                                 const AtmPoint& atm,
                                 const zeeman::pol pol,
                                 const line_key& key) {
@@ -1490,23 +912,11 @@ void ComputeData::df0_core_calc(const SpeciesIsotope& spec,
       dz[i] = -inv_gd;
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.df0(dcut, ds, dz, dz_fac, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.df0(dcut, ds, dz, dz_fac, f_grid[i], filter);
-    }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.df0(ds, dz, dz_fac, f_grid[i], filter);
-    }
-  }
 }
 
-//! Sets dshape and ds and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::de0_core_calc(const band_shape& shp,
                                 const band_data& bnd,
-                                const ExhaustiveConstVectorView& f_grid,
                                 const AtmPoint& atm,
                                 const line_key& key) {
   using Constant::h, Constant::k;
@@ -1516,25 +926,15 @@ void ComputeData::de0_core_calc(const band_shape& shp,
   for (Size i : filter) {
     const Numeric ds_de0_ratio =
         bnd.lines[pos[i].line].ds_de0_s_ratio(atm.temperature);
-    ds[i] = ds_de0_ratio * shp.lines[i].s;
-  }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.de0(dcut, ds, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.de0(dcut, ds, f_grid[i], filter);
-    }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.de0(ds, f_grid[i], filter);
-    }
+    ds[i]     = ds_de0_ratio * shp.lines[i].s;
+    dz[i]     = 0;
+    dz_fac[i] = 0;
   }
 }
 
-//! Sets dshape and ds and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::da_core_calc(const band_shape& shp,
                                const band_data& bnd,
-                               const ExhaustiveConstVectorView& f_grid,
                                const line_key& key) {
   using Constant::h, Constant::k;
 
@@ -1543,24 +943,14 @@ void ComputeData::da_core_calc(const band_shape& shp,
   for (Size i : filter) {
     const Numeric ds_da_ratio = 1.0 / bnd.lines[pos[i].line].a;
     ds[i]                     = ds_da_ratio * shp.lines[i].s;
-  }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.da(dcut, ds, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.da(dcut, ds, f_grid[i], filter);
-    }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.da(ds, f_grid[i], filter);
-    }
+    dz[i]                     = 0;
+    dz_fac[i]                 = 0;
   }
 }
 
-//! Sets dshape and dz and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::dG0_core_calc(const band_shape& shp,
                                 const band_data& bnd,
-                                const ExhaustiveConstVectorView& f_grid,
                                 const AtmPoint& atm,
                                 const line_key& key) {
   set_filter(key);
@@ -1568,6 +958,9 @@ void ComputeData::dG0_core_calc(const band_shape& shp,
   for (Size i : filter) {
     const auto& ls = bnd.lines[pos[i].line].ls;
 
+    ds[i]     = 0;
+    dz_fac[i] = 0;
+
     if (pos[i].spec == std::numeric_limits<Size>::max()) {
       dz[i] = Complex(
           0, shp.lines[i].inv_gd * ls.dG0_dX(atm, key.spec, key.ls_coeff));
@@ -1579,23 +972,11 @@ void ComputeData::dG0_core_calc(const band_shape& shp,
                           ls.T0, atm.temperature, atm.pressure, key.ls_coeff));
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dG0(dcut, dz, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dG0(dcut, dz, f_grid[i], filter);
-    }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dG0(dz, f_grid[i], filter);
-    }
-  }
 }
 
-//! Sets dshape and dz and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::dD0_core_calc(const band_shape& shp,
                                 const band_data& bnd,
-                                const ExhaustiveConstVectorView& f_grid,
                                 const AtmPoint& atm,
                                 const line_key& key) {
   set_filter(key);
@@ -1626,24 +1007,12 @@ void ComputeData::dD0_core_calc(const band_shape& shp,
       dz[i] = -d * inv_gd;
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dD0(dcut, ds, dz, dz_fac, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dD0(dcut, ds, dz, dz_fac, f_grid[i], filter);
-    }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dD0(ds, dz, dz_fac, f_grid[i], filter);
-    }
-  }
 }
 
-//! Sets dshape and ds and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::dY_core_calc(const SpeciesIsotope& spec,
                                const band_shape& shp,
                                const band_data& bnd,
-                               const ExhaustiveConstVectorView& f_grid,
                                const AtmPoint& atm,
                                const zeeman::pol pol,
                                const line_key& key) {
@@ -1653,6 +1022,9 @@ void ComputeData::dY_core_calc(const SpeciesIsotope& spec,
     const auto& line = bnd.lines[pos[i].line];
     const auto& lshp = shp.lines[i];
 
+    dz[i]     = 0;
+    dz_fac[i] = 0;
+
     if (pos[i].spec == std::numeric_limits<Size>::max()) {
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
               dline_strength_calc_dY(line.ls.dY_dX(atm, key.spec, key.ls_coeff),
@@ -1672,24 +1044,12 @@ void ComputeData::dY_core_calc(const SpeciesIsotope& spec,
                   pos[i].spec);
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dY(dcut, dz, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dY(dcut, ds, f_grid[i], filter);
-    }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dY(ds, f_grid[i], filter);
-    }
-  }
 }
 
-//! Sets dshape and ds and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::dG_core_calc(const SpeciesIsotope& spec,
                                const band_shape& shp,
                                const band_data& bnd,
-                               const ExhaustiveConstVectorView& f_grid,
                                const AtmPoint& atm,
                                const zeeman::pol pol,
                                const line_key& key) {
@@ -1699,6 +1059,9 @@ void ComputeData::dG_core_calc(const SpeciesIsotope& spec,
     const auto& line = bnd.lines[pos[i].line];
     const auto& lshp = shp.lines[i];
 
+    dz[i]     = 0;
+    dz_fac[i] = 0;
+
     if (pos[i].spec == std::numeric_limits<Size>::max()) {
       ds[i] = line.z.Strength(line.qn.val, pol, pos[i].iz) *
               dline_strength_calc_dG(line.ls.dG_dX(atm, key.spec, key.ls_coeff),
@@ -1718,23 +1081,11 @@ void ComputeData::dG_core_calc(const SpeciesIsotope& spec,
                   pos[i].spec);
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dG(dcut, dz, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dG(dcut, ds, f_grid[i], filter);
-    }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dG(ds, f_grid[i], filter);
-    }
-  }
 }
 
-//! Sets dshape and dz and dcut and dshape
+//! Sets filter and ds and dz and dz_fac for the filtered lines
 void ComputeData::dDV_core_calc(const band_shape& shp,
                                 const band_data& bnd,
-                                const ExhaustiveConstVectorView& f_grid,
                                 const AtmPoint& atm,
                                 const line_key& key) {
   using Constant::h, Constant::k;
@@ -1767,21 +1118,92 @@ void ComputeData::dDV_core_calc(const band_shape& shp,
       dz[i] = -d * inv_gd;
     }
   }
+}
+
+void ComputeData::jac_init(const Size ntarget,
+                           const Size nlines,
+                           const Index nf) {
+  jac_ds.resize(ntarget, nlines);
+  jac_dz.resize(ntarget, nlines);
+  jac_dz_fac.resize(ntarget, nlines);
+  jac_dcut.resize(ntarget, nlines);
+  jac_dscl.resize(ntarget, nf);
+  jac_dshape.resize(ntarget, nf);
+
+  jac_ds     = 0.0;
+  jac_dz     = 0.0;
+  jac_dz_fac = 0.0;
+  jac_dcut   = 0.0;
+  jac_dscl   = 0.0;
+  jac_dshape = 0.0;
+
+  jac_lines.resize(nlines);
+  for (auto& targets : jac_lines) targets.clear();
+  jac_size = 0;
+}
+
+void ComputeData::jac_push() {
+  const Size k = jac_size++;
+
+  jac_ds[k]     = ds;
+  jac_dz[k]     = dz;
+  jac_dz_fac[k] = dz_fac;
+  jac_dscl[k]   = dscl;
+  for (auto& targets : jac_lines) targets.push_back(k);
+}
+
+void ComputeData::jac_push_filtered() {
+  const Size k = jac_size++;
+
+  for (Size i : filter) {
+    jac_ds(k, i)     = ds[i];
+    jac_dz(k, i)     = dz[i];
+    jac_dz_fac(k, i) = dz_fac[i];
+    jac_lines[i].push_back(k);
+  }
+}
+
+void ComputeData::jac_push_none() { jac_size++; }
 
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dDV(dcut, ds, dz, dz_fac, filter);
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dDV(dcut, ds, dz, dz_fac, f_grid[i], filter);
+void ComputeData::jac_calc(const band_shape& shp,
+                           const ExhaustiveConstVectorView& f_grid) {
+  if (std::isfinite(shp.cutoff)) {
+    for (Size i = 0; i < shp.size(); i++) {
+      if (jac_lines[i].empty()) continue;
+
+      const auto& lshp         = shp.lines[i];
+      const auto [z_, F_, dF_] = lshp.all(lshp.f0 + shp.cutoff);
+      const Complex sdF        = lshp.s * dF_;
+      for (Size k : jac_lines[i]) {
+        jac_dcut(k, i) = jac_ds(k, i) * F_ +
+                         sdF * (jac_dz(k, i) + jac_dz_fac(k, i) * z_);
+      }
     }
-  } else {
-    for (Index i = 0; i < f_grid.size(); i++) {
-      dshape[i] = shp.dDV(ds, dz, dz_fac, f_grid[i], filter);
+  }
+
+  //! One evaluation of the Faddeeva function per line and frequency for all targets
+  for (Index iv = 0; iv < f_grid.size(); iv++) {
+    const Numeric f = f_grid[iv];
+
+    const auto [start, count] =
+        find_offset_and_count_of_frequency_range(shp.lines, f, shp.cutoff);
+
+    for (Index i = start; i < start + count; i++) {
+      if (jac_lines[i].empty()) continue;
+
+      const auto& lshp         = shp.lines[i];
+      const auto [z_, F_, dF_] = lshp.all(f);
+      const Complex sdF        = lshp.s * dF_;
+      for (Size k : jac_lines[i]) {
+        jac_dshape(k, iv) += jac_ds(k, i) * F_ +
+                             sdF * (jac_dz(k, i) + jac_dz_fac(k, i) * z_) -
+                             jac_dcut(k, i);
+      }
     }
   }
 }
 
-void compute_derivative(PropmatVectorView dpm,
-                        ComputeData& com_data,
+void prepare_derivative(ComputeData& com_data,
                         const ExhaustiveConstVectorView& f_grid,
                         const SpeciesIsotope& spec,
                         const band_shape& shape,
@@ -1793,96 +1215,54 @@ void compute_derivative(PropmatVectorView dpm,
   switch (key) {
     case t:
       com_data.dt_core_calc(spec, shape, bnd, f_grid, atm, pol);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] += zeeman::scale(com_data.npm,
-                                com_data.dscl[i] * com_data.shape[i] +
-                                    com_data.scl[i] * com_data.dshape[i]);
-      }
       break;
     case p:
       ARTS_USER_ERROR("Not implemented, pressure derivative");
       break;
     case mag_u:
-      com_data.dmag_u_core_calc(shape, bnd, f_grid, atm, pol);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] += zeeman::scale(com_data.npm,
-                                com_data.dnpm_du,
-                                com_data.scl[i] * com_data.shape[i],
-                                com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dmag_u_core_calc(shape, bnd, atm, pol);
       break;
     case mag_v:
-      com_data.dmag_v_core_calc(shape, bnd, f_grid, atm, pol);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] += zeeman::scale(com_data.npm,
-                                com_data.dnpm_dv,
-                                com_data.scl[i] * com_data.shape[i],
-                                com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dmag_v_core_calc(shape, bnd, atm, pol);
       break;
     case mag_w:
-      com_data.dmag_w_core_calc(shape, bnd, f_grid, atm, pol);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] += zeeman::scale(com_data.npm,
-                                com_data.dnpm_dw,
-                                com_data.scl[i] * com_data.shape[i],
-                                com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dmag_w_core_calc(shape, bnd, atm, pol);
       break;
     case wind_u:
     case wind_v:
     case wind_w:
-      com_data.df_core_calc(shape, bnd, f_grid, atm);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] += zeeman::scale(com_data.npm,
-                                com_data.dscl[i] * com_data.shape[i] +
-                                    com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.df_core_calc(shape, f_grid, atm);
       break;
   }
+
+  com_data.jac_push();
 }
 
-void compute_derivative(PropmatVectorView dpm,
-                        ComputeData& com_data,
-                        const ExhaustiveConstVectorView& f_grid,
-                        const SpeciesIsotope& spec,
+void prepare_derivative(ComputeData& com_data,
+                        const ExhaustiveConstVectorView&,
+                        const SpeciesIsotope&,
                         const band_shape&,
                         const band_data&,
-                        const AtmPoint& atm,
+                        const AtmPoint&,
                         const zeeman::pol,
-                        const SpeciesIsotope& deriv_spec) {
-  if (deriv_spec != spec) return;
-
-  const Numeric isorat = atm[spec];
-
-  ARTS_USER_ERROR_IF(
-      isorat == 0,
-      "Does not support 0 for isotopologue ratios (may be added upon request)")
-
-  for (Index i = 0; i < f_grid.size(); i++) {
-    const auto dF  = com_data.scl[i] * com_data.shape[i] / isorat;
-    dpm[i]        += zeeman::scale(com_data.npm, dF);
-  }
+                        const SpeciesIsotope&) {
+  com_data.jac_push_none();
 }
 
-void compute_derivative(PropmatVectorView dpm,
-                        ComputeData& com_data,
-                        const ExhaustiveConstVectorView& f_grid,
+void prepare_derivative(ComputeData& com_data,
+                        const ExhaustiveConstVectorView&,
                         const SpeciesIsotope& spec,
                         const band_shape& shape,
                         const band_data& bnd,
                         const AtmPoint& atm,
                         const zeeman::pol pol,
                         const SpeciesEnum& deriv_spec) {
-  com_data.dVMR_core_calc(spec, shape, bnd, f_grid, atm, pol, deriv_spec);
-  for (Index i = 0; i < f_grid.size(); i++) {
-    dpm[i] += zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-  }
+  com_data.dVMR_core_calc(spec, shape, bnd, atm, pol, deriv_spec);
+  com_data.jac_push();
 }
 
-void compute_derivative(PropmatVectorView dpm,
-                        ComputeData& com_data,
-                        const ExhaustiveConstVectorView& f_grid,
+void prepare_derivative(ComputeData& com_data,
+                        const ExhaustiveConstVectorView&,
                         const SpeciesIsotope& spec,
                         const band_shape& shape,
                         const band_data& bnd,
@@ -1891,83 +1271,170 @@ void compute_derivative(PropmatVectorView dpm,
                         const line_key& deriv) {
   switch (deriv.var) {
     case LineByLineVariable::f0:
-      com_data.df0_core_calc(spec, shape, bnd, f_grid, atm, pol, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.df0_core_calc(spec, shape, bnd, atm, pol, deriv);
+      com_data.jac_push_filtered();
       return;
     case LineByLineVariable::e0:
-      com_data.de0_core_calc(shape, bnd, f_grid, atm, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.de0_core_calc(shape, bnd, atm, deriv);
+      com_data.jac_push_filtered();
       return;
     case LineByLineVariable::a:
-      com_data.da_core_calc(shape, bnd, f_grid, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.da_core_calc(shape, bnd, deriv);
+      com_data.jac_push_filtered();
       return;
   }
 
   switch (deriv.ls_var) {
     case LineShapeModelVariable::G0:
-      com_data.dG0_core_calc(shape, bnd, f_grid, atm, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dG0_core_calc(shape, bnd, atm, deriv);
+      com_data.jac_push_filtered();
       return;
     case LineShapeModelVariable::D0:
-      com_data.dD0_core_calc(shape, bnd, f_grid, atm, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dD0_core_calc(shape, bnd, atm, deriv);
+      com_data.jac_push_filtered();
       return;
     case LineShapeModelVariable::G2:
-      return;
     case LineShapeModelVariable::D2:
-      return;
     case LineShapeModelVariable::FVC:
-      return;
     case LineShapeModelVariable::ETA:
-      return;
+      break;
     case LineShapeModelVariable::Y:
-      com_data.dY_core_calc(spec, shape, bnd, f_grid, atm, pol, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dY_core_calc(spec, shape, bnd, atm, pol, deriv);
+      com_data.jac_push_filtered();
       return;
     case LineShapeModelVariable::G:
-      com_data.dG_core_calc(spec, shape, bnd, f_grid, atm, pol, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dG_core_calc(spec, shape, bnd, atm, pol, deriv);
+      com_data.jac_push_filtered();
       return;
     case LineShapeModelVariable::DV:
-      com_data.dDV_core_calc(shape, bnd, f_grid, atm, deriv);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] +=
-            zeeman::scale(com_data.npm, com_data.scl[i] * com_data.dshape[i]);
-      }
+      com_data.dDV_core_calc(shape, bnd, atm, deriv);
+      com_data.jac_push_filtered();
       return;
   }
+
+  com_data.jac_push_none();
 }
 
-void compute_derivative(PropmatVectorView,
-                        ComputeData&,
+void prepare_derivative(ComputeData& com_data,
                         const ExhaustiveConstVectorView&,
                         const SpeciesIsotope&,
                         const band_shape&,
                         const band_data&,
                         const AtmPoint&,
                         const zeeman::pol,
+                        const auto&) {
+  com_data.jac_push_none();
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        const ComputeData& com_data,
+                        const Size k,
+                        const ExhaustiveConstVectorView& f_grid,
+                        const SpeciesIsotope&,
+                        const AtmPoint&,
+                        const AtmKey& key) {
+  const auto dscl   = com_data.jac_dscl[k];
+  const auto dshape = com_data.jac_dshape[k];
+
+  using enum AtmKey;
+  switch (key) {
+    case t:
+    case wind_u:
+    case wind_v:
+    case wind_w:
+      for (Index i = 0; i < f_grid.size(); i++) {
+        dpm[i] += zeeman::scale(
+            com_data.npm,
+            dscl[i] * com_data.shape[i] + com_data.scl[i] * dshape[i]);
+      }
+      break;
+    case p:
+      break;
+    case mag_u:
+      for (Index i = 0; i < f_grid.size(); i++) {
+        dpm[i] += zeeman::scale(com_data.npm,
+                                com_data.dnpm_du,
+                                com_data.scl[i] * com_data.shape[i],
+                                com_data.scl[i] * dshape[i]);
+      }
+      break;
+    case mag_v:
+      for (Index i = 0; i < f_grid.size(); i++) {
+        dpm[i] += zeeman::scale(com_data.npm,
+                                com_data.dnpm_dv,
+                                com_data.scl[i] * com_data.shape[i],
+                                com_data.scl[i] * dshape[i]);
+      }
+      break;
+    case mag_w:
+      for (Index i = 0; i < f_grid.size(); i++) {
+        dpm[i] += zeeman::scale(com_data.npm,
+                                com_data.dnpm_dw,
+                                com_data.scl[i] * com_data.shape[i],
+                                com_data.scl[i] * dshape[i]);
+      }
+      break;
+  }
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        const ComputeData& com_data,
+                        const Size,
+                        const ExhaustiveConstVectorView& f_grid,
+                        const SpeciesIsotope& spec,
+                        const AtmPoint& atm,
+                        const SpeciesIsotope& deriv_spec) {
+  if (deriv_spec != spec) return;
+
+  const Numeric isorat = atm[spec];
+
+  ARTS_USER_ERROR_IF(
+      isorat == 0,
+      "Does not support 0 for isotopologue ratios (may be added upon request)")
+
+  for (Index i = 0; i < f_grid.size(); i++) {
+    const auto dF  = com_data.scl[i] * com_data.shape[i] / isorat;
+    dpm[i]        += zeeman::scale(com_data.npm, dF);
+  }
+}
+
+//! Line parameters and VMRs only change the line shape
+void shape_derivative(PropmatVectorView dpm,
+                      const ComputeData& com_data,
+                      const Size k,
+                      const ExhaustiveConstVectorView& f_grid) {
+  const auto dshape = com_data.jac_dshape[k];
+  for (Index i = 0; i < f_grid.size(); i++) {
+    dpm[i] += zeeman::scale(com_data.npm, com_data.scl[i] * dshape[i]);
+  }
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        const ComputeData& com_data,
+                        const Size k,
+                        const ExhaustiveConstVectorView& f_grid,
+                        const SpeciesIsotope&,
+                        const AtmPoint&,
+                        const SpeciesEnum&) {
+  shape_derivative(dpm, com_data, k, f_grid);
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        const ComputeData& com_data,
+                        const Size k,
+                        const ExhaustiveConstVectorView& f_grid,
+                        const SpeciesIsotope&,
+                        const AtmPoint&,
+                        const line_key&) {
+  shape_derivative(dpm, com_data, k, f_grid);
+}
+
+void compute_derivative(PropmatVectorView,
+                        const ComputeData&,
+                        const Size,
+                        const ExhaustiveConstVectorView&,
+                        const SpeciesIsotope&,
+                        const AtmPoint&,
                         const auto&) {}
 
 std::ostream& operator<<(std::ostream& os, const ComputeData& cd) {
@@ -1985,6 +1452,7 @@ void calculate(PropmatVectorView pm,
                const JacobianTargets& jacobian_targets,
                const QuantumIdentifier& bnd_qid,
                const band_data& bnd,
+               const band_selection* const selection,
                const AtmPoint& atm,
                const zeeman::pol pol,
                const bool no_negative_absorption) {
@@ -2002,14 +1470,27 @@ void calculate(PropmatVectorView pm,
               nf == dpm.ncols())
   ARTS_ASSERT(nf == pm.nelem())
 
-  band_shape_helper(
-      com_data.lines, com_data.pos, spec, bnd, atm, fmin, fmax, pol);
+  if (selection) {
+    band_shape_helper(com_data.lines,
+                      com_data.pos,
+                      spec,
+                      bnd,
+                      *selection,
+                      atm,
+                      fmin,
+                      fmax,
+                      pol);
+  } else {
+    band_shape_helper(
+        com_data.lines, com_data.pos, spec, bnd, atm, fmin, fmax, pol);
+  }
   if (com_data.lines.empty()) return;
 
   //! Not const to save lines for reuse
-  band_shape shape{std::move(com_data.lines), bnd.get_cutoff_frequency()};
+  band_shape shape{std::move(com_data.lines),
+                   selection ? selection->cutoff : bnd.get_cutoff_frequency()};
 
-  com_data.core_calc(shape, bnd, f_grid);
+  com_data.core_calc(shape, f_grid);
 
   for (Index i = 0; i < nf; i++) {
     const auto F = com_data.scl[i] * com_data.shape[i];
@@ -2017,33 +1498,61 @@ void calculate(PropmatVectorView pm,
     pm[i] += zeeman::scale(com_data.npm, F);
   }
 
-  for (auto& atm_target : jacobian_targets.atm()) {
-    std::visit(
-        [&](auto& target) {
-          compute_derivative(dpm.as_slice(atm_target.target_pos),
-                             com_data,
-                             f_grid,
-                             spec,
-                             shape,
-                             bnd,
-                             atm,
-                             pol,
-                             target);
-        },
-        atm_target.type);
-  }
+  const Size njac =
+      jacobian_targets.atm().size() +
+      std::ranges::count_if(jacobian_targets.line(), [&bnd_qid](auto& target) {
+        return target.type.band == bnd_qid;
+      });
 
-  for (auto& line_target : jacobian_targets.line()) {
-    if (line_target.type.band == bnd_qid) {
-      compute_derivative(dpm.as_slice(line_target.target_pos),
-                         com_data,
-                         f_grid,
-                         spec,
-                         shape,
-                         bnd,
-                         atm,
-                         pol,
-                         line_target.type);
+  if (njac > 0) {
+    com_data.jac_init(njac, shape.size(), nf);
+
+    for (auto& atm_target : jacobian_targets.atm()) {
+      std::visit(
+          [&](auto& target) {
+            prepare_derivative(
+                com_data, f_grid, spec, shape, bnd, atm, pol, target);
+          },
+          atm_target.type);
+    }
+
+    for (auto& line_target : jacobian_targets.line()) {
+      if (line_target.type.band == bnd_qid) {
+        prepare_derivative(
+            com_data, f_grid, spec, shape, bnd, atm, pol, line_target.type);
+      }
+    }
+
+    com_data.jac_calc(shape, f_grid);
+
+    Size k = 0;
+
+    for (auto& atm_target : jacobian_targets.atm()) {
+      std::visit(
+          [&](auto& target) {
+            compute_derivative(dpm.as_slice(atm_target.target_pos),
+                               com_data,
+                               k,
+                               f_grid,
+                               spec,
+                               atm,
+                               target);
+          },
+          atm_target.type);
+      k++;
+    }
+
+    for (auto& line_target : jacobian_targets.line()) {
+      if (line_target.type.band == bnd_qid) {
+        compute_derivative(dpm.as_slice(line_target.target_pos),
+                           com_data,
+                           k,
+                           f_grid,
+                           spec,
+                           atm,
+                           line_target.type);
+        k++;
+      }
     }
   }
 
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "lbl_data.h"
+#include "lbl_prune.h"
 #include "lbl_zeeman.h"
 
 //! FIXME: These functions should be elsewhere?
@@ -64,7 +65,6 @@ struct single_shape {
 
   [[nodiscard]] Complex dF(const Numeric f) const;
 
- private:
   struct zFdF {
     Complex zp, zm;
     Complex Fp, Fm;
@@ -72,47 +72,8 @@ struct single_shape {
     zFdF(const Complex zp_, const Complex zm_);
   };
 
+  //! The arguments, the Faddeeva functions, and their derivatives at a frequency
   [[nodiscard]] zFdF all(const Numeric f) const;
-
- public:
-  [[nodiscard]] Complex df(const Numeric f) const;
-
-  [[nodiscard]] Complex df0(const Complex ds_df0,
-                            const Complex dz_df0,
-                            const Numeric dz_df0_fac,
-                            const Numeric f) const;
-
-  [[nodiscard]] Complex dDV(const Complex ds_dDV,
-                            const Complex dz_dDV,
-                            const Numeric dz_dDV_fac,
-                            const Numeric f) const;
-
-  [[nodiscard]] Complex dD0(const Complex ds_dD0,
-                            const Complex dz_dD0,
-                            const Numeric dz_dD0_fac,
-                            const Numeric f) const;
-
-  [[nodiscard]] Complex dG0(const Complex dz_dG0, const Numeric f) const;
-
-  [[nodiscard]] Complex dH(const Complex dz_dH, const Numeric f) const;
-
-  [[nodiscard]] Complex dVMR(const Complex ds_dVMR,
-                             const Complex dz_dVMR,
-                             const Numeric dz_dVMR_fac,
-                             const Numeric f) const;
-
-  [[nodiscard]] Complex dT(const Complex ds_dT,
-                           const Complex dz_dT,
-                           const Numeric dz_dT_fac,
-                           const Numeric f) const;
-
-  [[nodiscard]] Complex da(const Complex ds_da, const Numeric f) const;
-
-  [[nodiscard]] Complex de0(const Complex ds_de0, const Numeric f) const;
-
-  [[nodiscard]] Complex dG(const Complex ds_dG, const Numeric f) const;
-
-  [[nodiscard]] Complex dY(const Complex ds_dY, const Numeric f) const;
 };
 
 Size count_lines(const band_data& bnd, const zeeman::pol type);
@@ -144,6 +105,17 @@ void band_shape_helper(std::vector<single_shape>& lines,
                        const Numeric fmax,
                        const zeeman::pol pol);
 
+//! As above, but only for the selected lines and with their cutoff
+void band_shape_helper(std::vector<single_shape>& lines,
+                       std::vector<line_pos>& pos,
+                       const SpeciesIsotope& spec,
+                       const band_data& bnd,
+                       const band_selection& selection,
+                       const AtmPoint& atm,
+                       const Numeric fmin,
+                       const Numeric fmax,
+                       const zeeman::pol pol);
+
 constexpr std::pair<Index, Index> find_offset_and_count_of_frequency_range(
     const std::span<const single_shape> lines, Numeric f, Numeric cutoff) {
   if (cutoff < std::numeric_limits<Numeric>::infinity()) {
@@ -194,181 +166,10 @@ struct band_shape {
 
   [[nodiscard]] Complex operator()(const Numeric f) const;
 
-  [[nodiscard]] Complex df(const Numeric f) const;
-
-  [[nodiscard]] Complex dH(const ExhaustiveConstComplexVectorView& dz_dH,
-                           const Numeric f) const;
-
-  [[nodiscard]] Complex dT(const ExhaustiveConstComplexVectorView& ds_dT,
-                           const ExhaustiveConstComplexVectorView& dz_dT,
-                           const ExhaustiveConstVectorView& dz_dT_fac,
-                           const Numeric f) const;
-
-  [[nodiscard]] Complex dVMR(const ExhaustiveConstComplexVectorView& ds_dVMR,
-                             const ExhaustiveConstComplexVectorView& dz_dVMR,
-                             const ExhaustiveConstVectorView& dz_dVMR_fac,
-                             const Numeric f) const;
-
-  [[nodiscard]] Complex df0(const ExhaustiveConstComplexVectorView ds_df0,
-                            const ExhaustiveConstComplexVectorView dz_df0,
-                            const ExhaustiveConstVectorView dz_df0_fac,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex da(const ExhaustiveConstComplexVectorView ds_da,
-                           const Numeric f,
-                           const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex de0(const ExhaustiveConstComplexVectorView ds_de0,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dDV(const ExhaustiveConstComplexVectorView ds_dDV,
-                            const ExhaustiveConstComplexVectorView dz_dDV,
-                            const ExhaustiveConstVectorView dz_dDV_fac,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dD0(const ExhaustiveConstComplexVectorView ds_dD0,
-                            const ExhaustiveConstComplexVectorView dz_dD0,
-                            const ExhaustiveConstVectorView dz_dD0_fac,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dG0(const ExhaustiveConstComplexVectorView dz_dG0,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dY(const ExhaustiveConstComplexVectorView ds_dY,
-                           const Numeric f,
-                           const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dG(const ExhaustiveConstComplexVectorView ds_dG,
-                           const Numeric f,
-                           const std::vector<Size>& filter) const;
-
   [[nodiscard]] Complex operator()(const ExhaustiveConstComplexVectorView& cut,
                                    const Numeric f) const;
 
   void operator()(ExhaustiveComplexVectorView cut) const;
-
-  [[nodiscard]] Complex df(const ExhaustiveConstComplexVectorView& cut,
-                           const Numeric f) const;
-
-  void df(ExhaustiveComplexVectorView cut) const;
-
-  [[nodiscard]] Complex dH(const ExhaustiveConstComplexVectorView& cut,
-                           const ExhaustiveConstComplexVectorView& dz_dH,
-                           const Numeric f) const;
-
-  void dH(ExhaustiveComplexVectorView cut,
-          const ExhaustiveConstComplexVectorView& df0_dH) const;
-
-  [[nodiscard]] Complex dT(const ExhaustiveConstComplexVectorView& cut,
-                           const ExhaustiveConstComplexVectorView& ds_dT,
-                           const ExhaustiveConstComplexVectorView& dz_dT,
-                           const ExhaustiveConstVectorView& dz_dT_fac,
-                           const Numeric f) const;
-
-  void dT(ExhaustiveComplexVectorView cut,
-          const ExhaustiveConstComplexVectorView& ds_dT,
-          const ExhaustiveConstComplexVectorView& dz_dT,
-          const ExhaustiveConstVectorView& dz_dT_fac) const;
-
-  [[nodiscard]] Complex dVMR(const ExhaustiveConstComplexVectorView& cut,
-                             const ExhaustiveConstComplexVectorView& ds_dVMR,
-                             const ExhaustiveConstComplexVectorView& dz_dVMR,
-                             const ExhaustiveConstVectorView& dz_dVMR_fac,
-                             const Numeric f) const;
-
-  void dVMR(ExhaustiveComplexVectorView cut,
-            const ExhaustiveConstComplexVectorView& ds_dVMR,
-            const ExhaustiveConstComplexVectorView& dz_dVMR,
-            const ExhaustiveConstVectorView& dz_dVMR_fac) const;
-
-  [[nodiscard]] Complex df0(const ExhaustiveConstComplexVectorView& cut,
-                            const ExhaustiveConstComplexVectorView ds_df0,
-                            const ExhaustiveConstComplexVectorView dz_df0,
-                            const ExhaustiveConstVectorView dz_df0_fac,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  void df0(ExhaustiveComplexVectorView cut,
-           const ExhaustiveConstComplexVectorView ds_df0,
-           const ExhaustiveConstComplexVectorView dz_df0,
-           const ExhaustiveConstVectorView dz_df0_fac,
-           const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex da(const ExhaustiveConstComplexVectorView& cut,
-                           const ExhaustiveConstComplexVectorView ds_da,
-                           const Numeric f,
-                           const std::vector<Size>& filter) const;
-
-  void da(ExhaustiveComplexVectorView cut,
-          const ExhaustiveConstComplexVectorView ds_da,
-          const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex de0(const ExhaustiveConstComplexVectorView& cut,
-                            const ExhaustiveConstComplexVectorView ds_de0,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  void de0(ExhaustiveComplexVectorView cut,
-           const ExhaustiveConstComplexVectorView ds_de0,
-           const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dDV(const ExhaustiveConstComplexVectorView& cut,
-                            const ExhaustiveConstComplexVectorView ds_dDV,
-                            const ExhaustiveConstComplexVectorView dz_dDV,
-                            const ExhaustiveConstVectorView dz_dDV_fac,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  void dDV(ExhaustiveComplexVectorView cut,
-           const ExhaustiveConstComplexVectorView ds_dDV,
-           const ExhaustiveConstComplexVectorView dz_dDV,
-           const ExhaustiveConstVectorView dz_dDV_fac,
-           const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dD0(const ExhaustiveConstComplexVectorView& cut,
-                            const ExhaustiveConstComplexVectorView ds_dD0,
-                            const ExhaustiveConstComplexVectorView dz_dD0,
-                            const ExhaustiveConstVectorView dz_dD0_fac,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  void dD0(ExhaustiveComplexVectorView cut,
-           const ExhaustiveConstComplexVectorView ds_dD0,
-           const ExhaustiveConstComplexVectorView dz_dD0,
-           const ExhaustiveConstVectorView dz_dD0_fac,
-           const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dG0(const ExhaustiveConstComplexVectorView& cut,
-                            const ExhaustiveConstComplexVectorView dz_dG0,
-                            const Numeric f,
-                            const std::vector<Size>& filter) const;
-
-  void dG0(ExhaustiveComplexVectorView cut,
-           const ExhaustiveConstComplexVectorView dz_dG0,
-           const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dY(const ExhaustiveConstComplexVectorView& cut,
-                           const ExhaustiveConstComplexVectorView ds_dY,
-                           const Numeric f,
-                           const std::vector<Size>& filter) const;
-
-  void dY(ExhaustiveComplexVectorView cut,
-          const ExhaustiveConstComplexVectorView ds_dY,
-          const std::vector<Size>& filter) const;
-
-  [[nodiscard]] Complex dG(const ExhaustiveConstComplexVectorView& cut,
-                           const ExhaustiveConstComplexVectorView ds_dG,
-                           const Numeric f,
-                           const std::vector<Size>& filter) const;
-
-  void dG(ExhaustiveComplexVectorView cut,
-          const ExhaustiveConstComplexVectorView ds_dG,
-          const std::vector<Size>& filter) const;
 };
 
 struct ComputeData {
@@ -387,19 +188,27 @@ struct ComputeData {
   ComplexVector dz{};    //! Size of line shapes
   Vector dz_fac{};       //! Size of line shapes
   ComplexVector ds{};    //! Size of line shapes
-  ComplexVector dcut{};  //! Size of line shapes
 
   Vector scl{};            //! Size of frequency
   Vector dscl{};           //! Size of frequency
   ComplexVector shape{};   //! Size of frequency
-  ComplexVector dshape{};  //! Size of frequency
 
   Propmat npm{};      //! The orientation of the polarization
   Propmat dnpm_du{};  //! The orientation of the polarization
   Propmat dnpm_dv{};  //! The orientation of the polarization
   Propmat dnpm_dw{};  //! The orientation of the polarization
 
-  //! Sizes scl, dscl, shape, dshape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
+  ComplexMatrix jac_ds{};      //! Size of targets times line shapes
+  ComplexMatrix jac_dz{};      //! Size of targets times line shapes
+  Matrix jac_dz_fac{};         //! Size of targets times line shapes
+  ComplexMatrix jac_dcut{};    //! Size of targets times line shapes
+  Matrix jac_dscl{};           //! Size of targets times frequency
+  ComplexMatrix jac_dshape{};  //! Size of targets times frequency
+  std::vector<std::vector<Size>>
+      jac_lines{};  //! The targets of each line shape; size of line shapes
+  Size jac_size{};  //! The number of targets pushed since jac_init
+
+  //! Sizes scl, dscl, shape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
   ComputeData(const ExhaustiveConstVectorView& f_grid,
               const AtmPoint& atm,
               const Vector2& los    = {},
@@ -409,12 +218,11 @@ struct ComputeData {
                      const Vector3& mag,
                      const zeeman::pol pol);
 
-  //! Sizes cut, dcut, dz, ds; sets shape
+  //! Sizes cut, dz, ds; sets shape
   void core_calc(const band_shape& shp,
-                 const band_data& bnd,
                  const ExhaustiveConstVectorView& f_grid);
 
-  //! Sets dshape and dscl and ds and dz
+  //! Sets dscl and ds and dz and dz_fac
   void dt_core_calc(const SpeciesIsotope& spec,
                     const band_shape& shp,
                     const band_data& bnd,
@@ -422,109 +230,118 @@ struct ComputeData {
                     const AtmPoint& atm,
                     const zeeman::pol pol);
 
-  //! Sets dshape and dscl
+  //! Sets dscl and ds and dz and dz_fac
   void df_core_calc(const band_shape& shp,
-                    const band_data& bnd,
                     const ExhaustiveConstVectorView& f_grid,
                     const AtmPoint& atm);
 
-  //! Sets dshape and dz
+  //! Sets ds and dz and dz_fac
   void dmag_u_core_calc(const band_shape& shp,
                         const band_data& bnd,
-                        const ExhaustiveConstVectorView& f_grid,
                         const AtmPoint& atm,
                         const zeeman::pol pol);
 
-  //! Sets dshape and dz
+  //! Sets ds and dz and dz_fac
   void dmag_v_core_calc(const band_shape& shp,
                         const band_data& bnd,
-                        const ExhaustiveConstVectorView& f_grid,
                         const AtmPoint& atm,
                         const zeeman::pol pol);
 
-  //! Sets dshape and dz
+  //! Sets ds and dz and dz_fac
   void dmag_w_core_calc(const band_shape& shp,
                         const band_data& bnd,
-                        const ExhaustiveConstVectorView& f_grid,
                         const AtmPoint& atm,
                         const zeeman::pol pol);
 
-  //! Sets ds and dz and dcut and dshape
+  //! Sets ds and dz and dz_fac
   void dVMR_core_calc(const SpeciesIsotope& spec,
                       const band_shape& shp,
                       const band_data& bnd,
-                      const ExhaustiveConstVectorView& f_grid,
                       const AtmPoint& atm,
                       const zeeman::pol pol,
                       const SpeciesEnum target_spec);
 
   void set_filter(const line_key& key);
 
-  //! Sets dshape and ds and dz and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void df0_core_calc(const SpeciesIsotope& spec,
                      const band_shape& shp,
                      const band_data& bnd,
-                     const ExhaustiveConstVectorView& f_grid,
                      const AtmPoint& atm,
                      const zeeman::pol pol,
                      const line_key& key);
 
-  //! Sets dshape and ds and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void de0_core_calc(const band_shape& shp,
                      const band_data& bnd,
-                     const ExhaustiveConstVectorView& f_grid,
                      const AtmPoint& atm,
                      const line_key& key);
 
-  //! Sets dshape and ds and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void da_core_calc(const band_shape& shp,
                     const band_data& bnd,
-                    const ExhaustiveConstVectorView& f_grid,
                     const line_key& key);
 
-  //! Sets dshape and dz and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void dG0_core_calc(const band_shape& shp,
                      const band_data& bnd,
-                     const ExhaustiveConstVectorView& f_grid,
                      const AtmPoint& atm,
                      const line_key& key);
 
-  //! Sets dshape and dz and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void dD0_core_calc(const band_shape& shp,
                      const band_data& bnd,
-                     const ExhaustiveConstVectorView& f_grid,
                      const AtmPoint& atm,
                      const line_key& key);
 
-  //! Sets dshape and ds and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void dY_core_calc(const SpeciesIsotope& spec,
                     const band_shape& shp,
                     const band_data& bnd,
-                    const ExhaustiveConstVectorView& f_grid,
                     const AtmPoint& atm,
                     const zeeman::pol pol,
                     const line_key& key);
 
-  //! Sets dshape and ds and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void dG_core_calc(const SpeciesIsotope& spec,
                     const band_shape& shp,
                     const band_data& bnd,
-                    const ExhaustiveConstVectorView& f_grid,
                     const AtmPoint& atm,
                     const zeeman::pol pol,
                     const line_key& key);
 
-  //! Sets dshape and dz and dcut and dshape
+  //! Sets filter and ds and dz and dz_fac for the filtered lines
   void dDV_core_calc(const band_shape& shp,
                      const band_data& bnd,
-                     const ExhaustiveConstVectorView& f_grid,
                      const AtmPoint& atm,
                      const line_key& key);
 
+  //! Sizes and zeroes the jac_* data for ntarget targets
+  void jac_init(const Size ntarget, const Size nlines, const Index nf);
+
+  //! Stores ds, dz, dz_fac, and dscl as the next target, for all lines
+  void jac_push();
+
+  //! Stores ds, dz, and dz_fac as the next target, for the filtered lines
+  void jac_push_filtered();
+
+  //! The next target does not depend on the line shape
+  void jac_push_none();
+
+  /*! Sets jac_dcut and jac_dshape for all pushed targets
+
+    All derivatives of a line shape are linear in ds, dz, and dz_fac, so
+    the Faddeeva function and its derivative are evaluated only once per
+    line and frequency, regardless of the number of targets.
+  */
+  void jac_calc(const band_shape& shp,
+                const ExhaustiveConstVectorView& f_grid);
+
   //! Pure debug print, will never be the same
   friend std::ostream& operator<<(std::ostream& os, const ComputeData& cd);
 };
 
+//! Only the lines of the selection are computed, unless it is nullptr
 void calculate(PropmatVectorView pm,
                matpack::matpack_view<Propmat, 2, false, true> dpm,
                ComputeData& com_data,
@@ -532,6 +349,7 @@ void calculate(PropmatVectorView pm,
                const Jacobian::Targets& jacobian_targets,
                const QuantumIdentifier& bnd_qid,
                const band_data& bnd,
+               const band_selection* const selection,
                const AtmPoint& atm,
                const zeeman::pol pol,
                const bool no_negative_absorption);
@@ -190,16 +190,16 @@ struct single_shape_builder {
         G0(ln.ls.single_models[is].G0(ln.ls.T0, atm.temperature, atm.pressure)),
         ispec(is) {}
 
-  [[nodiscard]] single_shape as_zeeman(const Numeric H,
-                                       const zeeman::pol pol,
-                                       const Size iz) const {
-    single_shape s;
-    s.f0                    = f0 + H * ln.z.Splitting(ln.qn.val, pol, iz);
-    s.inv_gd                = 1.0 / (scaled_gd_part * f0);
-    s.z_imag                = G0 * s.inv_gd;
-    const auto [k, e_ratio] = line_strength_calc(s.inv_gd, qid, ln, atm);
-    s.k                     = ln.z.Strength(ln.qn.val, pol, iz) * k;
-    s.e_ratio               = ln.z.Strength(ln.qn.val, pol, iz) * e_ratio;
+  //! A component of a split pattern, from the unsplit shape
+  [[nodiscard]] static single_shape as_zeeman(const single_shape& unsplit,
+                                              const Numeric H,
+                                              const zeeman::model& z,
+                                              const zeeman::split_pattern& zp,
+                                              const Size iz) {
+    single_shape s  = unsplit;
+    s.f0           += H * z.Splitting(zp, iz);
+    s.k            *= zp.strength[iz];
+    s.e_ratio      *= zp.strength[iz];
     return s;
   }
 
@@ -286,41 +286,6 @@ single_shape::zFdF::zFdF(const Complex z_)
     : z{z_}, F{single_shape::F(z_)}, dF{single_shape::dF(z_, F)} {}
 
 single_shape::zFdF single_shape::all(const Numeric f) const { return z(f); }
-std::pair<Complex, Complex> single_shape::dru(const Numeric dk_dru,
-                                              const Numeric de_ratio_dru,
-                                              const Numeric f) const {
-  const auto F_ = F(f);
-  return {dk_dru * F_, de_ratio_dru * F_};
-}
-
-std::pair<Complex, Complex> single_shape::drl(const Numeric dk_drl,
-                                              const Numeric de_ratio_drl,
-                                              const Numeric f) const {
-  const auto F_ = F(f);
-  return {dk_drl * F_, de_ratio_drl * F_};
-}
-
-std::pair<Complex, Complex> single_shape::df(const Numeric f) const {
-  const auto dF_ = inv_gd * dF(f);
-  return {k * dF_, e_ratio * dF_};
-}
-
-std::pair<Complex, Complex> single_shape::dH(const Complex dz_dH,
-                                             const Numeric f) const {
-  const auto dF_ = dz_dH * dF(f);
-  return {k * dF_, e_ratio * dF_};
-}
-
-std::pair<Complex, Complex> single_shape::dT(const Numeric dk_dT,
-                                             const Numeric de_ratio_dT,
-                                             const Complex dz_dT,
-                                             const Numeric dz_dT_fac,
-                                             const Numeric f) const {
-  const auto [z_, F_, dF_] = all(f);
-  return {dk_dT * F_ + k * (dz_dT + dz_dT_fac * z_) * dF_,
-          de_ratio_dT * F_ + e_ratio * (dz_dT + dz_dT_fac * z_) * dF_};
-}
-
 constexpr std::pair<Index, Index> find_offset_and_count_of_frequency_range(
     const std::span<const single_shape> lines, Numeric f, Numeric cutoff) {
   if (cutoff < std::numeric_limits<Numeric>::infinity()) {
@@ -378,10 +343,14 @@ void zeeman_push_back(std::vector<single_shape>& lines,
     lines.emplace_back(s);
     pos.emplace_back(line_pos{.line = iline, .spec = ispec});
   } else {
+    //! The strength of the line is computed once for all its components
+    const single_shape unsplit = s;
+
     const Numeric H = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
-    const auto nz   = static_cast<Size>(line.z.size(line.qn.val, pol));
-    for (Size iz = 0; iz < nz; iz++) {
-      lines.emplace_back(s.as_zeeman(H, pol, iz));
+    const auto& zp  = zeeman::get_split_pattern(line.qn.val, pol);
+    for (Size iz = 0; iz < zp.size(); iz++) {
+      lines.emplace_back(
+          single_shape_builder::as_zeeman(unsplit, H, line.z, zp, iz));
       pos.emplace_back(line_pos{.line = iline, .spec = ispec, .iz = iz});
 
       if (lines.back().k == 0.0 and lines.back().e_ratio == 0.0) {
@@ -483,45 +452,6 @@ std::pair<Complex, Complex> band_shape::operator()(const Numeric f) const {
                                [f](auto& ls) { return ls(f); });
 }
 
-std::pair<Complex, Complex> band_shape::df(const Numeric f) const {
-  return std::transform_reduce(lines.begin(),
-                               lines.end(),
-                               std::pair<Complex, Complex>{},
-                               add_pair,
-                               [f](auto& ls) { return ls.df(f); });
-}
-
-std::pair<Complex, Complex> band_shape::dH(
-    const ExhaustiveConstComplexVectorView& dz_dH, const Numeric f) const {
-  ARTS_ASSERT(static_cast<Size>(dz_dH.size()) == lines.size())
-
-  return std::transform_reduce(lines.begin(),
-                               lines.end(),
-                               dz_dH.begin(),
-                               std::pair<Complex, Complex>{},
-                               add_pair,
-                               [f](auto& ls, auto& d) { return ls.dH(d, f); });
-}
-
-std::pair<Complex, Complex> band_shape::dT(
-    const ExhaustiveConstVectorView& dk_dT,
-    const ExhaustiveConstVectorView& de_ratio_dT,
-    const ExhaustiveConstComplexVectorView& dz_dT,
-    const ExhaustiveConstVectorView& dz_dT_fac,
-    const Numeric f) const {
-  ARTS_ASSERT(dk_dT.size() == dz_dT.size())
-  ARTS_ASSERT(static_cast<Size>(dk_dT.size()) == lines.size())
-
-  std::pair<Complex, Complex> out{};  //! Fixme, use zip in C++ 23...
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    out = add_pair(
-        out, lines[i].dT(dk_dT[i], de_ratio_dT[i], dz_dT[i], dz_dT_fac[i], f));
-  }
-
-  return out;
-}
-
 std::pair<Complex, Complex> band_shape::operator()(const CutViewConst& cut,
                                                    const Numeric f) const {
   const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
@@ -542,92 +472,6 @@ void band_shape::operator()(CutView cut) const {
       [cutoff_freq = cutoff](auto& ls) { return ls(ls.f0 + cutoff_freq); });
 }
 
-std::pair<Complex, Complex> band_shape::df(const CutViewConst& cut,
-                                           const Numeric f) const {
-  const auto [s, cs] = frequency_spans(cutoff, f, lines, cut);
-  return std::transform_reduce(
-      s.begin(),
-      s.end(),
-      cs.begin(),
-      std::pair<Complex, Complex>{},
-      add_pair,
-      [f](auto& ls, auto& c) { return rem_pair(ls.df(f), c); });
-}
-
-void band_shape::df(CutView cut) const {
-  std::transform(
-      lines.begin(),
-      lines.end(),
-      cut.begin(),
-      [cutoff_freq = cutoff](auto& ls) { return ls.df(ls.f0 + cutoff_freq); });
-}
-
-std::pair<Complex, Complex> band_shape::dH(
-    const CutViewConst& cut,
-    const ExhaustiveConstComplexVectorView& dz_dH,
-    const Numeric f) const {
-  ARTS_ASSERT(static_cast<Size>(dz_dH.size()) == lines.size())
-
-  const auto [s, cs, dH] = frequency_spans(cutoff, f, lines, cut, dz_dH);
-
-  std::pair<Complex, Complex> out{};  //! Fixme, use zip in C++ 23...
-  for (Size i = 0; i < s.size(); ++i) {
-    out = add_pair(out, rem_pair(s[i].dH(dH[i], f), cs[i]));
-  }
-
-  return out;
-}
-
-void band_shape::dH(CutView cut,
-                    const ExhaustiveConstComplexVectorView& df0_dH) const {
-  ARTS_ASSERT(static_cast<Size>(df0_dH.size()) == lines.size())
-
-  std::transform(lines.begin(),
-                 lines.end(),
-                 df0_dH.begin(),
-                 cut.begin(),
-                 [cutoff_freq = cutoff](auto& ls, auto& d) {
-                   return ls.dH(d, ls.f0 + cutoff_freq);
-                 });
-}
-
-std::pair<Complex, Complex> band_shape::dT(
-    const CutViewConst& cut,
-    const ExhaustiveConstVectorView& dk_dT,
-    const ExhaustiveConstVectorView& de_ratio_dT,
-    const ExhaustiveConstComplexVectorView& dz_dT,
-    const ExhaustiveConstVectorView& dz_dT_fac,
-    const Numeric f) const {
-  ARTS_ASSERT(dk_dT.size() == dz_dT.size())
-  ARTS_ASSERT(static_cast<Size>(dk_dT.size()) == lines.size())
-
-  std::pair<Complex, Complex> out{};  //! Fixme, use zip in C++ 23...
-
-  const auto [s, cs, dk, de, dz, dzf] = frequency_spans(
-      cutoff, f, lines, cut, dk_dT, de_ratio_dT, dz_dT, dz_dT_fac);
-
-  for (Size i = 0; i < s.size(); ++i) {
-    out =
-        add_pair(out, rem_pair(s[i].dT(dk[i], de[i], dz[i], dzf[i], f), cs[i]));
-  }
-
-  return out;
-}
-
-void band_shape::dT(CutView cut,
-                    const ExhaustiveConstVectorView& dk_dT,
-                    const ExhaustiveConstVectorView& de_ratio_dT,
-                    const ExhaustiveConstComplexVectorView& dz_dT,
-                    const ExhaustiveConstVectorView& dz_dT_fac) const {
-  ARTS_ASSERT(dk_dT.size() == dz_dT.size())
-  ARTS_ASSERT(static_cast<Size>(dk_dT.size()) == lines.size())
-
-  for (Size i = 0; i < lines.size(); ++i) {
-    cut[i] = lines[i].dT(
-        dk_dT[i], de_ratio_dT[i], dz_dT[i], dz_dT_fac[i], lines[i].f0 + cutoff);
-  }
-}
-
 void ComputeData::update_zeeman(const Vector2& los,
                                 const Vector3& mag,
                                 const zeeman::pol pol) {
@@ -645,8 +489,7 @@ ComputeData::ComputeData(const ExhaustiveConstVectorView& f_grid,
                          const zeeman::pol pol)
     : scl(f_grid.size()),
       dscl(f_grid.size()),
-      shape(f_grid.size()),
-      dshape(f_grid.size()) {
+      shape(f_grid.size()) {
   std::transform(f_grid.begin(),
                  f_grid.end(),
                  scl.begin(),
@@ -659,7 +502,7 @@ ComputeData::ComputeData(const ExhaustiveConstVectorView& f_grid,
   update_zeeman(los, atm.mag, pol);
 }
 
-//! Sizes cut, dcut, dz, ds; sets shape
+//! Sizes cut, dz, ds; sets shape
 void ComputeData::core_calc(const band_shape& shp,
                             const band_data& bnd,
                             const ExhaustiveConstVectorView& f_grid) {
@@ -668,7 +511,6 @@ void ComputeData::core_calc(const band_shape& shp,
   dz_fac.resize(shp.size());
   dk.resize(shp.size());
   de_ratio.resize(shp.size());
-  dcut.resize(shp.size());
 
   if (bnd.cutoff != LineByLineCutoffType::None) {
     shp(cut);
@@ -684,7 +526,7 @@ void ComputeData::core_calc(const band_shape& shp,
   }
 }
 
-//! Sets dshape and dscl and ds and dz
+//! Sets dscl and dk and de_ratio and dz and dz_fac
 void ComputeData::dt_core_calc(const QuantumIdentifier& qid,
                                const band_shape& shp,
                                const band_data& bnd,
@@ -733,24 +575,10 @@ void ComputeData::dt_core_calc(const QuantumIdentifier& qid,
                                ls.dG0_dT(line.ls.T0, T, atm.pressure)};
     }
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dT(dcut, dk, de_ratio, dz, dz_fac);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dT(dcut, dk, de_ratio, dz, dz_fac, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dT(dk, de_ratio, dz, dz_fac, f);
-        });
-  }
 }
 
-//! Sets dshape and dscl
+//! Sets dscl and dk and de_ratio and dz and dz_fac
 void ComputeData::df_core_calc(const band_shape& shp,
-                               const band_data& bnd,
                                const ExhaustiveConstVectorView& f_grid,
                                const AtmPoint& atm) {
   std::transform(f_grid.begin(),
@@ -764,24 +592,17 @@ void ComputeData::df_core_calc(const band_shape& shp,
                    return N * (r * std::exp(-r) - std::expm1(-r)) * c;
                  });
 
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.df(dcut);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.df(dcut, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [&shp](Numeric f) {
-          return shp.df(f);
-        });
+  for (Size i = 0; i < pos.size(); i++) {
+    dk[i]       = 0;
+    de_ratio[i] = 0;
+    dz[i]       = shp.lines[i].inv_gd;
+    dz_fac[i]   = 0;
   }
 }
 
-//! Sets dshape and dz
+//! Sets dk and de_ratio and dz and dz_fac
 void ComputeData::dmag_u_core_calc(const band_shape& shp,
                                    const band_data& bnd,
-                                   const ExhaustiveConstVectorView& f_grid,
                                    const AtmPoint& atm,
                                    const zeeman::pol pol) {
   const Numeric H         = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
@@ -789,28 +610,17 @@ void ComputeData::dmag_u_core_calc(const band_shape& shp,
 
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line = bnd.lines[pos[i].line];
+    dk[i]            = 0;
+    de_ratio[i]      = 0;
+    dz_fac[i]        = 0;
     dz[i]            = -shp.lines[pos[i].line].inv_gd * dH_dmag_u *
             line.z.Splitting(line.qn.val, pol, pos[i].iz);
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dH(dcut, dz);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dcut, dz, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dz, f);
-        });
-  }
 }
 
-//! Sets dshape and dz
+//! Sets dk and de_ratio and dz and dz_fac
 void ComputeData::dmag_v_core_calc(const band_shape& shp,
                                    const band_data& bnd,
-                                   const ExhaustiveConstVectorView& f_grid,
                                    const AtmPoint& atm,
                                    const zeeman::pol pol) {
   const Numeric H         = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
@@ -818,28 +628,17 @@ void ComputeData::dmag_v_core_calc(const band_shape& shp,
 
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line = bnd.lines[pos[i].line];
+    dk[i]            = 0;
+    de_ratio[i]      = 0;
+    dz_fac[i]        = 0;
     dz[i]            = -shp.lines[pos[i].line].inv_gd * dH_dmag_v *
             line.z.Splitting(line.qn.val, pol, pos[i].iz);
   }
-
-  if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dH(dcut, dz);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dcut, dz, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dz, f);
-        });
-  }
 }
 
-//! Sets dshape and dz
+//! Sets dk and de_ratio and dz and dz_fac
 void ComputeData::dmag_w_core_calc(const band_shape& shp,
                                    const band_data& bnd,
-                                   const ExhaustiveConstVectorView& f_grid,
                                    const AtmPoint& atm,
                                    const zeeman::pol pol) {
   const Numeric H         = std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
@@ -847,27 +646,97 @@ void ComputeData::dmag_w_core_calc(const band_shape& shp,
 
   for (Size i = 0; i < pos.size(); i++) {
     const auto& line = bnd.lines[pos[i].line];
+    dk[i]            = 0;
+    de_ratio[i]      = 0;
+    dz_fac[i]        = 0;
     dz[i]            = -shp.lines[pos[i].line].inv_gd * dH_dmag_w *
             line.z.Splitting(line.qn.val, pol, pos[i].iz);
   }
+}
+
+void ComputeData::jac_init(const Size ntarget,
+                           const Size nlines,
+                           const Index nf) {
+  jac_dk.resize(ntarget, nlines);
+  jac_de_ratio.resize(ntarget, nlines);
+  jac_dz.resize(ntarget, nlines);
+  jac_dz_fac.resize(ntarget, nlines);
+  jac_dcut.resize(ntarget, nlines);
+  jac_dscl.resize(ntarget, nf);
+  jac_dshape.resize(ntarget, nf);
+
+  jac_dk       = 0.0;
+  jac_de_ratio = 0.0;
+  jac_dz       = 0.0;
+  jac_dz_fac   = 0.0;
+  jac_dcut     = std::pair<Complex, Complex>{};
+  jac_dscl     = 0.0;
+  jac_dshape   = std::pair<Complex, Complex>{};
+  jac_used.assign(ntarget, false);
+  jac_size = 0;
+}
+
+void ComputeData::jac_push() {
+  const Size k = jac_size++;
+
+  jac_dk[k]       = dk;
+  jac_de_ratio[k] = de_ratio;
+  jac_dz[k]       = dz;
+  jac_dz_fac[k]   = dz_fac;
+  jac_dscl[k]     = dscl;
+  jac_used[k]     = true;
+}
+
+void ComputeData::jac_push_none() { jac_size++; }
+
+void ComputeData::jac_calc(const band_shape& shp,
+                           const band_data& bnd,
+                           const ExhaustiveConstVectorView& f_grid) {
+  //! All derivatives of a line shape are linear in dk, de_ratio, dz, and dz_fac
+  const auto derivative = [this](const single_shape& lshp,
+                                 const Size k,
+                                 const Size i,
+                                 const Complex z_,
+                                 const Complex F_,
+                                 const Complex dF_) {
+    const Complex dzdF = (jac_dz(k, i) + jac_dz_fac(k, i) * z_) * dF_;
+    return std::pair<Complex, Complex>{
+        jac_dk(k, i) * F_ + lshp.k * dzdF,
+        jac_de_ratio(k, i) * F_ + lshp.e_ratio * dzdF};
+  };
 
   if (bnd.cutoff != LineByLineCutoffType::None) {
-    shp.dH(dcut, dz);
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dcut, dz, f);
-        });
-  } else {
-    std::transform(
-        f_grid.begin(), f_grid.end(), dshape.begin(), [this, &shp](Numeric f) {
-          return shp.dH(dz, f);
-        });
+    for (Size i = 0; i < shp.size(); i++) {
+      const auto& lshp         = shp.lines[i];
+      const auto [z_, F_, dF_] = lshp.all(lshp.f0 + shp.cutoff);
+      for (Size k = 0; k < jac_size; k++) {
+        if (jac_used[k]) jac_dcut(k, i) = derivative(lshp, k, i, z_, F_, dF_);
+      }
+    }
+  }
+
+  //! One evaluation of the Faddeeva function per line and frequency for all targets
+  for (Index iv = 0; iv < f_grid.size(); iv++) {
+    const Numeric f = f_grid[iv];
+
+    const auto [start, count] =
+        find_offset_and_count_of_frequency_range(shp.lines, f, shp.cutoff);
+
+    for (Index i = start; i < start + count; i++) {
+      const auto& lshp         = shp.lines[i];
+      const auto [z_, F_, dF_] = lshp.all(f);
+      for (Size k = 0; k < jac_size; k++) {
+        if (not jac_used[k]) continue;
+        jac_dshape(k, iv) =
+            add_pair(jac_dshape(k, iv),
+                     rem_pair(derivative(lshp, k, i, z_, F_, dF_),
+                              jac_dcut(k, i)));
+      }
+    }
   }
 }
 
-void compute_derivative(PropmatVectorView dpm,
-                        StokvecVectorView dsv,
-                        ComputeData& com_data,
+void prepare_derivative(ComputeData& com_data,
                         const ExhaustiveConstVectorView& f_grid,
                         const QuantumIdentifier& qid,
                         const band_shape& shape,
@@ -879,77 +748,108 @@ void compute_derivative(PropmatVectorView dpm,
   switch (key) {
     case t:
       com_data.dt_core_calc(qid, shape, bnd, f_grid, atm, pol);
+      break;
+    case p:
+      ARTS_USER_ERROR("Not implemented, pressure derivative");
+      break;
+    case mag_u:
+      com_data.dmag_u_core_calc(shape, bnd, atm, pol);
+      break;
+    case mag_v:
+      com_data.dmag_v_core_calc(shape, bnd, atm, pol);
+      break;
+    case mag_w:
+      com_data.dmag_w_core_calc(shape, bnd, atm, pol);
+      break;
+    case wind_u:
+    case wind_v:
+    case wind_w:
+      com_data.df_core_calc(shape, f_grid, atm);
+      break;
+  }
+
+  com_data.jac_push();
+}
+
+//! Isotopologue ratio, VMR and line parameter derivatives are zero for non-LTE
+void prepare_derivative(ComputeData& com_data,
+                        const ExhaustiveConstVectorView&,
+                        const QuantumIdentifier&,
+                        const band_shape&,
+                        const band_data&,
+                        const AtmPoint&,
+                        const zeeman::pol,
+                        const auto&) {
+  com_data.jac_push_none();
+}
+
+void compute_derivative(PropmatVectorView dpm,
+                        StokvecVectorView dsv,
+                        const ComputeData& com_data,
+                        const Size k,
+                        const ExhaustiveConstVectorView& f_grid,
+                        const AtmKey& key) {
+  const auto dscl   = com_data.jac_dscl[k];
+  const auto dshape = com_data.jac_dshape[k];
+
+  using enum AtmKey;
+  switch (key) {
+    case t:
+    case wind_u:
+    case wind_v:
+    case wind_w:
       for (Index i = 0; i < f_grid.size(); i++) {
         dpm[i] += zeeman::scale(com_data.npm,
-                                com_data.dscl[i] * com_data.shape[i].first +
-                                    com_data.scl[i] * com_data.dshape[i].first);
+                                dscl[i] * com_data.shape[i].first +
+                                    com_data.scl[i] * dshape[i].first);
         const auto dsv_pm =
             zeeman::scale(com_data.npm,
-                          com_data.dscl[i] * com_data.shape[i].second +
-                              com_data.scl[i] * com_data.dshape[i].second);
+                          dscl[i] * com_data.shape[i].second +
+                              com_data.scl[i] * dshape[i].second);
         dsv[i] += {dsv_pm.A(), dsv_pm.B(), dsv_pm.C(), dsv_pm.D()};
       }
       break;
     case p:
-      ARTS_USER_ERROR("Not implemented, pressure derivative");
       break;
     case mag_u:
-      com_data.dmag_u_core_calc(shape, bnd, f_grid, atm, pol);
       for (Index i = 0; i < f_grid.size(); i++) {
         dpm[i] += zeeman::scale(com_data.npm,
                                 com_data.dnpm_du,
                                 com_data.scl[i] * com_data.shape[i].first,
-                                com_data.scl[i] * com_data.dshape[i].first);
+                                com_data.scl[i] * dshape[i].first);
         const auto dsv_pm =
             zeeman::scale(com_data.npm,
                           com_data.dnpm_du,
                           com_data.scl[i] * com_data.shape[i].second,
-                          com_data.scl[i] * com_data.dshape[i].second);
+                          com_data.scl[i] * dshape[i].second);
         dsv[i] += {dsv_pm.A(), dsv_pm.B(), dsv_pm.C(), dsv_pm.D()};
       }
       break;
     case mag_v:
-      com_data.dmag_v_core_calc(shape, bnd, f_grid, atm, pol);
       for (Index i = 0; i < f_grid.size(); i++) {
         dpm[i] += zeeman::scale(com_data.npm,
                                 com_data.dnpm_dv,
                                 com_data.scl[i] * com_data.shape[i].first,
-                                com_data.scl[i] * com_data.dshape[i].first);
+                                com_data.scl[i] * dshape[i].first);
         const auto dsv_pm =
             zeeman::scale(com_data.npm,
                           com_data.dnpm_dv,
                           com_data.scl[i] * com_data.shape[i].second,
-                          com_data.scl[i] * com_data.dshape[i].second);
+                          com_data.scl[i] * dshape[i].second);
         dsv[i] += {dsv_pm.A(), dsv_pm.B(), dsv_pm.C(), dsv_pm.D()};
       }
       break;
     case mag_w:
-      com_data.dmag_w_core_calc(shape, bnd, f_grid, atm, pol);
       for (Index i = 0; i < f_grid.size(); i++) {
         dpm[i] += zeeman::scale(com_data.npm,
                                 com_data.dnpm_dw,
                                 com_data.scl[i] * com_data.shape[i].first,
-                                com_data.scl[i] * com_data.dshape[i].first);
+                                com_data.scl[i] * dshape[i].first);
         const auto dsv_pm =
             zeeman::scale(com_data.npm,
                           com_data.dnpm_dw,
                           com_data.scl[i] * com_data.shape[i].second,
-                          com_data.scl[i] * com_data.dshape[i].second);
-        dsv[i] += {dsv_pm.A(), dsv_pm.B(), dsv_pm.C(), dsv_pm.D()};
-      }
-      break;
-    case wind_u:
-    case wind_v:
-    case wind_w:
-      com_data.df_core_calc(shape, bnd, f_grid, atm);
-      for (Index i = 0; i < f_grid.size(); i++) {
-        dpm[i] += zeeman::scale(com_data.npm,
-                                com_data.dscl[i] * com_data.shape[i].first +
-                                    com_data.scl[i] * com_data.dshape[i].first);
-        const auto dsv_pm =
-            zeeman::scale(com_data.npm,
-                          com_data.dscl[i] * com_data.shape[i].second +
-                              com_data.scl[i] * com_data.dshape[i].second);
+                          com_data.scl[i] * dshape[i].second);
         dsv[i] += {dsv_pm.A(), dsv_pm.B(), dsv_pm.C(), dsv_pm.D()};
       }
       break;
@@ -958,52 +858,9 @@ void compute_derivative(PropmatVectorView dpm,
 
 void compute_derivative(PropmatVectorView,
                         StokvecVectorView,
-                        ComputeData&,
-                        const ExhaustiveConstVectorView&,
-                        const QuantumIdentifier& qid,
-                        const band_shape&,
-                        const band_data&,
-                        const AtmPoint&,
-                        const zeeman::pol,
-                        const SpeciesIsotope& deriv_spec) {
-  ARTS_USER_ERROR_IF(deriv_spec == qid.Isotopologue(), "Not supported")
-}
-
-void compute_derivative(PropmatVectorView,
-                        StokvecVectorView,
-                        ComputeData&,
-                        const ExhaustiveConstVectorView&,
-                        const QuantumIdentifier&,
-                        const band_shape&,
-                        const band_data&,
-                        const AtmPoint&,
-                        const zeeman::pol,
-                        const SpeciesEnum&) {
-  ARTS_USER_ERROR("Not supported")
-}
-
-void compute_derivative(PropmatVectorView,
-                        StokvecVectorView,
-                        ComputeData&,
+                        const ComputeData&,
+                        const Size,
                         const ExhaustiveConstVectorView&,
-                        const QuantumIdentifier&,
-                        const band_shape&,
-                        const band_data&,
-                        const AtmPoint&,
-                        const zeeman::pol,
-                        const line_key&) {
-  ARTS_USER_ERROR("Not supported")
-}
-
-void compute_derivative(PropmatVectorView,
-                        StokvecVectorView,
-                        ComputeData&,
-                        const ExhaustiveConstVectorView&,
-                        const SpeciesIsotope&,
-                        const band_shape&,
-                        const band_data&,
-                        const AtmPoint&,
-                        const zeeman::pol,
                         const auto&) {}
 
 std::ostream& operator<<(std::ostream& os, const ComputeData& cd) {
@@ -1033,9 +890,8 @@ void calculate(PropmatVectorView pm,
   const Index nf = f_grid.size();
   if (nf == 0) return;
 
-  const SpeciesIsotope spec = bnd_qid.Isotopologue();
-  const Numeric fmin        = f_grid.front();
-  const Numeric fmax        = f_grid.back();
+  const Numeric fmin = f_grid.front();
+  const Numeric fmax = f_grid.back();
 
   ARTS_ASSERT(jacobian_targets.target_count() ==
                   static_cast<Size>(dpm.nrows()) and
@@ -1063,35 +919,47 @@ void calculate(PropmatVectorView pm,
     sv[i]             += {srcvec.A(), srcvec.B(), srcvec.C(), srcvec.D()};
   }
 
-  for (auto& atm_target : jacobian_targets.atm()) {
-    std::visit(
-        [&](auto& target) {
-          compute_derivative(dpm.as_slice(atm_target.target_pos),
-                             dsv.as_slice(atm_target.target_pos),
-                             com_data,
-                             f_grid,
-                             spec,
-                             shape,
-                             bnd,
-                             atm,
-                             pol,
-                             target);
-        },
-        atm_target.type);
-  }
+  const Size njac =
+      jacobian_targets.atm().size() +
+      std::ranges::count_if(jacobian_targets.line(), [&bnd_qid](auto& target) {
+        return target.type.band == bnd_qid;
+      });
 
-  for (auto& line_target : jacobian_targets.line()) {
-    if (line_target.type.band == bnd_qid) {
-      compute_derivative(dpm.as_slice(line_target.target_pos),
-                         dsv.as_slice(line_target.target_pos),
-                         com_data,
-                         f_grid,
-                         spec,
-                         shape,
-                         bnd,
-                         atm,
-                         pol,
-                         line_target.type);
+  if (njac > 0) {
+    com_data.jac_init(njac, shape.size(), nf);
+
+    for (auto& atm_target : jacobian_targets.atm()) {
+      std::visit(
+          [&](auto& target) {
+            prepare_derivative(
+                com_data, f_grid, bnd_qid, shape, bnd, atm, pol, target);
+          },
+          atm_target.type);
+    }
+
+    for (auto& line_target : jacobian_targets.line()) {
+      if (line_target.type.band == bnd_qid) {
+        prepare_derivative(
+            com_data, f_grid, bnd_qid, shape, bnd, atm, pol, line_target.type);
+      }
+    }
+
+    com_data.jac_calc(shape, bnd, f_grid);
+
+    Size k = 0;
+
+    for (auto& atm_target : jacobian_targets.atm()) {
+      std::visit(
+          [&](auto& target) {
+            compute_derivative(dpm.as_slice(atm_target.target_pos),
+                               dsv.as_slice(atm_target.target_pos),
+                               com_data,
+                               k,
+                               f_grid,
+                               target);
+          },
+          atm_target.type);
+      k++;
     }
   }
 
@@ -62,33 +62,13 @@ struct single_shape {
 
   [[nodiscard]] Complex dF(const Numeric f) const;
 
- private:
   struct zFdF {
     Complex z, F, dF;
     zFdF(const Complex z_);
   };
 
+  //! The argument, the Faddeeva function, and its derivative at a frequency
   [[nodiscard]] zFdF all(const Numeric f) const;
-
- public:
-  [[nodiscard]] std::pair<Complex, Complex> dru(const Numeric dk_dru,
-                                                const Numeric de_ratio_dru,
-                                                const Numeric f) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> drl(const Numeric dk_drl,
-                                                const Numeric de_ratio_drl,
-                                                const Numeric f) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> df(const Numeric f) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> dH(const Complex dz_dH,
-                                               const Numeric f) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> dT(const Numeric dk_dT,
-                                               const Numeric de_ratio_dT,
-                                               const Complex dz_dT,
-                                               const Numeric dz_dT_fac,
-                                               const Numeric f) const;
 };
 
 //! A band shape is a collection of single shapes.  The shapes are sorted by frequency.
@@ -105,18 +85,6 @@ struct band_shape {
 
   [[nodiscard]] std::pair<Complex, Complex> operator()(const Numeric f) const;
 
-  [[nodiscard]] std::pair<Complex, Complex> df(const Numeric f) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> dH(
-      const ExhaustiveConstComplexVectorView& dz_dH, const Numeric f) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> dT(
-      const ExhaustiveConstVectorView& dk_dT,
-      const ExhaustiveConstVectorView& de_ratio_dT,
-      const ExhaustiveConstComplexVectorView& dz_dT,
-      const ExhaustiveConstVectorView& dz_dT_fac,
-      const Numeric f) const;
-
   using CutView =
       matpack::matpack_view<std::pair<Complex, Complex>, 1, false, false>;
   using CutViewConst =
@@ -126,32 +94,6 @@ struct band_shape {
                                                        const Numeric f) const;
 
   void operator()(CutView cut) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> df(const CutViewConst& cut,
-                                               const Numeric f) const;
-
-  void df(CutView cut) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> dH(
-      const CutViewConst& cut,
-      const ExhaustiveConstComplexVectorView& dz_dH,
-      const Numeric f) const;
-
-  void dH(CutView cut, const ExhaustiveConstComplexVectorView& df0_dH) const;
-
-  [[nodiscard]] std::pair<Complex, Complex> dT(
-      const CutViewConst& cut,
-      const ExhaustiveConstVectorView& dk_dT,
-      const ExhaustiveConstVectorView& de_ratio_dT,
-      const ExhaustiveConstComplexVectorView& dz_dT,
-      const ExhaustiveConstVectorView& dz_dT_fac,
-      const Numeric f) const;
-
-  void dT(CutView cut,
-          const ExhaustiveConstVectorView& dk_dT,
-          const ExhaustiveConstVectorView& de_ratio_dT,
-          const ExhaustiveConstComplexVectorView& dz_dT,
-          const ExhaustiveConstVectorView& dz_dT_fac) const;
 };
 
 void band_shape_helper(std::vector<single_shape>& lines,
@@ -175,19 +117,29 @@ struct ComputeData {
   Vector dz_fac{};     //! Size of line shapes
   Vector dk{};         //! Size of line shapes
   Vector de_ratio{};   //! Size of line shapes
-  PairDataC dcut{};    //! Size of line shapes
 
   Vector scl{};        //! Size of frequency
   Vector dscl{};       //! Size of frequency
   PairDataC shape{};   //! Size of frequency
-  PairDataC dshape{};  //! Size of frequency
 
   Propmat npm{};      //! The orientation of the polarization
   Propmat dnpm_du{};  //! The orientation of the polarization
   Propmat dnpm_dv{};  //! The orientation of the polarization
   Propmat dnpm_dw{};  //! The orientation of the polarization
 
-  //! Sizes scl, dscl, shape, dshape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
+  using PairMatrixC = matpack::matpack_data<std::pair<Complex, Complex>, 2>;
+
+  Matrix jac_dk{};             //! Size of targets times line shapes
+  Matrix jac_de_ratio{};       //! Size of targets times line shapes
+  ComplexMatrix jac_dz{};      //! Size of targets times line shapes
+  Matrix jac_dz_fac{};         //! Size of targets times line shapes
+  PairMatrixC jac_dcut{};      //! Size of targets times line shapes
+  Matrix jac_dscl{};           //! Size of targets times frequency
+  PairMatrixC jac_dshape{};    //! Size of targets times frequency
+  std::vector<bool> jac_used{};  //! Size of targets
+  Size jac_size{};             //! The number of targets pushed since jac_init
+
+  //! Sizes scl, dscl, shape.  Sets scl, npm, dnpm_du, dnpm_dv, dnpm_dw
   ComputeData(const ExhaustiveConstVectorView& f_grid,
               const AtmPoint& atm,
               const Vector2& los    = {},
@@ -197,12 +149,12 @@ struct ComputeData {
                      const Vector3& mag,
                      const zeeman::pol pol);
 
-  //! Sizes cut, dcut, dz, ds; sets shape
+  //! Sizes cut, dz, ds; sets shape
   void core_calc(const band_shape& shp,
                  const band_data& bnd,
                  const ExhaustiveConstVectorView& f_grid);
 
-  //! Sets dshape and dscl and ds and dz
+  //! Sets dscl and dk and de_ratio and dz and dz_fac
   void dt_core_calc(const QuantumIdentifier& qid,
                     const band_shape& shp,
                     const band_data& bnd,
@@ -210,33 +162,48 @@ struct ComputeData {
                     const AtmPoint& atm,
                     const zeeman::pol pol);
 
-  //! Sets dshape and dscl
+  //! Sets dscl and dk and de_ratio and dz and dz_fac
   void df_core_calc(const band_shape& shp,
-                    const band_data& bnd,
                     const ExhaustiveConstVectorView& f_grid,
                     const AtmPoint& atm);
 
-  //! Sets dshape and dz
+  //! Sets dk and de_ratio and dz and dz_fac
   void dmag_u_core_calc(const band_shape& shp,
                         const band_data& bnd,
-                        const ExhaustiveConstVectorView& f_grid,
                         const AtmPoint& atm,
                         const zeeman::pol pol);
 
-  //! Sets dshape and dz
+  //! Sets dk and de_ratio and dz and dz_fac
   void dmag_v_core_calc(const band_shape& shp,
                         const band_data& bnd,
-                        const ExhaustiveConstVectorView& f_grid,
                         const AtmPoint& atm,
                         const zeeman::pol pol);
 
-  //! Sets dshape and dz
+  //! Sets dk and de_ratio and dz and dz_fac
   void dmag_w_core_calc(const band_shape& shp,
                         const band_data& bnd,
-                        const ExhaustiveConstVectorView& f_grid,
                         const AtmPoint& atm,
                         const zeeman::pol pol);
 
+  //! Sizes and zeroes the jac_* data for ntarget targets
+  void jac_init(const Size ntarget, const Size nlines, const Index nf);
+
+  //! Stores dk, de_ratio, dz, dz_fac, and dscl as the next target
+  void jac_push();
+
+  //! The next target does not depend on the line shape
+  void jac_push_none();
+
+  /*! Sets jac_dcut and jac_dshape for all pushed targets
+
+    All derivatives of a line shape are linear in dk, de_ratio, dz, and
+    dz_fac, so the Faddeeva function and its derivative are evaluated only
+    once per line and frequency, regardless of the number of targets.
+  */
+  void jac_calc(const band_shape& shp,
+                const band_data& bnd,
+                const ExhaustiveConstVectorView& f_grid);
+
   //! Pure debug print, will never be the same
   friend std::ostream& operator<<(std::ostream& os, const ComputeData& cd);
 };
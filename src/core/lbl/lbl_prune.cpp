@@ -0,0 +1,195 @@
+#include "lbl_prune.h"
+
+#include <arts_constants.h>
+#include <arts_constexpr_math.h>
+#include <partfun.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "debug.h"
+
+namespace lbl {
+namespace {
+//! Only these lineshapes have lines that are independent of each other
+bool can_prune(const band_data& bnd) {
+  switch (bnd.lineshape) {
+    case LineByLineLineshape::VP_LTE:
+    case LineByLineLineshape::VP_LTE_MIRROR:
+      return true;
+    case LineByLineLineshape::VP_LINE_NLTE:
+    case LineByLineLineshape::VP_ECS_MAKAROV:
+    case LineByLineLineshape::VP_ECS_HARTMANN:
+      return false;
+  }
+  return false;
+}
+
+//! Rough estimate of the absorption of a line, not a strict bound
+struct line_estimate {
+  //! Line strength with the frequency factor and the number of absorbers
+  Numeric s;
+
+  //! Pressure broadening half width
+  Numeric gl;
+
+  //! Doppler width (missing a sqrt(ln2) to be the half width)
+  Numeric gd;
+
+  line_estimate(const SpeciesIsotope& spec,
+                const line& line,
+                const AtmPoint& atm)
+      : gl(line.ls.G0(atm)) {
+    constexpr auto c = Constant::doppler_broadening_const_squared;
+    const Numeric T  = atm.temperature;
+
+    gd = std::sqrt(c * T / spec.mass) * line.f0;
+    s  = atm[spec] * atm[spec.spec] *
+        line.s(T, PartitionFunctions::Q(T, spec)) * line.f0 *
+        -std::expm1(-Constant::h * line.f0 / (Constant::k * T));
+  }
+
+  //! At distance d from the line center
+  [[nodiscard]] Numeric operator()(const Numeric d) const {
+    const Numeric peak =
+        std::min(Constant::inv_pi / gl, Constant::inv_sqrt_pi / gd);
+    if (d == 0.0) return s * peak;
+
+    const Numeric wing =
+        Constant::inv_pi * gl / Math::pow2(d) +
+        Constant::inv_sqrt_pi / gd * std::exp(-Math::pow2(d / gd));
+    return s * std::min(peak, wing);
+  }
+
+  //! The distance from the line center beyond which the line is below eps
+  [[nodiscard]] Numeric window(const Numeric eps) const {
+    //! Each of the two wings gets half of eps
+    const Numeric x  = 2.0 * s / eps;
+    const Numeric dl = std::sqrt(Constant::inv_pi * gl * x);
+    const Numeric y  = Constant::inv_sqrt_pi * x / gd;
+    const Numeric dg = y > 1.0 ? gd * std::sqrt(std::log(y)) : 0.0;
+    return std::max(dl, dg);
+  }
+};
+
+//! The distance from f to the range [fmin, fmax]
+Numeric distance(const Numeric f, const Numeric fmin, const Numeric fmax) {
+  return f < fmin ? fmin - f : f > fmax ? f - fmax : 0.0;
+}
+
+struct line_ref {
+  Size iband;
+  Size iline;
+  Numeric value;
+};
+}  // namespace
+
+prune_report prune(std::vector<band_selection>& out,
+                   const std::span<const band>& bnds,
+                   const SpeciesEnum species,
+                   const AtmPoint& atm,
+                   const Numeric fmin,
+                   const Numeric fmax,
+                   const Numeric rel_err) {
+  ARTS_USER_ERROR_IF(rel_err < 0.0 or rel_err >= 1.0,
+                     "The relative error must be in [0, 1), got {}",
+                     rel_err)
+  ARTS_USER_ERROR_IF(fmin > fmax,
+                     "The frequency range [{}, {}] is empty",
+                     fmin,
+                     fmax)
+
+  out.assign(bnds.size(), band_selection{});
+  prune_report report;
+
+  const auto use = [species](const band& bnd) {
+    return species == SpeciesEnum::Bath or species == bnd.key.Species();
+  };
+
+  //! The estimates of all lines that can be pruned
+  std::vector<std::vector<line_estimate>> estimates(bnds.size());
+  std::vector<line_ref> refs;
+  Numeric ref = 0.0;
+  for (Size iband = 0; iband < bnds.size(); iband++) {
+    const auto& [key, bnd] = bnds[iband];
+    if (not use(bnds[iband])) continue;
+
+    report.nlines += bnd.size();
+    if (not can_prune(bnd) or rel_err == 0.0) continue;
+
+    const SpeciesIsotope spec = key.Isotopologue();
+    auto& est                 = estimates[iband];
+    est.reserve(bnd.size());
+    for (Size iline = 0; iline < bnd.size(); iline++) {
+      const auto& line = bnd.lines[iline];
+      const auto& e    = est.emplace_back(spec, line, atm);
+      const Numeric x  = e(distance(line.f0, fmin, fmax));
+      refs.push_back({.iband = iband, .iline = iline, .value = x});
+      ref = std::max(ref, x);
+    }
+  }
+
+  //! Skip the weakest lines for as long as they fit in half the budget
+  const Numeric budget = rel_err * ref;
+  std::vector<std::vector<char>> skip(bnds.size());
+  for (Size iband = 0; iband < bnds.size(); iband++) {
+    skip[iband].resize(estimates[iband].size(), 0);
+  }
+
+  std::ranges::sort(refs, {}, &line_ref::value);
+  Numeric skipped = 0.0;
+  Size nskipped   = 0;
+  for (auto& r : refs) {
+    if (skipped + r.value > 0.5 * budget) break;
+    skipped                += r.value;
+    skip[r.iband][r.iline]  = 1;
+    nskipped++;
+  }
+
+  //! The rest of the budget is shared by the kept lines for their windows
+  const Size nprunable = refs.size() - nskipped;
+  const Numeric eps =
+      nprunable > 0 ? 0.5 * budget / static_cast<Numeric>(nprunable) : 0.0;
+
+  for (Size iband = 0; iband < bnds.size(); iband++) {
+    const auto& bnd = bnds[iband];
+    if (not use(bnd)) continue;
+
+    if (not can_prune(bnd.data)) {
+      report.nkept += bnd.data.size();
+      continue;
+    }
+
+    band_selection& x = out[iband];
+    x.lines.reserve(bnd.data.size());
+
+    //! Without a budget there are no estimates and all lines are kept
+    const auto& skipped_lines = skip[iband];
+
+    Numeric window = 0.0;
+    for (Size iline = 0; iline < bnd.data.size(); iline++) {
+      if (not skipped_lines.empty() and skipped_lines[iline]) continue;
+
+      x.lines.push_back(iline);
+      if (eps > 0.0) {
+        window = std::max(window, estimates[iband][iline].window(eps));
+      }
+    }
+
+    report.nkept += x.lines.size();
+    x.cutoff      = bnd.data.get_cutoff_frequency();
+    if (eps > 0.0 and window < x.cutoff) {
+      x.cutoff          = window;
+      report.nwindowed += x.lines.size();
+    }
+  }
+
+  if (ref > 0.0) {
+    const Numeric windowed = report.nwindowed > 0 ? 0.5 * budget : 0.0;
+    report.error           = (skipped + windowed) / ref;
+  }
+
+  return report;
+}
+}  // namespace lbl
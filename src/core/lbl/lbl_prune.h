@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atm.h>
+
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "lbl_data.h"
+
+namespace lbl {
+//! The lines considered and kept by prune
+struct prune_report {
+  //! The number of lines in the bands of the species
+  Size nlines{0};
+
+  //! The number of lines that are kept and will be evaluated
+  Size nkept{0};
+
+  //! The number of kept lines that are limited to a local window by a cutoff
+  Size nwindowed{0};
+
+  //! The estimated error relative to the strongest line, see prune
+  Numeric error{0};
+};
+
+//! The lines of a band that are kept by prune
+struct band_selection {
+  //! The positions of the kept lines in the band, in ascending order
+  std::vector<Size> lines{};
+
+  //! The cutoff frequency of the kept lines, infinite for no cutoff
+  Numeric cutoff{std::numeric_limits<Numeric>::infinity()};
+};
+
+/*! Prune the lines that are not needed at an atmospheric point
+
+The contribution of each line to the frequency range [fmin, fmax] is
+estimated from its line strength s(T, Q) and the pressure broadening and
+Doppler widths at the atmospheric point.  The peak of the Voigt profile is
+bounded by both the Lorentz and the Gauss peaks, and its wing is estimated
+by the sum of the Lorentz and Gauss wings at the distance of the line center
+to the range.
+
+The error budget is rel_err times the largest estimated contribution of a
+single line.  Half of it is spent on skipping the weakest lines.  The other
+half is shared by the kept lines, each of which is limited to the window
+where its wing is larger than its share.  A band gets the cutoff of the
+widest window of its kept lines, if that is smaller than its own cutoff.
+
+The budget is approximate.  The sum of the Lorentz and Gauss wings is not
+a strict bound of the Voigt wing, and the reference is the estimated peak
+of the strongest line rather than the computed absorption.  The error
+relative to the strongest absorption may thus exceed rel_err by a small
+factor.
+
+The bands are not copied.  Instead, the selection of each band lists the
+positions of the lines to evaluate, so that the bands and their index can
+be reused for every atmospheric point.  Only the VP_LTE and VP_LTE_MIRROR
+lineshapes are pruned.  Other bands and bands of other species get an
+empty selection, as their calculations do not use it.
+
+@param[out] out The selection of each band, same size as bnds
+@param[in] bnds The bands
+@param[in] species Only bands of this species, unless it is SpeciesEnum::Bath
+@param[in] atm The atmospheric point
+@param[in] fmin The lowest frequency of interest
+@param[in] fmax The highest frequency of interest
+@param[in] rel_err The relative error budget, no pruning if 0
+@return The lines considered and kept
+*/
+prune_report prune(std::vector<band_selection>& out,
+                   const std::span<const band>& bnds,
+                   const SpeciesEnum species,
+                   const AtmPoint& atm,
+                   const Numeric fmin,
+                   const Numeric fmax,
+                   const Numeric rel_err);
+}  // namespace lbl
@@ -11,6 +11,9 @@
 
 #include "lbl_zeeman.h"
 
+#include <cstdint>
+#include <unordered_map>
+
 #include "arts_constexpr_math.h"
 #include "debug.h"
 #include "double_imanip.h"
@@ -273,6 +276,45 @@ model::model(const QuantumIdentifier& qid) noexcept {
   *this = m;
 }
 
+const split_pattern& get_split_pattern(Rational Ju, Rational Jl, pol type) {
+  //! Doubled J of both levels and the polarization type in one key
+  const auto key = (static_cast<std::uint64_t>(Ju.toInt(2)) << 32) |
+                   (static_cast<std::uint64_t>(Jl.toInt(2)) << 8) |
+                   static_cast<std::uint64_t>(type);
+
+  thread_local std::unordered_map<std::uint64_t, split_pattern> patterns;
+
+  auto [it, inserted] = patterns.try_emplace(key);
+  auto& zp            = it->second;
+  if (not inserted) return zp;
+
+  try {
+    const auto n = static_cast<Size>(size(Ju, Jl, type));
+    zp.strength.resize(n);
+    zp.mu.resize(n);
+    zp.ml.resize(n);
+
+    const model unit{};
+    for (Size i = 0; i < n; i++) {
+      const auto iz  = static_cast<Index>(i);
+      zp.strength[i] = unit.Strength(Ju, Jl, type, iz);
+      zp.mu[i]       = Mu(Ju, Jl, type, iz).toNumeric();
+      zp.ml[i]       = Ml(Ju, Jl, type, iz).toNumeric();
+    }
+  } catch (...) {
+    patterns.erase(it);
+    throw;
+  }
+
+  return zp;
+}
+
+const split_pattern& get_split_pattern(const QuantumNumberValueList& qn,
+                                       pol type) {
+  const auto& J = qn[QuantumNumberType::J];
+  return get_split_pattern(J.upp(), J.low(), type);
+}
+
 Numeric model::Strength(Rational Ju, Rational Jl, pol type, Index n) const {
   using Math::pow2;
 
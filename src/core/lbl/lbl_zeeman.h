@@ -5,6 +5,7 @@
 #include <rtepack.h>
 
 #include <limits>
+#include <vector>
 
 #include "debug.h"
 
@@ -237,6 +238,49 @@ constexpr Numeric SimpleGCaseA(Rational Omega,
   return GS * T1 + GL * T2;
 }
 
+/** The Zeeman components of a transition
+ * 
+ * These only depend on the J of the levels and the polarization type.
+ * The g-factors and the magnetic field strength scale the splitting.
+ */
+struct split_pattern {
+  /** Relative strength of each component */
+  std::vector<Numeric> strength{};
+
+  /** Upper state M of each component */
+  std::vector<Numeric> mu{};
+
+  /** Lower state M of each component */
+  std::vector<Numeric> ml{};
+
+  [[nodiscard]] Size size() const noexcept { return strength.size(); }
+};
+
+/** Gives the Zeeman components of a transition
+ * 
+ * The pattern is computed the first time it is requested by a thread and
+ * then reused by that thread
+ * 
+ * The user has to ensure that Ju and Jl is a valid transition
+ * 
+ * @param[in] Ju J of the upper state
+ * @param[in] Jl J of the lower state
+ * @param[in] type The polarization type, not pol::no
+ * 
+ * @return The components of the transition
+ */
+const split_pattern &get_split_pattern(Rational Ju, Rational Jl, pol type);
+
+/** Gives the Zeeman components of a transition
+ * 
+ * @param[in] qn The quantum numbers of the transition
+ * @param[in] type The polarization type, not pol::no
+ * 
+ * @return The components of the transition
+ */
+const split_pattern &get_split_pattern(const QuantumNumberValueList &qn,
+                                       pol type);
+
 /** Main storage for Zeeman splitting coefficients
  * 
  * The splitting data has an upper (gu) and lower (gl)
@@ -381,6 +425,24 @@ struct model {
                                   pol type,
                                   Index n) const noexcept;
 
+  /** Gives the splitting of one subline of a split pattern
+   * 
+   * The user has to ensure n is less than the size of the pattern
+   * 
+   * @param[in] zp The split pattern of the transition
+   * @param[in] n The position
+   * 
+   * @return The splitting of the Zeeman subline
+   */
+  [[nodiscard]] constexpr Numeric Splitting(const split_pattern &zp,
+                                            Size n) const noexcept {
+    using Constant::bohr_magneton;
+    using Constant::h;
+    constexpr Numeric C = bohr_magneton / h;
+
+    return C * (zp.ml[n] * gl() - zp.mu[n] * gu());
+  }
+
   /** Gives the number of lines for a given polarization type
    * 
    * @param[in] qn The quantum numbers of the local state
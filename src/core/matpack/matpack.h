@@ -11,6 +11,7 @@
 #include "rational.h"
 
 #include "lin_alg.h"
+#include "matpack_constexpr_lin_alg.h"
 
 #include "logic.h"
 
@@ -0,0 +1,71 @@
+#include "matpack_arena.h"
+
+#include <debug.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace matpack {
+arena::arena(Size min_block_size)
+    : block_size(min_block_size), owner(std::this_thread::get_id()) {}
+
+arena::~arena() {
+  ARTS_ASSERT(live == 0, "{} arena allocations outlive the arena", live)
+}
+
+void* arena::allocate(Size nbytes, Size align) {
+  ARTS_ASSERT(owner == std::this_thread::get_id(),
+              "An arena is used by another thread than its own")
+
+  nbytes = std::max<Size>(nbytes, 1);
+
+  for (; iblock < blocks.size(); iblock++, used = 0) {
+    void* ptr   = blocks[iblock].get() + used;
+    Size nspace = sizes[iblock] - used;
+    if (std::align(align, nbytes, ptr, nspace) != nullptr) {
+      used = sizes[iblock] - nspace + nbytes;
+      live++;
+      counters.nalloc++;
+      return ptr;
+    }
+  }
+
+  // No room in the existing blocks, so get a new one.  It is aligned to
+  // the default new-alignment, so it needs some room for larger alignments.
+  const Size nblock = std::max(block_size, nbytes + align);
+  blocks.emplace_back(new std::byte[nblock]);
+  sizes.push_back(nblock);
+  counters.nblock++;
+  counters.nbytes += nblock;
+
+  used = 0;
+  return allocate(nbytes, align);
+}
+
+void arena::deallocate(void* ptr, Size nbytes) noexcept {
+  ARTS_ASSERT(owner == std::this_thread::get_id(),
+              "An arena is used by another thread than its own")
+  ARTS_ASSERT(live > 0, "Deallocating more than was allocated")
+
+  live--;
+
+  if (live == 0) {
+    iblock = 0;
+    used   = 0;
+    return;
+  }
+
+  // Reuse the memory if it is the latest allocation in the current block
+  nbytes          = std::max<Size>(nbytes, 1);
+  std::byte* last = static_cast<std::byte*>(ptr);
+  std::byte* base = blocks[iblock].get();
+  if (last >= base and last + nbytes == base + used) {
+    used = static_cast<Size>(last - base);
+  }
+}
+
+arena& thread_arena() {
+  thread_local arena out;
+  return out;
+}
+}  // namespace matpack
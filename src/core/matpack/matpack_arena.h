@@ -0,0 +1,180 @@
+#pragma once
+
+#include <configtypes.h>
+
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "matpack_view.h"
+
+namespace matpack {
+//! Counters of the allocations an arena has served
+struct arena_stats {
+  //! The number of allocations served by the arena
+  Size nalloc{0};
+
+  //! The number of memory blocks the arena has requested from the system
+  Size nblock{0};
+
+  //! The total size of the blocks [bytes]
+  Size nbytes{0};
+};
+
+/*! A bump allocator for short-lived scratch_data
+
+Allocations are served from a list of large blocks by moving a pointer
+forward.  Freeing the most recent allocation moves the pointer back, and
+once all allocations are freed the arena is reset to the start of its first
+block.  The blocks themselves are kept until the arena is destroyed, so a
+loop that creates the same scratch containers in every iteration only asks
+the system for memory in its first iteration.
+
+An arena is not thread-safe.  All memory of an arena must be allocated and
+freed by the thread that created it, and before the arena is destroyed.
+*/
+class arena {
+  std::vector<std::unique_ptr<std::byte[]>> blocks;
+  std::vector<Size> sizes;
+
+  //! The minimum size of new blocks
+  Size block_size;
+
+  //! The block that is currently allocated from
+  Size iblock{0};
+
+  //! The used bytes of the current block
+  Size used{0};
+
+  //! The number of allocations not yet freed
+  Size live{0};
+
+  //! The thread that created the arena and is the only one to use it
+  std::thread::id owner;
+
+  arena_stats counters{};
+
+ public:
+  explicit arena(Size min_block_size = 1 << 16);
+  arena(const arena&)            = delete;
+  arena(arena&&)                 = delete;
+  arena& operator=(const arena&) = delete;
+  arena& operator=(arena&&)      = delete;
+  ~arena();
+
+  //! Allocate nbytes aligned to align
+  [[nodiscard]] void* allocate(Size nbytes, Size align);
+
+  //! Free memory from allocate(nbytes, ...)
+  void deallocate(void* ptr, Size nbytes) noexcept;
+
+  //! The number of allocations not yet freed
+  [[nodiscard]] Size nlive() const noexcept { return live; }
+
+  [[nodiscard]] const arena_stats& stats() const noexcept { return counters; }
+};
+
+//! The arena that belongs to the calling thread
+[[nodiscard]] arena& thread_arena();
+
+//! Allocates from an arena
+template <typename T>
+class arena_allocator {
+  template <typename U>
+  friend class arena_allocator;
+
+  arena* pool;
+
+ public:
+  using value_type = T;
+
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap            = std::true_type;
+  using is_always_equal                        = std::false_type;
+
+  constexpr explicit arena_allocator(arena& a) noexcept : pool(&a) {}
+
+  template <typename U>
+  constexpr arena_allocator(const arena_allocator<U>& x) noexcept
+      : pool(x.pool) {}
+
+  [[nodiscard]] T* allocate(std::size_t n) {
+    return static_cast<T*>(pool->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    pool->deallocate(ptr, n * sizeof(T));
+  }
+
+  template <typename U>
+  [[nodiscard]] constexpr bool operator==(
+      const arena_allocator<U>& x) const noexcept {
+    return pool == x.pool;
+  }
+};
+
+/*! Scratch data of a fixed shape, allocated from an arena
+
+This is not a matpack_data, and matpack_data itself still allocates with
+std::allocator.  It is only used for the scratch buffers of
+CIARecord::Extract.  It can neither be copied nor moved, so its memory is
+always freed by the scope and thread that allocated it.  Use its views to
+work with the data.  It must not be static or thread_local, so that it
+never outlives the arena of its thread.
+
+Use it for scratch in hot loops:
+
+@code
+for (...) {
+  matpack::scratch_data<Numeric, 1> tmp(n);  // Served by the thread's arena
+  f(tmp.view());
+}
+@endcode
+*/
+template <typename T, Index N>
+class scratch_data {
+  std::vector<T, arena_allocator<T>> data;
+
+ public:
+  using view_type       = matpack_view<T, N, false, false>;
+  using const_view_type = matpack_view<T, N, true, false>;
+
+ private:
+  view_type mview;
+
+  static constexpr Size mdsize(const std::array<Index, N>& shape) {
+    return static_cast<Size>(std::reduce(
+        shape.begin(), shape.end(), Index{1}, std::multiplies<>()));
+  }
+
+ public:
+  //! Allocate from the arena a
+  scratch_data(arena& a, const std::array<Index, N>& shape, const T& x = T{})
+      : data(mdsize(shape), x, arena_allocator<T>{a}),
+        mview(data.data(), shape) {}
+
+  //! Allocate from the arena of the calling thread
+  explicit scratch_data(const std::array<Index, N>& shape, const T& x = T{})
+      : scratch_data(thread_arena(), shape, x) {}
+
+  //! Allocate from the arena of the calling thread
+  template <integral... inds>
+  explicit scratch_data(inds... sz)
+    requires(sizeof...(inds) == N)
+      : scratch_data(std::array<Index, N>{static_cast<Index>(sz)...}) {}
+
+  scratch_data(const scratch_data&)            = delete;
+  scratch_data(scratch_data&&)                 = delete;
+  scratch_data& operator=(const scratch_data&) = delete;
+  scratch_data& operator=(scratch_data&&)      = delete;
+
+  [[nodiscard]] view_type view() { return mview; }
+  [[nodiscard]] const_view_type view() const { return mview; }
+
+  [[nodiscard]] std::array<Index, N> shape() const { return mview.shape(); }
+};
+}  // namespace matpack
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+#include "matpack_constexpr.h"
+#include "matpack_data.h"
+
+namespace matpack {
+/*! LU decomposition with partial pivoting of a fixed-size matrix, inplace
+
+The decomposition and the row interchanges are as those of Lapack dgetrf,
+but all loops have compile-time bounds so small systems are unrolled.  A
+singular matrix is not checked for, it gives inf or nan in the solution.
+
+@param[in,out] A On input the matrix, on output its LU decomposition
+@param[out] ipiv Row k was interchanged with row ipiv[k]
+*/
+template <Index N>
+constexpr void lu_inplace(matpack_constant_view<Numeric, false, N, N> A,
+                          std::array<Index, N>& ipiv) {
+  for (Index k = 0; k < N; k++) {
+    Index p      = k;
+    Numeric amax = std::abs(A(k, k));
+    for (Index i = k + 1; i < N; i++) {
+      if (const Numeric a = std::abs(A(i, k)); a > amax) {
+        p    = i;
+        amax = a;
+      }
+    }
+
+    ipiv[k] = p;
+    if (p != k) {
+      for (Index j = 0; j < N; j++) std::swap(A(k, j), A(p, j));
+    }
+
+    const Numeric inv = 1.0 / A(k, k);
+    for (Index i = k + 1; i < N; i++) {
+      const Numeric l = (A(i, k) *= inv);
+      for (Index j = k + 1; j < N; j++) A(i, j) -= l * A(k, j);
+    }
+  }
+}
+
+/*! Solves LU x = b by substitution, inplace
+
+@param[in,out] x On input b, on output x
+@param[in] LU The output of lu_inplace
+@param[in] ipiv The output of lu_inplace
+*/
+template <Index N>
+constexpr void lu_solve_inplace(
+    matpack_constant_view<Numeric, false, N> x,
+    const matpack_constant_view<Numeric, true, N, N>& LU,
+    const std::array<Index, N>& ipiv) {
+  for (Index k = 0; k < N; k++) {
+    if (ipiv[k] != k) std::swap(x[k], x[ipiv[k]]);
+  }
+
+  for (Index i = 1; i < N; i++) {
+    for (Index j = 0; j < i; j++) x[i] -= LU(i, j) * x[j];
+  }
+
+  for (Index i = N - 1; i >= 0; i--) {
+    for (Index j = i + 1; j < N; j++) x[i] -= LU(i, j) * x[j];
+    x[i] /= LU(i, i);
+  }
+}
+
+/*! Solves A x = b inplace for a fixed-size system
+
+@param[in,out] x On input b, on output x
+@param[in,out] A On input the matrix, on output its LU decomposition
+*/
+template <Index N>
+constexpr void solve_inplace(matpack_constant_view<Numeric, false, N> x,
+                             matpack_constant_view<Numeric, false, N, N> A) {
+  std::array<Index, N> ipiv;
+  lu_inplace<N>(A, ipiv);
+  lu_solve_inplace<N>(x, A, ipiv);
+}
+
+//! As above
+template <Index N>
+constexpr void solve_inplace(matpack_constant_data<Numeric, N>& x,
+                             matpack_constant_data<Numeric, N, N>& A) {
+  solve_inplace<N>(x.view(), A.view());
+}
+
+/*! Solves A X = B inplace with the fixed-size kernels if the system is small
+
+Selects solve_inplace<N> for the runtime size n of the system at compile
+time, for all N up to max_n.
+
+@param[in,out] X As equation, on input it is B on output is is X
+@param[in,out] A As equation, it is destroyed on output (LU decomposition)
+@return false if the system is larger than max_n and nothing was done
+*/
+template <Index max_n>
+bool solve_inplace_fixed(ExhaustiveVectorView X, ExhaustiveMatrixView A) {
+  static_assert(max_n > 0);
+
+  const Index n = X.size();
+  ARTS_ASSERT(A.nrows() == n and A.ncols() == n)
+
+  if (n == max_n) {
+    using vec_t = matpack_constant_view<Numeric, false, max_n>;
+    using mat_t = matpack_constant_view<Numeric, false, max_n, max_n>;
+    solve_inplace<max_n>(vec_t{typename vec_t::view_type{X.data_handle()}},
+                         mat_t{typename mat_t::view_type{A.data_handle()}});
+    return true;
+  }
+
+  if constexpr (max_n > 1) {
+    if (n < max_n) return solve_inplace_fixed<max_n - 1>(X, A);
+  }
+
+  return false;
+}
+}  // namespace matpack
@@ -12,6 +12,9 @@
 #include <wigxjpf_config.h>
 
 #include <algorithm>
+#include <array>
+#include <cerrno>
+#include <unordered_map>
 
 #include "debug.h"
 
@@ -23,15 +26,88 @@
 #define WIGNER6 wig6jj
 #endif
 
-void arts_wigner_thread_init(int max_two_j [[maybe_unused]]) {
+namespace {
+/*! The temporary arrays of wigxjpf for the current thread
+
+They are kept between symbol evaluations and only reallocated when a
+larger symbol than before is requested.  They are released when the
+thread exits.
+*/
+struct wigner_thread_temp {
+  int max_two_j{-1};
+
+  wigner_thread_temp() = default;
+  wigner_thread_temp(const wigner_thread_temp&) = delete;
+  wigner_thread_temp& operator=(const wigner_thread_temp&) = delete;
+
+  void reserve(int n) {
+    if (n <= max_two_j) return;
+    if (max_two_j >= 0) wig_temp_free();
 #ifdef WIGXJPF_HAVE_THREAD
-  wig_thread_temp_init(max_two_j);
+    wig_thread_temp_init(n);
 #else
-  wig_temp_init(max_two_j);
+    wig_temp_init(n);
 #endif
+    max_two_j = n;
+  }
+
+  void free() {
+    if (max_two_j >= 0) wig_temp_free();
+    max_two_j = -1;
+  }
+
+  ~wigner_thread_temp() { free(); }
+};
+
+thread_local wigner_thread_temp wigner_temp;
+
+//! The doubled arguments of a symbol
+using wigner_key = std::array<int, 6>;
+
+struct wigner_key_hash {
+  std::size_t operator()(const wigner_key& k) const noexcept {
+    std::size_t h = 0;
+    for (int x : k) h = h * 1000003 ^ static_cast<std::size_t>(x);
+    return h;
+  }
+};
+
+/*! Memoized symbols of the current thread
+
+The line mixing and Zeeman calculations evaluate the same few symbols for
+every atmospheric point.  The cache is emptied if it grows too large.
+*/
+struct wigner_cache {
+  static constexpr std::size_t max_size = arts_wigner_cache_size;
+
+  std::unordered_map<wigner_key, Numeric, wigner_key_hash> symbols{};
+
+  template <typename Func>
+  Numeric operator()(const wigner_key& key, Func&& compute) {
+    if (auto it = symbols.find(key); it != symbols.end()) return it->second;
+
+    const Numeric value = compute();
+    if (symbols.size() >= max_size) symbols.clear();
+    symbols.emplace(key, value);
+    return value;
+  }
+};
+
+thread_local wigner_cache wigner3_cache;
+thread_local wigner_cache wigner6_cache;
+}  // namespace
+
+void arts_wigner_thread_init(int max_two_j) { wigner_temp.reserve(max_two_j); }
+
+void arts_wigner_thread_free() {
+  wigner_temp.free();
+  arts_wigner_thread_clear();
 }
 
-void arts_wigner_thread_free() { wig_temp_free(); }
+void arts_wigner_thread_clear() {
+  wigner3_cache.symbols = {};
+  wigner6_cache.symbols = {};
+}
 
 Numeric wigner3j(const Rational j1,
                  const Rational j2,
@@ -39,30 +115,31 @@ Numeric wigner3j(const Rational j1,
                  const Rational m1,
                  const Rational m2,
                  const Rational m3) {
-  errno = 0;
-
   const int a = (2 * j1).toInt(), b = (2 * j2).toInt(), c = (2 * j3).toInt(),
             d = (2 * m1).toInt(), e = (2 * m2).toInt(), f = (2 * m3).toInt();
-  double g;
-  const int j = std::max({std::abs(a),
-                          std::abs(b),
-                          std::abs(c),
-                          std::abs(d),
-                          std::abs(e),
-                          std::abs(f)}) *
-                    3 / 2 +
-                1;
-
-  arts_wigner_thread_init(j);
-  g = WIGNER3(a, b, c, d, e, f);
-  arts_wigner_thread_free();
-
-  if (errno == EDOM) {
+
+  return wigner3_cache({a, b, c, d, e, f}, [&]() {
     errno = 0;
-    ARTS_USER_ERROR("Bad state, perhaps you need to call WignerInit?")
-  }
 
-  return Numeric(g);
+    const int j = std::max({std::abs(a),
+                            std::abs(b),
+                            std::abs(c),
+                            std::abs(d),
+                            std::abs(e),
+                            std::abs(f)}) *
+                      3 / 2 +
+                  1;
+
+    arts_wigner_thread_init(j);
+    const double g = WIGNER3(a, b, c, d, e, f);
+
+    if (errno == EDOM) {
+      errno = 0;
+      ARTS_USER_ERROR("Bad state, perhaps you need to call WignerInit?")
+    }
+
+    return Numeric(g);
+  });
 }
 
 Numeric wigner6j(const Rational j1,
@@ -71,28 +148,29 @@ Numeric wigner6j(const Rational j1,
                  const Rational l1,
                  const Rational l2,
                  const Rational l3) {
-  errno = 0;
-
   const int a = (2 * j1).toInt(), b = (2 * j2).toInt(), c = (2 * j3).toInt(),
             d = (2 * l1).toInt(), e = (2 * l2).toInt(), f = (2 * l3).toInt();
-  double g;
-  const int j = std::max({std::abs(a),
-                          std::abs(b),
-                          std::abs(c),
-                          std::abs(d),
-                          std::abs(e),
-                          std::abs(f)});
-
-  arts_wigner_thread_init(j);
-  g = WIGNER6(a, b, c, d, e, f);
-  arts_wigner_thread_free();
-
-  if (errno == EDOM) {
+
+  return wigner6_cache({a, b, c, d, e, f}, [&]() {
     errno = 0;
-    ARTS_USER_ERROR("Bad state, perhaps you need to call Wigner6Init?")
-  }
 
-  return Numeric(g);
+    const int j = std::max({std::abs(a),
+                            std::abs(b),
+                            std::abs(c),
+                            std::abs(d),
+                            std::abs(e),
+                            std::abs(f)});
+
+    arts_wigner_thread_init(j);
+    const double g = WIGNER6(a, b, c, d, e, f);
+
+    if (errno == EDOM) {
+      errno = 0;
+      ARTS_USER_ERROR("Bad state, perhaps you need to call Wigner6Init?")
+    }
+
+    return Numeric(g);
+  });
 }
 
 std::pair<Rational, Rational> wigner_limits(std::pair<Rational, Rational> a,
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iosfwd>
 
 #include "rational.h"
@@ -24,9 +25,18 @@
 #define DO_FAST_WIGNER 0
 #endif
 
+//! Makes sure the temporary arrays of this thread fit symbols up to max_two_j, they are kept between calls
 void arts_wigner_thread_init(int max_two_j);
+
+//! Releases the temporary arrays and the memoized symbols of this thread early, they are otherwise released at thread exit
 void arts_wigner_thread_free();
 
+//! Number of 3j and of 6j symbols memoized per thread before the memo is emptied
+inline constexpr std::size_t arts_wigner_cache_size = 1 << 14;
+
+//! Releases the memoized 3j and 6j symbols of this thread
+void arts_wigner_thread_clear();
+
 struct WignerInformation {
   static int largest;
   static int fastest;
@@ -145,7 +155,7 @@ constexpr std::pair<Rational, Rational> wigner3j_limits(
 
 /** Wigner 3J symbol
   * 
-  * Run wigxjpf wig3jj for Rational symbol
+  * Run wigxjpf wig3jj for Rational symbol, memoized per thread
   * 
   * /                \
   * |  j1   j2   j3  |
@@ -172,7 +182,7 @@ Numeric wigner3j(const Rational j1,
 
 /** Wigner 6J symbol
   * 
-  * Run wigxjpf wig6jj for Rational symbol
+  * Run wigxjpf wig6jj for Rational symbol, memoized per thread
   *
   * /                \
   * |  j1   j2   j3  |
@@ -0,0 +1,217 @@
+#include "bulk_optical_properties.h"
+
+#include <algorithm>
+
+#include "check_input.h"
+#include "cloudbox.h"
+#include "interpolation.h"
+#include "matpack_math.h"
+
+namespace scattering {
+namespace {
+/** Linear interpolation position in a temperature grid
+ *
+ * Allows the same extrapolation as the legacy ssd_tinterp_parameters,
+ * i.e., half a grid step outside either end of the grid.
+ *
+ * @param t_grid The temperature grid, at least 2 long
+ * @param t The temperature
+ * @param i_elem The element (for error messages)
+ * @return The lower grid index and the fractional distance to the next
+ */
+std::pair<Index, Numeric> temperature_position(const Vector& t_grid,
+                                               const Numeric t,
+                                               const Index i_elem) {
+  const Index nt = t_grid.size();
+
+  const Numeric lowlim = t_grid[0] - 0.5 * (t_grid[1] - t_grid[0]);
+  const Numeric uplim =
+      t_grid[nt - 1] + 0.5 * (t_grid[nt - 1] - t_grid[nt - 2]);
+  ARTS_USER_ERROR_IF(t < lowlim or t > uplim,
+                     "Temperature interpolation error for scattering element "
+                     "{}:\nThe temperature {} K is outside the allowed range "
+                     "[{}, {}] K",
+                     i_elem,
+                     t,
+                     lowlim,
+                     uplim)
+
+  const Index i = std::clamp<Index>(
+      std::distance(t_grid.begin(),
+                    std::upper_bound(t_grid.begin(), t_grid.end(), t)) -
+          1,
+      0,
+      nt - 2);
+  return {i, (t - t_grid[i]) / (t_grid[i + 1] - t_grid[i])};
+}
+}  // namespace
+
+BulkOpticalProperties::BulkOpticalProperties(
+    const ArrayOfSingleScatteringData& ssd, Vector f_grid)
+    : f_grid_(std::move(f_grid)) {
+  ArrayOfVector t_grids;
+  t_grids.reserve(ssd.size());
+  for (auto& s : ssd) t_grids.push_back(s.T_grid);
+  resize(std::move(t_grids));
+
+  for (Size i = 0; i < ssd.size(); i++) {
+    ARTS_USER_ERROR_IF(ssd[i].ptype != PTYPE_TOTAL_RND,
+                       "Scattering element {} is not totally randomly "
+                       "oriented",
+                       i)
+    set_element(static_cast<Index>(i),
+                ssd[i].f_grid,
+                transpose(ssd[i].ext_mat_data(joker, joker, 0, 0, 0)),
+                transpose(ssd[i].abs_vec_data(joker, joker, 0, 0, 0)));
+  }
+}
+
+void BulkOpticalProperties::resize(ArrayOfVector t_grids) {
+  t_grids_ = std::move(t_grids);
+
+  n_temps_max_ = 0;
+  for (auto& t_grid : t_grids_) {
+    ARTS_USER_ERROR_IF(t_grid.empty(), "Empty temperature grid")
+    n_temps_max_ = std::max<Index>(n_temps_max_, t_grid.size());
+  }
+
+  extinction_.resize(n_freqs(), n_weights());
+  absorption_.resize(n_freqs(), n_weights());
+  extinction_ = 0.0;
+  absorption_ = 0.0;
+}
+
+void BulkOpticalProperties::set_element(const Index i_elem,
+                                        const ConstVectorView& data_f_grid,
+                                        const ConstMatrixView& ext,
+                                        const ConstMatrixView& abs) {
+  const Index nt     = ext.nrows();
+  const Index offset = i_elem * n_temps_max_;
+
+  if (data_f_grid.size() == 1) {
+    for (Index iv = 0; iv < n_freqs(); iv++) {
+      for (Index it = 0; it < nt; it++) {
+        extinction_(iv, offset + it) = ext(it, 0);
+        absorption_(iv, offset + it) = abs(it, 0);
+      }
+    }
+    return;
+  }
+
+  chk_interpolation_grids(
+      "Frequency interpolation of bulk optical properties",
+      data_f_grid,
+      f_grid_);
+
+  ArrayOfGridPos gp(n_freqs());
+  gridpos(gp, data_f_grid, f_grid_);
+
+  for (Index iv = 0; iv < n_freqs(); iv++) {
+    const auto& [idx, fd] = gp[iv];
+    for (Index it = 0; it < nt; it++) {
+      extinction_(iv, offset + it) =
+          fd[1] * ext(it, idx) + fd[0] * ext(it, idx + 1);
+      absorption_(iv, offset + it) =
+          fd[1] * abs(it, idx) + fd[0] * abs(it, idx + 1);
+    }
+  }
+}
+
+void BulkOpticalProperties::weights(VectorView w,
+                                    const ConstVectorView& pnd,
+                                    const Numeric t) const {
+  ARTS_USER_ERROR_IF(pnd.size() != n_elements(),
+                     "Got {} number densities for {} scattering elements",
+                     pnd.size(),
+                     n_elements())
+  ARTS_ASSERT(w.size() == n_weights())
+
+  w = 0.0;
+  for (Index i = 0; i < n_elements(); i++) {
+    if (pnd[i] == 0.0) continue;
+
+    const Index offset = i * n_temps_max_;
+    if (t_grids_[i].size() == 1) {
+      w[offset] = pnd[i];
+    } else {
+      const auto [it, fd] = temperature_position(t_grids_[i], t, i);
+      w[offset + it]     = pnd[i] * (1.0 - fd);
+      w[offset + it + 1] = pnd[i] * fd;
+    }
+  }
+}
+
+void BulkOpticalProperties::dweights_dt(VectorView dw,
+                                        const ConstVectorView& pnd,
+                                        const Numeric t) const {
+  ARTS_USER_ERROR_IF(pnd.size() != n_elements(),
+                     "Got {} number densities for {} scattering elements",
+                     pnd.size(),
+                     n_elements())
+  ARTS_ASSERT(dw.size() == n_weights())
+
+  dw = 0.0;
+  for (Index i = 0; i < n_elements(); i++) {
+    if (pnd[i] == 0.0 or t_grids_[i].size() == 1) continue;
+
+    const Index offset = i * n_temps_max_;
+    const auto& t_grid = t_grids_[i];
+    const Index it     = temperature_position(t_grid, t, i).first;
+    const Numeric d    = pnd[i] / (t_grid[it + 1] - t_grid[it]);
+    dw[offset + it]     = -d;
+    dw[offset + it + 1] = d;
+  }
+}
+
+void BulkOpticalProperties::contract(VectorView ext,
+                                     VectorView abs,
+                                     const ConstVectorView& w) const {
+  ARTS_ASSERT(ext.size() == n_freqs())
+  ARTS_ASSERT(abs.size() == n_freqs())
+  ARTS_ASSERT(w.size() == n_weights())
+
+  mult(ext, extinction_, w);
+  mult(abs, absorption_, w);
+}
+
+void BulkOpticalProperties::compute(VectorView ext,
+                                    VectorView abs,
+                                    const ConstVectorView& pnd,
+                                    const Numeric t) const {
+  Vector w(n_weights());
+  weights(w, pnd, t);
+  contract(ext, abs, w);
+}
+
+void BulkOpticalProperties::compute(VectorView ext,
+                                    VectorView abs,
+                                    const PSD& psd,
+                                    const AtmPoint& atm_point,
+                                    const Vector& sizes,
+                                    const Numeric a,
+                                    const Numeric b) const {
+  compute(ext,
+          abs,
+          pnd_from_psd(psd, atm_point, sizes, a, b),
+          atm_point.temperature);
+}
+
+Vector pnd_from_psd(const PSD& psd,
+                    const AtmPoint& atm_point,
+                    const Vector& sizes,
+                    const Numeric a,
+                    const Numeric b) {
+  ARTS_USER_ERROR_IF(sizes.size() < 2,
+                     "Need at least two particle sizes to integrate a PSD")
+  ARTS_USER_ERROR_IF(not is_increasing(sizes),
+                     "The particle sizes must be strictly increasing")
+
+  Vector pnd = std::visit(
+      [&](auto& p) { return p.evaluate(atm_point, sizes, a, b); }, psd);
+
+  Vector bin_widths(sizes.size());
+  bin_quadweights(bin_widths, sizes);
+  for (Index i = 0; i < pnd.size(); i++) pnd[i] *= bin_widths[i];
+  return pnd;
+}
+}  // namespace scattering
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <vector>
+
+#include "atm.h"
+#include "scattering/scattering_species.h"
+#include "scattering/single_scattering_data.h"
+
+namespace scattering {
+
+/** Bulk extinction and absorption of an ensemble of TRO particles.
+ *
+ * The extinction and absorption coefficients of all scattering elements are
+ * interpolated to the target frequency grid once, at construction, and stored
+ * as two matrices of shape (n_freqs, n_elements * n_temps).  The bulk
+ * properties at an atmospheric point are then a single matrix-vector product
+ * of these tables with a weight vector that combines the particle number
+ * densities and the linear temperature interpolation weights of each element.
+ *
+ * Only the first stokes coefficient is kept, as that is all that is defined
+ * for totally randomly oriented particles.
+ */
+class BulkOpticalProperties {
+  Vector f_grid_;
+  ArrayOfVector t_grids_;
+  Index n_temps_max_ = 0;
+  Matrix extinction_;
+  Matrix absorption_;
+
+  /// Sets up the tables for the given number of elements and their t_grids
+  void resize(ArrayOfVector t_grids);
+
+  /// Interpolates the data of one element to f_grid_ and stores it
+  void set_element(Index i_elem,
+                   const ConstVectorView& data_f_grid,
+                   const ConstMatrixView& ext,
+                   const ConstMatrixView& abs);
+
+ public:
+  BulkOpticalProperties() = default;
+
+  /** Builds the interpolation tables from new-style scattering data
+   *
+   * @param ssd The single scattering data of each element
+   * @param f_grid The frequency grid all calculations will be performed on
+   */
+  template <Representation repr, Index stokes_dim>
+  BulkOpticalProperties(
+      const std::vector<
+          SingleScatteringData<Numeric, Format::TRO, repr, stokes_dim>>& ssd,
+      Vector f_grid)
+      : f_grid_(std::move(f_grid)) {
+    ArrayOfVector t_grids;
+    t_grids.reserve(ssd.size());
+    for (auto& s : ssd) t_grids.push_back(*s.extinction_matrix.get_t_grid());
+    resize(std::move(t_grids));
+
+    for (Size i = 0; i < ssd.size(); i++) {
+      const auto& ext = ssd[i].extinction_matrix;
+      const auto& abs = ssd[i].absorption_vector;
+      ARTS_USER_ERROR_IF(
+          *abs.get_t_grid() != *ext.get_t_grid() or
+              *abs.get_f_grid() != *ext.get_f_grid(),
+          "Scattering element {} has different grids for extinction and "
+          "absorption",
+          i)
+      set_element(static_cast<Index>(i),
+                  *ext.get_f_grid(),
+                  ext(joker, joker, 0),
+                  abs(joker, joker, 0));
+    }
+  }
+
+  /** Builds the interpolation tables from legacy scattering data
+   *
+   * All elements must be totally randomly oriented.
+   *
+   * @param ssd The single scattering data of each element
+   * @param f_grid The frequency grid all calculations will be performed on
+   */
+  BulkOpticalProperties(const ArrayOfSingleScatteringData& ssd, Vector f_grid);
+
+  [[nodiscard]] Index n_elements() const {
+    return static_cast<Index>(t_grids_.size());
+  }
+  [[nodiscard]] Index n_freqs() const { return f_grid_.size(); }
+  [[nodiscard]] const Vector& f_grid() const { return f_grid_; }
+
+  /** The size of the weight vector used by the contraction */
+  [[nodiscard]] Index n_weights() const { return n_elements() * n_temps_max_; }
+
+  /** Combine number densities and temperature interpolation into weights
+   *
+   * @param[out] w The weights, of size n_weights()
+   * @param[in] pnd The number density of each element
+   * @param[in] t The temperature
+   */
+  void weights(VectorView w, const ConstVectorView& pnd, Numeric t) const;
+
+  /** As weights() but for the temperature derivative of the bulk properties
+   *
+   * @param[out] dw The weights, of size n_weights()
+   * @param[in] pnd The number density of each element
+   * @param[in] t The temperature
+   */
+  void dweights_dt(VectorView dw, const ConstVectorView& pnd, Numeric t) const;
+
+  /** Contracts the tables with precomputed weights
+   *
+   * @param[out] ext The bulk extinction, of size n_freqs()
+   * @param[out] abs The bulk absorption, of size n_freqs()
+   * @param[in] w The weights from weights() or dweights_dt()
+   */
+  void contract(VectorView ext,
+                VectorView abs,
+                const ConstVectorView& w) const;
+
+  /** Bulk extinction and absorption at a temperature
+   *
+   * @param[out] ext The bulk extinction, of size n_freqs()
+   * @param[out] abs The bulk absorption, of size n_freqs()
+   * @param[in] pnd The number density of each element
+   * @param[in] t The temperature
+   */
+  void compute(VectorView ext,
+               VectorView abs,
+               const ConstVectorView& pnd,
+               Numeric t) const;
+
+  /** Bulk extinction and absorption for an atmospheric point and a PSD
+   *
+   * The number densities are the PSD evaluated at the particle sizes times
+   * the trapezoidal size bin widths.
+   *
+   * @param[out] ext The bulk extinction, of size n_freqs()
+   * @param[out] abs The bulk absorption, of size n_freqs()
+   * @param[in] psd The particle size distribution
+   * @param[in] atm_point The atmospheric point
+   * @param[in] sizes The size of each element, strictly increasing
+   * @param[in] a The a parameter of the mass-size relationship
+   * @param[in] b The b parameter of the mass-size relationship
+   */
+  void compute(VectorView ext,
+               VectorView abs,
+               const PSD& psd,
+               const AtmPoint& atm_point,
+               const Vector& sizes,
+               Numeric a,
+               Numeric b) const;
+};
+
+/** Particle number densities from a PSD evaluated at the particle sizes
+ *
+ * @param psd The particle size distribution
+ * @param atm_point The atmospheric point
+ * @param sizes The size of each element, strictly increasing
+ * @param a The a parameter of the mass-size relationship
+ * @param b The b parameter of the mass-size relationship
+ * @return Vector The number density of each element
+ */
+Vector pnd_from_psd(const PSD& psd,
+                    const AtmPoint& atm_point,
+                    const Vector& sizes,
+                    Numeric a,
+                    Numeric b);
+}  // namespace scattering
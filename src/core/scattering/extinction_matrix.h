@@ -110,6 +110,9 @@ class ExtinctionMatrixData<Scalar, Format::TRO, repr, stokes_dim>
     return *this;
   }
 
+  std::shared_ptr<const Vector> get_t_grid() const { return t_grid_; }
+  std::shared_ptr<const Vector> get_f_grid() const { return f_grid_; }
+
   constexpr matpack::matpack_view<CoeffVector, 2, false, false>
   get_coeff_vector_view() {
     return matpack::matpack_view<CoeffVector, 2, false, false>(
@@ -70,6 +70,109 @@ void Obsel::sumup(VectorView out, const StokvecMatrixView& j, Index ip) const {
     out[ij]  += std::transform_reduce(jac.begin(), jac.end(), ws.begin(), 0.0);
   }
 }
+
+namespace {
+//! The trapezoidal integration widths of the points of x
+Vector trapz_widths(const AscendingGrid& x) {
+  Vector out(x.size(), 0.0);
+  for (Index i = 0; i < x.size() - 1; i++) {
+    const Numeric dx  = 0.5 * (x[i + 1] - x[i]);
+    out[i]           += dx;
+    out[i + 1]       += dx;
+  }
+  return out;
+}
+}  // namespace
+
+StokvecVector Obsel::weights_on(const AscendingGrid& fs, Index ip) const {
+  ARTS_USER_ERROR_IF(ip < 0 or ip >= poslos->size(),
+                     "Bad poslos index {} for {} poslos",
+                     ip,
+                     poslos->size())
+
+  const auto ws  = w[ip];
+  const auto& fo = *f;
+
+  if (fs == fo) return StokvecVector{ws};
+
+  StokvecVector out(fs.size(), Stokvec{0.0, 0.0, 0.0, 0.0});
+  if (fo.empty() or fs.empty()) return out;
+
+  if (fo.size() == 1) {
+    const Numeric f0 = fo.front();
+    ARTS_USER_ERROR_IF(f0 < fs.front() or f0 > fs.back(),
+                       "The frequency {} Hz of the obsel is outside of the "
+                       "frequency grid [{}, {}] Hz",
+                       f0,
+                       fs.front(),
+                       fs.back())
+
+    const auto it = std::ranges::upper_bound(fs, f0);
+    if (it == fs.end()) {
+      out.back() = ws.front();
+      return out;
+    }
+
+    const Index k   = std::distance(fs.begin(), it) - 1;
+    const Numeric t = (f0 - fs[k]) / (fs[k + 1] - fs[k]);
+    out[k]          = (1.0 - t) * ws.front();
+    out[k + 1]      = t * ws.front();
+    return out;
+  }
+
+  const Vector wo = trapz_widths(fo);
+  const Vector wn = trapz_widths(fs);
+
+  const auto response = [&](Index k) -> Stokvec {
+    ARTS_USER_ERROR_IF(wo[k] == 0.0,
+                       "The frequency grid of the obsel has no width at {} Hz",
+                       fo[k])
+    return (1.0 / wo[k]) * ws[k];
+  };
+
+  Index k = 0;
+  for (Index i = 0; i < fs.size(); i++) {
+    const Numeric x = fs[i];
+    if (x < fo.front() or x > fo.back()) continue;
+
+    while (k < fo.size() - 2 and fo[k + 1] <= x) k++;
+
+    const Numeric t = std::min(1.0, (x - fo[k]) / (fo[k + 1] - fo[k]));
+    out[i] = wn[i] * ((1.0 - t) * response(k) + t * response(k + 1));
+  }
+
+  return out;
+}
+
+Numeric Obsel::sumup(const StokvecVectorView& i,
+                     const AscendingGrid& fs,
+                     Index ip) const {
+  ARTS_USER_ERROR_IF(i.size() != fs.size(),
+                     "The spectrum has {} points but the frequency grid has {}",
+                     i.size(),
+                     fs.size())
+
+  const StokvecVector ws = weights_on(fs, ip);
+
+  return std::transform_reduce(i.begin(), i.end(), ws.begin(), 0.0);
+}
+
+void Obsel::sumup(VectorView out,
+                  const StokvecMatrixView& j,
+                  const AscendingGrid& fs,
+                  Index ip) const {
+  ARTS_USER_ERROR_IF(j.ncols() != fs.size(),
+                     "The jacobian has {} frequencies but the grid has {}",
+                     j.ncols(),
+                     fs.size())
+
+  const StokvecVector ws = weights_on(fs, ip);
+
+  for (Index ij = 0; ij < j.nrows(); ij++) {
+    auto jac  = j[ij];
+    out[ij]  += std::transform_reduce(jac.begin(), jac.end(), ws.begin(), 0.0);
+  }
+}
 }  // namespace sensor
 
 SensorSimulations collect_simulations(const ArrayOfSensorObsel& obsels) {
@@ -119,6 +119,40 @@ class Obsel {
 
   [[nodiscard]] Numeric sumup(const StokvecVectorView& i, Index ip) const;
   void sumup(VectorView out, const StokvecMatrixView& j, Index ip) const;
+
+  /** The weights of this obsel for a spectrum on another frequency grid
+   *
+   * The weights on the frequency grid of the obsel are seen as a response
+   * sampled at the grid points times their trapezoidal integration widths.
+   * The response is interpolated linearly to fs and multiplied by the
+   * trapezoidal integration widths of fs.  It is zero outside of the frequency
+   * grid of the obsel.  If fs is the frequency grid of the obsel, the weights
+   * are returned as they are.
+   *
+   * An obsel with a single frequency samples the spectrum at that frequency,
+   * so its weight is spread to the neighbouring points of fs by linear
+   * interpolation.
+   *
+   * This allows the obsel to be applied to a spectrum on a non-uniform grid,
+   * e.g., one that is refined around the line centers.
+   *
+   * @param fs The frequency grid of the spectrum
+   * @param ip The index of the poslos
+   * @return The weights of the obsel on fs
+   */
+  [[nodiscard]] StokvecVector weights_on(const AscendingGrid& fs,
+                                         Index ip) const;
+
+  //! As sumup, but for a spectrum on the frequency grid fs, see weights_on
+  [[nodiscard]] Numeric sumup(const StokvecVectorView& i,
+                              const AscendingGrid& fs,
+                              Index ip) const;
+
+  //! As sumup, but for jacobians on the frequency grid fs, see weights_on
+  void sumup(VectorView out,
+             const StokvecMatrixView& j,
+             const AscendingGrid& fs,
+             Index ip) const;
 };
 
 std::ostream& operator<<(std::ostream& os, const Array<Obsel>& obsel);
@@ -33,6 +33,8 @@
 #include "nlte.h"
 #include "optproperties.h"
 #include "path_point.h"
+#include "scattering/bulk_optical_properties.h"
+#include "scattering/psd.h"
 #include "species.h"
 #include "species_tags.h"
 
@@ -492,6 +494,68 @@ void propagation_matrixAddParticles(
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void propagation_matrixAddParticlesBulk(
+    PropmatVector& propagation_matrix,
+    PropmatMatrix& propagation_matrix_jacobian,
+    const AscendingGrid& frequency_grid,
+    const JacobianTargets& jacobian_targets,
+    const AtmPoint& atmospheric_point,
+    const ArrayOfSingleScatteringData& scat_data,
+    const String& scat_species,
+    const Vector& particle_sizes,
+    const Numeric& mass_size_a,
+    const Numeric& mass_size_b,
+    const String& psd_name,
+    const Index& use_abs_as_ext) {
+  const Index nf = frequency_grid.nelem();
+  ARTS_USER_ERROR_IF(propagation_matrix.nelem() != nf,
+                     "Mismatch in size of propagation_matrix and "
+                     "frequency_grid")
+  ARTS_USER_ERROR_IF(
+      static_cast<Index>(scat_data.size()) != particle_sizes.nelem(),
+      "Got {} scattering elements but {} particle sizes",
+      scat_data.size(),
+      particle_sizes.nelem())
+
+  const ScatteringSpeciesProperty mass_density{
+      scat_species, ParticulateProperty::MassDensity};
+  const PSD psd = MGDSingleMoment(mass_density, psd_name, 0.0, 1e99, false);
+  const scattering::BulkOpticalProperties bulk(scat_data, frequency_grid);
+
+  Vector ext(nf), abs(nf);
+  const auto add = [&](PropmatVectorView pm, const AtmPoint& pt, Numeric x) {
+    bulk.compute(ext, abs, psd, pt, particle_sizes, mass_size_a, mass_size_b);
+    const Vector& k = use_abs_as_ext ? abs : ext;
+    for (Index iv = 0; iv < nf; iv++) pm[iv].A() += x * k[iv];
+  };
+
+  add(propagation_matrix, atmospheric_point, 1.0);
+
+  // Both the tables and the PSD depend on the temperature, so perturb it
+  if (const auto jac = jacobian_targets.find<Jacobian::AtmTarget>(AtmKey::t);
+      jac.first) {
+    const Numeric d = jac.second->d;
+    AtmPoint pt     = atmospheric_point;
+    pt[AtmKey::t]  += d;
+    add(propagation_matrix_jacobian[jac.second->target_pos], pt, 1.0 / d);
+    add(propagation_matrix_jacobian[jac.second->target_pos],
+        atmospheric_point,
+        -1.0 / d);
+  }
+
+  if (const auto jac = jacobian_targets.find<Jacobian::AtmTarget>(mass_density);
+      jac.first) {
+    const Numeric d   = jac.second->d;
+    AtmPoint pt       = atmospheric_point;
+    pt[mass_density] += d;
+    add(propagation_matrix_jacobian[jac.second->target_pos], pt, 1.0 / d);
+    add(propagation_matrix_jacobian[jac.second->target_pos],
+        atmospheric_point,
+        -1.0 / d);
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propagation_matrixZero(PropmatVector& propagation_matrix,
                             const AscendingGrid& frequency_grid) {
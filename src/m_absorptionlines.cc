@@ -9,15 +9,23 @@
 #include "m_absorptionlines.h"
 
 #include <enumsHitranType.h>
+#include <fast_float/fast_float.h>
 #include <workspace.h>
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <exception>
 #include <iterator>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "absorptionlines.h"
 #include "array.h"
+#include "arts_constants.h"
 #include "arts_omp.h"
 #include "debug.h"
 #include "file.h"
@@ -561,23 +569,264 @@ void ReadSplitARTSCAT(ArrayOfAbsorptionLines& abs_lines,
   for (auto& band : abs_lines) band.sort_by_frequency();
 }
 
-/* Workspace method: Doxygen documentation will be auto-generated */
-void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
-                const String& hitran_file,
-                const Numeric& fmin,
-                const Numeric& fmax,
-                const String& globalquantumnumbers,
-                const String& localquantumnumbers,
-                const String& hitran_type,
-                const String& normalization_option,
-                const String& mirroring_option,
-                const String& population_option,
-                const String& lineshapetype_option,
-                const String& cutoff_option,
-                const Numeric& cutoff_value,
-                const Numeric& linemixinglimit_value) {
+/** Reads a line-based catalog in large blocks of complete records
+ *
+ * Each block is split into its lines, without any trailing carriage return.
+ * Empty lines are skipped.  A line that is cut by the end of a block is kept
+ * for the next block.
+ */
+class CatalogRecordBlocks {
+  std::ifstream is;
+  String block{};
+  String rest{};
+
+ public:
+  //! The number of bytes read per block
+  static constexpr std::streamsize block_size = 1 << 23;
+
+  explicit CatalogRecordBlocks(const String& filename) {
+    open_input_file(is, filename);
+  }
+
+  /** Get the records of the next block
+   *
+   * The records are views into the block, valid until the next call
+   *
+   * @param[out] records The complete records of the block
+   * @return false if the end of the file was reached before this call
+   */
+  bool next(std::vector<std::string_view>& records) {
+    records.clear();
+    if (not is and rest.empty()) return false;
+
+    std::swap(block, rest);
+    rest.clear();
+
+    const Size n = block.size();
+    if (is) {
+      block.resize(n + block_size);
+      is.read(block.data() + n, block_size);
+      block.resize(n + is.gcount());
+    }
+
+    // Keep the last line for the next block unless this is the end of the file
+    if (is) {
+      const auto last = block.rfind('\n');
+      const Size end  = last == String::npos ? 0 : last + 1;
+      rest.assign(block, end);
+      block.resize(end);
+    }
+
+    std::string_view x{block};
+    while (not x.empty()) {
+      const auto pos        = x.find('\n');
+      std::string_view line = x.substr(0, pos);
+      x.remove_prefix(pos == std::string_view::npos ? x.size() : pos + 1);
+
+      if (not line.empty() and line.back() == '\r') line.remove_suffix(1);
+      if (not line.empty()) records.push_back(line);
+    }
+
+    return true;
+  }
+};
+
+/** Reads the number in a fixed-width field of a catalog record
+ *
+ * @param record A record
+ * @param pos The first character of the field
+ * @param n The width of the field
+ * @return The number, if the field holds one
+ */
+std::optional<Numeric> fixed_width_number(std::string_view record,
+                                          Size pos,
+                                          Size n) {
+  if (record.size() <= pos) return std::nullopt;
+
+  std::string_view x = record.substr(pos, n);
+  while (not x.empty() and x.front() == ' ') x.remove_prefix(1);
+  while (not x.empty() and x.back() == ' ') x.remove_suffix(1);
+
+  Numeric v;
+  const auto [ptr, ec] =
+      fast_float::from_chars(x.data(), x.data() + x.size(), v);
+  if (ec != std::errc{} or ptr != x.data() + x.size()) return std::nullopt;
+  return v;
+}
+
+/** Reads a catalog with one line per record
+ *
+ * The catalog is read block by block, see CatalogRecordBlocks.  The
+ * frequency and intensity of each record are first read directly from their
+ * fixed-width fields by the prefilter.  Records outside of the frequency
+ * range or weaker than the minimum intensity are skipped without being
+ * parsed.  The catalog is assumed to be sorted by frequency, so reading
+ * stops at the first record above the frequency range.  The records left
+ * in a block are parsed in parallel and passed to the consumer in order.
+ *
+ * Records that the prefilter cannot read are fully parsed.  Records that
+ * the reader consumes completely without finding a line, i.e., comments,
+ * are skipped.  Any other record that the reader cannot read is an error.
+ *
+ * @param[in] filename The catalog file
+ * @param[in] fmin The lowest frequency to keep [Hz]
+ * @param[in] fmax The highest frequency to keep [Hz]
+ * @param[in] intensity_min The lowest intensity to keep, as returned by the prefilter
+ * @param[in] reader Parses a single record from a stream
+ * @param[in] prefilter Reads the frequency and intensity of a record, if it can
+ * @param[in] consumer Takes the lines that are kept, in the order of the catalog
+ */
+template <typename Reader, typename Prefilter, typename Consumer>
+void stream_catalog(const String& filename,
+                    const Numeric fmin,
+                    const Numeric fmax,
+                    const Numeric intensity_min,
+                    Reader&& reader,
+                    Prefilter&& prefilter,
+                    Consumer&& consumer) {
+  CatalogRecordBlocks blocks{filename};
+  std::vector<std::string_view> records;
+  std::vector<std::string_view> selected;
+  std::vector<Size> record_number;
+  std::vector<Absorption::SingleLineExternal> slines;
+
+  Size nrecord = 0;
+  bool go_on   = true;
+  while (go_on and blocks.next(records)) {
+    selected.clear();
+    record_number.clear();
+    for (auto& record : records) {
+      nrecord++;
+
+      if (const std::optional<std::pair<Numeric, Numeric>> fs =
+              prefilter(record)) {
+        const auto [f, s] = *fs;
+        if (f < fmin or s < intensity_min) continue;  // Skip this line
+        if (f > fmax) {  // We assume sorted so quit here
+          go_on = false;
+          break;
+        }
+      }
+
+      selected.push_back(record);
+      record_number.push_back(nrecord);
+    }
+
+    slines.resize(selected.size());
+    String error{};
+
+#pragma omp parallel for schedule(guided) if (!arts_omp_in_parallel())
+    for (Size i = 0; i < selected.size(); i++) {
+      try {
+        std::istringstream is{String{selected[i]}};
+        slines[i] = reader(is);
+
+        if (slines[i].bad) {
+          // Comments are read to the end of the record without finding a line
+          ARTS_USER_ERROR_IF(not is.eof(), "Not a valid record")
+        } else {
+          // Set Zeeman if implemented
+          slines[i].line.zeeman =
+              Zeeman::GetAdvancedModel(slines[i].quantumidentity);
+        }
+      } catch (std::exception& e) {
+#pragma omp critical
+        error += var_string("Cannot read line ",
+                            record_number[i],
+                            ":\n",
+                            e.what(),
+                            '\n');
+      }
+    }
+
+    ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+    for (auto& sline : slines) {
+      if (sline.bad) continue;
+      if (sline.line.F0 < fmin) continue;  // Skip this line
+      if (sline.line.F0 > fmax) {          // We assume sorted so quit here
+        go_on = false;
+        break;
+      }
+
+      consumer(std::move(sline));
+    }
+  }
+}
+
+/** Reads a catalog with one line per record into abs_lines
+ *
+ * Lines are grouped by their global quantum numbers as they are read, in
+ * the same way as ReadARTSCAT does.
+ *
+ * See stream_catalog for the parameters
+ *
+ * @param[out] abs_lines As WSV
+ * @param[in] global_nums The global quantum numbers
+ * @param[in] local_nums The local quantum numbers
+ */
+template <typename Reader, typename Prefilter>
+void stream_catalog_merged(ArrayOfAbsorptionLines& abs_lines,
+                           const String& filename,
+                           const Numeric fmin,
+                           const Numeric fmax,
+                           const Numeric intensity_min,
+                           const Array<QuantumNumberType>& global_nums,
+                           const Array<QuantumNumberType>& local_nums,
+                           Reader&& reader,
+                           Prefilter&& prefilter) {
   abs_lines.resize(0);
 
+  ArrayOfAbsorptionLines local_bands(0);
+  stream_catalog(
+      filename,
+      fmin,
+      fmax,
+      intensity_min,
+      reader,
+      prefilter,
+      [&](Absorption::SingleLineExternal&& sline) {
+        // Get the global quantum number identifier
+        const QuantumIdentifier global_qid =
+            global_quantumidentifier(global_nums, sline.quantumidentity);
+
+        // Get local quantum numbers into the line
+        for (auto qn : local_nums) {
+          if (sline.quantumidentity.val.has(qn)) {
+            sline.line.localquanta.val.set(sline.quantumidentity.val[qn]);
+          }
+        }
+
+        // Either find a line like this in the list of lines or start a new Lines
+        merge_external_line(local_bands, sline, global_qid);
+        if (local_bands.size() > merge_local_lines_size) {
+          merge_local_lines(abs_lines, local_bands);
+          local_bands.resize(0);
+        }
+      });
+
+  merge_local_lines(abs_lines, local_bands);
+
+  for (auto& band : abs_lines) band.sort_by_frequency();
+}
+
+/** Reads a HITRAN catalog into abs_lines
+ *
+ * The intensity is compared in ARTS units [Hz m^2], but as in the catalog,
+ * i.e., including the isotopologue ratio.
+ *
+ * See stream_catalog_merged for the other parameters
+ *
+ * @param[in] hitran_type The HitranType of the catalog
+ */
+void read_hitran(ArrayOfAbsorptionLines& abs_lines,
+                 const String& hitran_file,
+                 const Numeric fmin,
+                 const Numeric fmax,
+                 const Numeric intensity_min,
+                 const String& globalquantumnumbers,
+                 const String& localquantumnumbers,
+                 const String& hitran_type) {
   // Global numbers
   const Array<QuantumNumberType> global_nums =
       string2vecqn(globalquantumnumbers);
@@ -590,60 +839,134 @@ void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
   // HITRAN type
   const HitranType hitran_version = to<HitranType>(hitran_type);
 
-  // Hitran data
-  std::ifstream is;
-  open_input_file(is, hitran_file);
-
-  ArrayOfAbsorptionLines local_bands(0);
-  bool go_on = true;
-  while (go_on) {
-    Absorption::SingleLineExternal sline;
-    switch (hitran_version) {
-      case HitranType::Post2004:
-        sline = Absorption::ReadFromHitran2004Stream(is);
-        break;
-      case HitranType::Pre2004:
-        sline = Absorption::ReadFromHitran2001Stream(is);
-        break;
-      case HitranType::Online:
-        sline = Absorption::ReadFromHitranOnlineStream(is);
-        break;
-      default:
-        ARTS_ASSERT(false,
-                    "The HitranType enum class has to be fully updated!\n");
-    }
+  // All versions start with the molecule (2), the isotopologue (1), the
+  // position in cm-1 (12), and the intensity in cm-1/(molec * cm-2) (10)
+  const auto prefilter = [](std::string_view record) {
+    constexpr Numeric w2Hz    = Constant::c * 100.;
+    constexpr Numeric hi2arts = 1e-2 * Constant::c;
+
+    const auto v = fixed_width_number(record, 3, 12);
+    const auto s = fixed_width_number(record, 15, 10);
+    return v and s ? std::optional{std::pair{*v * w2Hz, *s * hi2arts}}
+                   : std::nullopt;
+  };
+
+  switch (hitran_version) {
+    case HitranType::Post2004:
+      stream_catalog_merged(abs_lines,
+                            hitran_file,
+                            fmin,
+                            fmax,
+                            intensity_min,
+                            global_nums,
+                            local_nums,
+                            Absorption::ReadFromHitran2004Stream,
+                            prefilter);
+      break;
+    case HitranType::Pre2004:
+      stream_catalog_merged(abs_lines,
+                            hitran_file,
+                            fmin,
+                            fmax,
+                            intensity_min,
+                            global_nums,
+                            local_nums,
+                            Absorption::ReadFromHitran2001Stream,
+                            prefilter);
+      break;
+    case HitranType::Online:
+      stream_catalog_merged(abs_lines,
+                            hitran_file,
+                            fmin,
+                            fmax,
+                            intensity_min,
+                            global_nums,
+                            local_nums,
+                            Absorption::ReadFromHitranOnlineStream,
+                            prefilter);
+      break;
+    default:
+      ARTS_ASSERT(false, "The HitranType enum class has to be fully updated!\n");
+  }
+}
 
-    if (sline.bad) {
-      if (is.eof()) break;
-      ARTS_USER_ERROR("Cannot read line {}",
-                      size(abs_lines) + size(local_bands) + 1);
-    }
-    if (sline.line.F0 < fmin) continue;  // Skip this line
-    if (sline.line.F0 > fmax) break;     // We assume sorted so quit here
+/** Reads a JPL catalog into abs_lines
+ *
+ * The intensity is compared in ARTS units [Hz m^2].  The lines are grouped
+ * as by ReadLBLRTM, see Absorption::split_list_of_external_lines.
+ *
+ * See stream_catalog for the other parameters
+ */
+void read_jpl(ArrayOfAbsorptionLines& abs_lines,
+              const String& jpl_file,
+              const Numeric fmin,
+              const Numeric fmax,
+              const Numeric intensity_min,
+              const String& globalquantumnumbers,
+              const String& localquantumnumbers) {
+  // Global numbers
+  const Array<QuantumNumberType> global_nums =
+      string2vecqn(globalquantumnumbers);
 
-    // Set Zeeman if implemented
-    sline.line.zeeman = Zeeman::GetAdvancedModel(sline.quantumidentity);
+  // Local numbers
+  const Array<QuantumNumberType> local_nums = string2vecqn(localquantumnumbers);
+  ARTS_USER_ERROR_IF(not check_local(local_nums),
+                     "Can only have non-string values in the local state")
 
-    // Get the global quantum number identifier
-    const QuantumIdentifier global_qid =
-        global_quantumidentifier(global_nums, sline.quantumidentity);
+  // The records start with the position in MHz (13), its accuracy (8), and
+  // the log10 of the intensity in nm2 MHz (8)
+  const auto prefilter = [](std::string_view record) {
+    const auto v = fixed_width_number(record, 0, 13);
+    const auto s = fixed_width_number(record, 21, 8);
+    return v and s and *v != 0.0
+               ? std::optional{std::pair{*v * 1e6, std::pow(10.0, *s) / 1e12}}
+               : std::nullopt;
+  };
 
-    // Get local quantum numbers into the line
-    for (auto qn : local_nums) {
-      if (sline.quantumidentity.val.has(qn)) {
-        sline.line.localquanta.val.set(sline.quantumidentity.val[qn]);
-      }
-    }
+  std::vector<Absorption::SingleLineExternal> v(0);
+  stream_catalog(jpl_file,
+                 fmin,
+                 fmax,
+                 intensity_min,
+                 Absorption::ReadFromJplStream,
+                 prefilter,
+                 [&v](Absorption::SingleLineExternal&& sline) {
+                   v.push_back(std::move(sline));
+                 });
 
-    // Either find a line like this in the list of lines or start a new Lines
-    merge_external_line(local_bands, sline, global_qid);
-    if (local_bands.size() > merge_local_lines_size) {
-      merge_local_lines(abs_lines, local_bands);
-      local_bands.resize(0);
-    }
+  auto x = Absorption::split_list_of_external_lines(v, local_nums, global_nums);
+  abs_lines.resize(0);
+  abs_lines.reserve(x.size());
+  while (x.size()) {
+    abs_lines.push_back(x.back());
+    abs_lines.back().sort_by_frequency();
+    x.pop_back();
   }
+}
 
-  merge_local_lines(abs_lines, local_bands);
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
+                const String& hitran_file,
+                const Numeric& fmin,
+                const Numeric& fmax,
+                const String& globalquantumnumbers,
+                const String& localquantumnumbers,
+                const String& hitran_type,
+                const String& normalization_option,
+                const String& mirroring_option,
+                const String& population_option,
+                const String& lineshapetype_option,
+                const String& cutoff_option,
+                const Numeric& cutoff_value,
+                const Numeric& linemixinglimit_value) {
+  read_hitran(abs_lines,
+              hitran_file,
+              fmin,
+              fmax,
+              0.0,
+              globalquantumnumbers,
+              localquantumnumbers,
+              hitran_type);
 
   abs_linesNormalization(abs_lines, normalization_option);
   abs_linesMirroring(abs_lines, mirroring_option);
@@ -732,48 +1055,13 @@ void ReadJPL(ArrayOfAbsorptionLines& abs_lines,
              const String& cutoff_option,
              const Numeric& cutoff_value,
              const Numeric& linemixinglimit_value) {
-  abs_lines.resize(0);
-
-  // Global numbers
-  const Array<QuantumNumberType> global_nums =
-      string2vecqn(globalquantumnumbers);
-
-  // Local numbers
-  const Array<QuantumNumberType> local_nums = string2vecqn(localquantumnumbers);
-  ARTS_USER_ERROR_IF(not check_local(local_nums),
-                     "Can only have non-string values in the local state")
-
-  // LBLRTM data
-  std::ifstream is;
-  open_input_file(is, jpl_file);
-
-  std::vector<Absorption::SingleLineExternal> v(0);
-
-  bool go_on = true;
-  while (go_on) {
-    v.push_back(Absorption::ReadFromJplStream(is));
-
-    if (v.back().bad) {
-      v.pop_back();
-      go_on = false;
-    } else if (v.back().line.F0 < fmin) {
-      v.pop_back();
-    } else if (v.back().line.F0 > fmax) {
-      v.pop_back();
-      go_on = false;
-    }
-  }
-
-  for (auto& x : v) x.line.zeeman = Zeeman::GetAdvancedModel(x.quantumidentity);
-
-  auto x = Absorption::split_list_of_external_lines(v, local_nums, global_nums);
-  abs_lines.resize(0);
-  abs_lines.reserve(x.size());
-  while (x.size()) {
-    abs_lines.push_back(x.back());
-    abs_lines.back().sort_by_frequency();
-    x.pop_back();
-  }
+  read_jpl(abs_lines,
+           jpl_file,
+           fmin,
+           fmax,
+           0.0,
+           globalquantumnumbers,
+           localquantumnumbers);
 
   abs_linesNormalization(abs_lines, normalization_option);
   abs_linesMirroring(abs_lines, mirroring_option);
@@ -783,6 +1071,98 @@ void ReadJPL(ArrayOfAbsorptionLines& abs_lines,
   abs_linesLinemixingLimit(abs_lines, linemixinglimit_value);
 }
 
+/** Converts lines read by the old style readers to absorption_bands
+ *
+ * The lines are converted as Voigt lines in LTE without cutoff, the only
+ * combination that absorption_bandsFromAbsorbtionLines supports, and are
+ * then given the line shape and cutoff of the new style bands.
+ *
+ * @param[out] absorption_bands As WSV
+ * @param[in] abs_lines The lines that were read
+ * @param[in] lineshape The LineByLineLineshape of all bands
+ * @param[in] cutoff The LineByLineCutoffType of all bands
+ * @param[in] cutoff_value The cutoff value of all bands
+ */
+void absorption_bands_from_read_lines(ArrayOfAbsorptionBand& absorption_bands,
+                                      ArrayOfAbsorptionLines&& abs_lines,
+                                      const String& lineshape,
+                                      const String& cutoff,
+                                      const Numeric cutoff_value) {
+  const auto new_lineshape = to<LineByLineLineshape>(lineshape);
+  const auto new_cutoff    = to<LineByLineCutoffType>(cutoff);
+
+  abs_linesNormalization(abs_lines, "None");
+  abs_linesMirroring(abs_lines, "None");
+  abs_linesPopulation(abs_lines, "LTE");
+  abs_linesLineShapeType(abs_lines, "VP");
+  abs_linesCutoff(abs_lines, "None", -1);
+
+  ArrayOfArrayOfAbsorptionLines abs_lines_per_species(1);
+  abs_lines_per_species[0] = std::move(abs_lines);
+  absorption_bandsFromAbsorbtionLines(
+      absorption_bands, ArrayOfArrayOfSpeciesTag(1), abs_lines_per_species);
+
+  for (auto& band : absorption_bands) {
+    band.data.lineshape    = new_lineshape;
+    band.data.cutoff       = new_cutoff;
+    band.data.cutoff_value = cutoff_value;
+  }
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void absorption_bandsReadHITRAN(ArrayOfAbsorptionBand& absorption_bands,
+                                const String& file,
+                                const Numeric& fmin,
+                                const Numeric& fmax,
+                                const Numeric& intensity_min,
+                                const String& hitran_type,
+                                const String& globalquantumnumbers,
+                                const String& localquantumnumbers,
+                                const String& lineshape,
+                                const String& cutoff,
+                                const Numeric& cutoff_value) {
+  ArrayOfAbsorptionLines abs_lines;
+  read_hitran(abs_lines,
+              file,
+              fmin,
+              fmax,
+              intensity_min,
+              globalquantumnumbers,
+              localquantumnumbers,
+              hitran_type);
+  absorption_bands_from_read_lines(absorption_bands,
+                                   std::move(abs_lines),
+                                   lineshape,
+                                   cutoff,
+                                   cutoff_value);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void absorption_bandsReadJPL(ArrayOfAbsorptionBand& absorption_bands,
+                             const String& file,
+                             const Numeric& fmin,
+                             const Numeric& fmax,
+                             const Numeric& intensity_min,
+                             const String& globalquantumnumbers,
+                             const String& localquantumnumbers,
+                             const String& lineshape,
+                             const String& cutoff,
+                             const Numeric& cutoff_value) {
+  ArrayOfAbsorptionLines abs_lines;
+  read_jpl(abs_lines,
+           file,
+           fmin,
+           fmax,
+           intensity_min,
+           globalquantumnumbers,
+           localquantumnumbers);
+  absorption_bands_from_read_lines(absorption_bands,
+                                   std::move(abs_lines),
+                                   lineshape,
+                                   cutoff,
+                                   cutoff_value);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////// IO of AbsorptionLines
 /////////////////////////////////////////////////////////////////////////////////////
@@ -18,3 +18,44 @@ void abs_linesLinemixingLimit(ArrayOfAbsorptionLines& abs_lines,
 
 void abs_linesLineShapeType(ArrayOfAbsorptionLines& abs_lines,
                             const String& type);
+
+void merge_external_line(ArrayOfAbsorptionLines& abs_lines,
+                         const Absorption::SingleLineExternal& sline,
+                         const QuantumIdentifier& global_qid);
+
+void merge_local_lines(ArrayOfAbsorptionLines& abs_lines,
+                       const ArrayOfAbsorptionLines& local_lines);
+
+QuantumIdentifier global_quantumidentifier(const Array<QuantumNumberType>& qns,
+                                           const QuantumIdentifier& qid);
+
+Array<QuantumNumberType> string2vecqn(std::string_view qnstr);
+
+void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
+                const String& hitran_file,
+                const Numeric& fmin,
+                const Numeric& fmax,
+                const String& globalquantumnumbers,
+                const String& localquantumnumbers,
+                const String& hitran_type,
+                const String& normalization_option,
+                const String& mirroring_option,
+                const String& population_option,
+                const String& lineshapetype_option,
+                const String& cutoff_option,
+                const Numeric& cutoff_value,
+                const Numeric& linemixinglimit_value);
+
+void ReadJPL(ArrayOfAbsorptionLines& abs_lines,
+             const String& jpl_file,
+             const Numeric& fmin,
+             const Numeric& fmax,
+             const String& globalquantumnumbers,
+             const String& localquantumnumbers,
+             const String& normalization_option,
+             const String& mirroring_option,
+             const String& population_option,
+             const String& lineshapetype_option,
+             const String& cutoff_option,
+             const Numeric& cutoff_value,
+             const Numeric& linemixinglimit_value);
@@ -499,40 +499,57 @@ void atmospheric_fieldIGRF(AtmField &atmospheric_field, const Time &time) {
   //! This is the WGS84 version of that, with radius of equator and pole
   static constexpr Vector2 ell{6378137., 6356752.314245};
 
-  //! This struct deals with the computations, it's internally saving a mutable
-  //! state
-  struct res {
-    Time t;
-
-    [[nodiscard]] Vector3 comp(Numeric al, Numeric la, Numeric lo) const {
-      return igrf({al, la, lo}, ell, t);
-    }
+  //! All three components are computed by one call to IGRF
+  const Atm::MultiFunctionalData mag{
+      [time](Numeric h, Numeric lat, Numeric lon) {
+        const Vector3 m = igrf({h, lat, lon}, ell, time);
+        return Vector{m[0], m[1], m[2]};
+      },
+      3};
+
+  atmospheric_field[AtmKey::mag_u] = mag.component(0);
+  atmospheric_field[AtmKey::mag_v] = mag.component(1);
+  atmospheric_field[AtmKey::mag_w] = mag.component(2);
+}
 
-    [[nodiscard]] Numeric get_u(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[0];
-    }
+void atmospheric_fieldTabulateFunctional(AtmField &atmospheric_field,
+                                         const AscendingGrid &alt,
+                                         const AscendingGrid &lat,
+                                         const AscendingGrid &lon) {
+  ARTS_USER_ERROR_IF(alt.empty() or lat.empty() or lon.empty(),
+                     "Empty grids: alt {:B,}, lat {:B,}, lon {:B,}",
+                     alt.vec(),
+                     lat.vec(),
+                     lon.vec())
+
+  std::vector<Atm::Data *> data;
+  std::vector<GriddedField3> fields;
+  for (auto &&key : atmospheric_field.keys()) {
+    auto &d = atmospheric_field[key];
+    if (not std::holds_alternative<Atm::FunctionalData>(d.data)) continue;
+
+    data.push_back(&d);
+    fields.push_back(
+        GriddedField3{.data_name  = std::format("{}", key),
+                      .data       = Tensor3(alt.nelem(), lat.nelem(), lon.nelem()),
+                      .grid_names = {"Altitude", "Latitude", "Longitude"},
+                      .grids      = {alt.vec(), lat.vec(), lon.vec()}});
+  }
 
-    [[nodiscard]] Numeric get_v(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[1];
+  // All fields are evaluated together per position, so that functional
+  // data with several outputs are only computed once per position
+  for (Index i = 0; i < alt.nelem(); i++) {
+    for (Index j = 0; j < lat.nelem(); j++) {
+      for (Index k = 0; k < lon.nelem(); k++) {
+        for (Size n = 0; n < data.size(); n++) {
+          fields[n].data(i, j, k) = std::get<Atm::FunctionalData>(
+              data[n]->data)(alt[i], lat[j], lon[k]);
+        }
+      }
     }
+  }
 
-    [[nodiscard]] Numeric get_w(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[2];
-    }
-  };
-
-  atmospheric_field[AtmKey::mag_u] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
-        return cpy.get_u(h, lat, lon);
-      }};
-  atmospheric_field[AtmKey::mag_v] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
-        return cpy.get_v(h, lat, lon);
-      }};
-  atmospheric_field[AtmKey::mag_w] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
-        return cpy.get_w(h, lat, lon);
-      }};
+  for (Size n = 0; n < data.size(); n++) data[n]->data = std::move(fields[n]);
 }
 
 enum class atmospheric_fieldHydrostaticPressureDataOptions : char {
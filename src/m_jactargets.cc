@@ -1,6 +1,7 @@
 #include <jacobian.h>
 #include <enumsFieldComponent.h>
 
+#include <algorithm>
 #include <iterator>
 #include <limits>
 
@@ -142,3 +143,61 @@ void jacobian_targetsAddSpeciesIsotopologueRatio(
   jacobian_targets.target<Jacobian::AtmTarget>().emplace_back(
       species, d, jacobian_targets.target_count());
 }
+
+void jacobian_targetsAddLineParameter(
+    JacobianTargets& jacobian_targets,
+    const ArrayOfAbsorptionBand& absorption_bands,
+    const QuantumIdentifier& id,
+    const Index& line_index,
+    const String& parameter,
+    const SpeciesEnum& species,
+    const Numeric& d) {
+  ARTS_USER_ERROR_IF(line_index < 0, "Negative line index: {}", line_index)
+
+  lbl::line_key key{.band = id, .line = static_cast<Size>(line_index)};
+
+  if (std::ranges::find(enumstrs::LineByLineVariableNames<>, parameter) !=
+      enumstrs::LineByLineVariableNames<>.end()) {
+    key.var = to<LineByLineVariable>(parameter);
+    static_cast<void>(key.get_value(absorption_bands));  // Throws if missing
+    jacobian_targets.target<Jacobian::LineTarget>().emplace_back(
+        key, d, jacobian_targets.target_count());
+    return;
+  }
+
+  key.ls_var = to<LineShapeModelVariable>(parameter);
+
+  const auto band = std::ranges::find(absorption_bands, id, &lbl::band::key);
+  ARTS_USER_ERROR_IF(
+      band == absorption_bands.end(), "No band with quantum identifier: {}", id)
+  ARTS_USER_ERROR_IF(key.line >= band->data.lines.size(),
+                     "Line index out of range: {}"
+                     " band has {} absorption lines",
+                     key.line,
+                     band->data.lines.size())
+
+  const auto& single_models = band->data.lines[key.line].ls.single_models;
+  const auto spec = std::ranges::find(
+      single_models, species, &lbl::line_shape::species_model::species);
+  ARTS_USER_ERROR_IF(spec == single_models.end(),
+                     "No line shape model for species {} in line {}",
+                     species,
+                     key.line)
+  key.spec = static_cast<Size>(std::distance(single_models.begin(), spec));
+
+  const auto var = std::ranges::find(
+      spec->data, key.ls_var, [](auto& x) { return x.first; });
+  ARTS_USER_ERROR_IF(var == spec->data.end(),
+                     "No line shape parameter {} for species {} in line {}",
+                     key.ls_var,
+                     species,
+                     key.line)
+
+  // One target per coefficient of the temperature model
+  const Size ncoeff = var->second.X().size();
+  for (Size i = 0; i < ncoeff; i++) {
+    key.ls_coeff = static_cast<LineShapeModelCoefficient>(i);
+    jacobian_targets.target<Jacobian::LineTarget>().emplace_back(
+        key, d, jacobian_targets.target_count());
+  }
+}
@@ -9,6 +9,7 @@
 #include <filesystem>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <ranges>
 #include <span>
 #include <unordered_map>
@@ -289,6 +290,13 @@ std::vector<std::pair<Index, Index>> omp_offset_count(const Index N,
   return result;
 }
 
+void absorption_band_indexFromBands(
+    AbsorptionBandIndex& absorption_band_index,
+    const ArrayOfAbsorptionBand& absorption_bands) try {
+  absorption_band_index = AbsorptionBandIndex{absorption_bands};
+}
+ARTS_METHOD_ERROR_CATCH
+
 void absorption_bandsSelectFrequency(ArrayOfAbsorptionBand& absorption_bands,
                                      const Numeric& fmin,
                                      const Numeric& fmax,
@@ -449,19 +457,41 @@ void absorption_bandsReadSpeciesSplitCatalog(
     }
   }
 
+  std::vector<String> filenames;
+  filenames.reserve(isotopologues.size());
   for (auto& isot : isotopologues) {
     String filename = my_base + isot.FullName() + ".xml";
-    if (find_xml_file_existence(filename)) {
-      ArrayOfAbsorptionBand other;
-      xml_read_from_file(filename, other);
+    ARTS_USER_ERROR_IF(
+        not find_xml_file_existence(filename), "File {} not found", filename)
+    filenames.push_back(std::move(filename));
+  }
 
-      absorption_bands.insert(absorption_bands.end(),
-                              std::make_move_iterator(other.begin()),
-                              std::make_move_iterator(other.end()));
-    } else {
-      ARTS_USER_ERROR("File {} not found", filename)
+  std::vector<ArrayOfAbsorptionBand> splitbands(filenames.size());
+  std::string error{};
+
+#pragma omp parallel for schedule(dynamic)
+  for (Size i = 0; i < filenames.size(); i++) {
+    try {
+      xml_read_from_file(filenames[i], splitbands[i]);
+    } catch (std::exception& e) {
+#pragma omp critical
+      error += var_string(e.what(), '\n');
     }
   }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  absorption_bands.reserve(std::transform_reduce(
+      splitbands.begin(),
+      splitbands.end(),
+      Size{0},
+      std::plus<>{},
+      [](const ArrayOfAbsorptionBand& bands) { return bands.size(); }));
+  for (auto& bands : splitbands) {
+    absorption_bands.insert(absorption_bands.end(),
+                            std::make_move_iterator(bands.begin()),
+                            std::make_move_iterator(bands.end()));
+  }
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -508,7 +538,10 @@ void absorption_bandsReadSplit(ArrayOfAbsorptionBand& absorption_bands,
 ARTS_METHOD_ERROR_CATCH
 
 void absorption_bandsSaveSplit(const ArrayOfAbsorptionBand& absorption_bands,
-                               const String& dir) try {
+                               const String& dir,
+                               const String& output_file_format) try {
+  const auto ftype = to<FileType>(output_file_format);
+
   auto create_if_not = [](const std::filesystem::path& path) {
     if (not std::filesystem::exists(path)) {
       std::filesystem::create_directories(path);
@@ -525,7 +558,7 @@ void absorption_bandsSaveSplit(const ArrayOfAbsorptionBand& absorption_bands,
 
   for (const auto& [isot, bands] : isotopologues_data) {
     xml_write_to_file(
-        (p / var_string(isot, ".xml")).string(), bands, FileType::ascii, 0);
+        (p / var_string(isot, ".xml")).string(), bands, ftype, 0);
   }
 }
 ARTS_METHOD_ERROR_CATCH
@@ -553,14 +586,57 @@ void propagation_matrixAddLines(PropmatVector& pm,
                                 StokvecVector& sv,
                                 PropmatMatrix& dpm,
                                 StokvecMatrix& dsv,
+                                Index& evaluated_lines,
                                 const AscendingGrid& f_grid,
                                 const JacobianTargets& jacobian_targets,
                                 const SpeciesEnum& species,
                                 const ArrayOfAbsorptionBand& absorption_bands,
+                                const AbsorptionBandIndex& absorption_band_index,
                                 const LinemixingEcsData& ecs_data,
+                                const LinemixingEcsTables& ecs_tables,
                                 const AtmPoint& atm_point,
                                 const PropagationPathPoint& path_point,
-                                const Index& no_negative_absorption) try {
+                                const Index& no_negative_absorption,
+                                const Numeric& line_pruning) try {
+  ARTS_USER_ERROR_IF(
+      line_pruning != 0.0 and not jacobian_targets.line().empty(),
+      "Cannot prune lines with line parameter jacobian targets")
+
+  ARTS_USER_ERROR_IF(
+      absorption_band_index.size() != 0 and
+          not absorption_band_index.matches(absorption_bands),
+      "The absorption_band_index does not match the absorption_bands.\n"
+      "Call absorption_band_indexFromBands after changing the bands.")
+
+  //! Pruned at each atmospheric point, as line strengths and widths depend on it
+  std::vector<lbl::band_selection> selection;
+  if (line_pruning != 0.0 and not f_grid.empty()) {
+    evaluated_lines = static_cast<Index>(lbl::prune(selection,
+                                                    absorption_bands,
+                                                    species,
+                                                    atm_point,
+                                                    f_grid.front(),
+                                                    f_grid.back(),
+                                                    line_pruning)
+                                             .nkept);
+  } else {
+    evaluated_lines = 0;
+    for (auto& [key, bnd] : absorption_bands) {
+      if (species == SpeciesEnum::Bath or species == key.Species()) {
+        evaluated_lines += static_cast<Index>(bnd.size());
+      }
+    }
+  }
+
+  std::optional<lbl::band_index> local_index;
+  if (absorption_band_index.size() == 0) {
+    local_index.emplace(absorption_bands, species);
+  }
+
+  //! Shared by all threads, as they all compute the same bands
+  const lbl::band_index& index =
+      local_index ? *local_index : absorption_band_index;
+
   const auto n = arts_omp_get_max_threads();
   if (n == 1 or arts_omp_in_parallel() or n > f_grid.size()) {
     lbl::calculate(pm,
@@ -571,7 +647,10 @@ void propagation_matrixAddLines(PropmatVector& pm,
                    jacobian_targets,
                    species,
                    absorption_bands,
+                   index,
+                   selection,
                    ecs_data,
+                   ecs_tables,
                    atm_point,
                    path_point.los,
                    no_negative_absorption);
@@ -590,7 +669,10 @@ void propagation_matrixAddLines(PropmatVector& pm,
                        jacobian_targets,
                        species,
                        absorption_bands,
+                       index,
+                       selection,
                        ecs_data,
+                       ecs_tables,
                        atm_point,
                        path_point.los,
                        no_negative_absorption);
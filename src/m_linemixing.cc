@@ -77,6 +77,33 @@ void ecs_dataAddMeanAir(LinemixingEcsData& ecs_data,
 
 void ecs_dataInit(LinemixingEcsData& ecs_data) { ecs_data.clear(); }
 
+void ecs_tablesTabulate(LinemixingEcsTables& ecs_tables,
+                        const ArrayOfAbsorptionBand& absorption_bands,
+                        const LinemixingEcsData& ecs_data,
+                        const AtmPoint& atmospheric_point,
+                        const AscendingGrid& temperatures) {
+  ecs_tables = {};
+
+  lbl::voigt::ecs::ComputeData com_data({}, atmospheric_point);
+  for (auto& [key, band] : absorption_bands) {
+    if (band.lineshape != LineByLineLineshape::VP_ECS_MAKAROV and
+        band.lineshape != LineByLineLineshape::VP_ECS_HARTMANN)
+      continue;
+
+    auto it = ecs_data.find(key.Isotopologue());
+    ARTS_USER_ERROR_IF(it == ecs_data.end(),
+                       "No ECS data for isotopologue {}",
+                       key.Isotopologue())
+
+    ecs_tables[key] = lbl::voigt::ecs::tabulate(com_data,
+                                                key,
+                                                band,
+                                                it->second,
+                                                atmospheric_point,
+                                                temperatures);
+  }
+}
+
 void ecs_dataAddMakarov2020(LinemixingEcsData& ecs_data) {
   using enum LineShapeModelType;
   using data = lbl::temperature::data;
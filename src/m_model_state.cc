@@ -1,3 +1,4 @@
+#include <fwd.h>
 #include <jacobian.h>
 
 void model_state_vectorSize(Vector& model_state_vector,
@@ -49,6 +50,24 @@ void absorption_bandsFromModelState(ArrayOfAbsorptionBand& absorption_bands,
   }
 }
 
+void spectral_radiance_operatorFromModelState(
+    SpectralRadianceOperator& spectral_radiance_operator,
+    ArrayOfAbsorptionBand& absorption_bands,
+    const Vector& model_state_vector,
+    const JacobianTargets& jacobian_targets) {
+  ARTS_USER_ERROR_IF(
+      not spectral_radiance_operator.shares_bands(absorption_bands),
+      "The *spectral_radiance_operator* does not use *absorption_bands*")
+
+  lbl::band_changes changes;
+  for (auto& target : jacobian_targets.line()) {
+    target.update(absorption_bands, model_state_vector, changes);
+  }
+
+  spectral_radiance_operator.update_bands(
+      changes.band_indices(absorption_bands));
+}
+
 void model_state_vectorFromBands(Vector& model_state_vector,
                                  const ArrayOfAbsorptionBand& absorption_bands,
                                  const JacobianTargets& jacobian_targets) {
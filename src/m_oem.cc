@@ -19,6 +19,8 @@
 
 #include <workspace.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <string>
 
@@ -108,8 +110,8 @@ void OEM(const Workspace& ws,
   const Index m = measurement_vector.nelem();
 
   // Checks
-  model_state_covariance_matrix.compute_inverse();
-  measurement_vector_error_covariance_matrix.compute_inverse();
+  model_state_covariance_matrix.compute_factors();
+  measurement_vector_error_covariance_matrix.compute_factors();
 
   OEM_checks(ws,
              model_state_vector,
@@ -382,6 +384,253 @@ void OEM(const Workspace& ws,
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void OEMMatrixFree(
+    const Workspace& ws,
+    Vector& model_state_vector,
+    Vector& measurement_vector_fitted,
+    Vector& oem_diagnostics,
+    Vector& lm_ga_history,
+    Vector& oem_performance,
+    ArrayOfString& errors,
+    const Vector& model_state_vector_apriori,
+    const CovarianceMatrix& model_state_covariance_matrix,
+    const Vector& measurement_vector,
+    const CovarianceMatrix& measurement_vector_error_covariance_matrix,
+    const Agenda& inversion_iterate_agenda,
+    const Agenda& measurement_jacobian_product_agenda,
+    const String& method,
+    const Numeric& max_start_cost,
+    const Vector& model_state_covariance_matrix_normalization,
+    const Index& max_iter,
+    const Numeric& stop_dx,
+    const Vector& lm_ga_settings,
+    const Index& display_progress) {
+  // Main sizes
+  const Index n = model_state_covariance_matrix.nrows();
+  const Index m = measurement_vector.nelem();
+
+  // Checks
+  ARTS_USER_ERROR_IF(model_state_vector_apriori.nelem() != n,
+                     "Inconsistency in size between *model_state_vector_apriori* "
+                     "and *model_state_covariance_matrix*.");
+  ARTS_USER_ERROR_IF(
+      (model_state_vector.nelem() != n) && (model_state_vector.nelem() != 0),
+      "The length of *model_state_vector* must be either the same as "
+      "*model_state_vector_apriori* or 0.");
+  ARTS_USER_ERROR_IF(
+      (measurement_vector_fitted.nelem() != m) &&
+          (measurement_vector_fitted.nelem() != 0),
+      "The length of *measurement_vector_fitted* must be either the same as "
+      "*measurement_vector* or 0.");
+  ARTS_USER_ERROR_IF(measurement_vector_error_covariance_matrix.nrows() != m,
+                     "Inconsistency in size between *measurement_vector* and "
+                     "*measurement_vector_error_covariance_matrix*.");
+  ARTS_USER_ERROR_IF(!(method == "li_cg" || method == "gn_cg" ||
+                       method == "lm_cg" || method == "ml_cg"),
+                     "Valid options for *method* are \"li_cg\", \"gn_cg\" "
+                     "and \"lm_cg\" or \"ml_cg\", not \"{}\".",
+                     method);
+  ARTS_USER_ERROR_IF(
+      !(model_state_covariance_matrix_normalization.nelem() == 0 ||
+        model_state_covariance_matrix_normalization.nelem() == n),
+      "The vector *x_norm* must have length 0 or match *covmat_sx*.");
+  ARTS_USER_ERROR_IF(model_state_covariance_matrix_normalization.nelem() > 0 &&
+                         min(model_state_covariance_matrix_normalization) <= 0,
+                     "All values in *x_norm* must be > 0.");
+  ARTS_USER_ERROR_IF(max_iter <= 0, "The argument *max_iter* must be > 0.");
+  ARTS_USER_ERROR_IF(stop_dx <= 0, "The argument *stop_dx* must be > 0.");
+  if ((method == "lm_cg") || (method == "ml_cg")) {
+    ARTS_USER_ERROR_IF(lm_ga_settings.nelem() != 6,
+                       "When using \"lm_cg\", *lm_ga_setings* must be a "
+                       "vector of length 6.");
+    ARTS_USER_ERROR_IF(min(lm_ga_settings) < 0,
+                       "The vector *lm_ga_setings* can not contain any "
+                       "negative value.");
+  }
+  ARTS_USER_ERROR_IF(display_progress < 0 || display_progress > 1,
+                     "Valid options for *display_progress* are 0 and 1.");
+
+  model_state_covariance_matrix.compute_factors();
+  measurement_vector_error_covariance_matrix.compute_factors();
+
+  // Size diagnostic output and init with NaNs
+  oem_diagnostics.resize(5);
+  oem_diagnostics = NAN;
+  oem_performance.resize(4);
+  oem_performance = NAN;
+  if (method == "lm_cg" || method == "ml_cg") {
+    lm_ga_history.resize(max_iter + 1);
+    lm_ga_history = NAN;
+  } else {
+    lm_ga_history.resize(0);
+  }
+
+  // Start from the a priori, unless a start vector is given
+  if (model_state_vector.nelem() != n) {
+    model_state_vector = model_state_vector_apriori;
+    measurement_vector_fitted.resize(0);
+  }
+
+  if (measurement_vector_fitted.nelem() == 0) {
+    Matrix dummy;
+    inversion_iterate_agendaExecute(ws,
+                                    measurement_vector_fitted,
+                                    dummy,
+                                    model_state_vector,
+                                    0,
+                                    0,
+                                    inversion_iterate_agenda);
+  }
+
+  ARTS_USER_ERROR_IF(
+      measurement_vector_fitted.nelem() not_eq m,
+      "Mismatch between simulated y and input y.\n"
+      "Input y is size {} but simulated y is {}\n",
+      m,
+      measurement_vector_fitted.nelem())
+
+  // Start value of cost function
+  Vector dy   = measurement_vector;
+  dy         -= measurement_vector_fitted;
+  Vector sdy  = measurement_vector;
+  mult_inv(ExhaustiveMatrixView{sdy},
+           measurement_vector_error_covariance_matrix,
+           ExhaustiveMatrixView{dy});
+  Vector dx   = model_state_vector;
+  dx         -= model_state_vector_apriori;
+  Vector sdx  = model_state_vector;
+  mult_inv(ExhaustiveMatrixView{sdx},
+           model_state_covariance_matrix,
+           ExhaustiveMatrixView{dx});
+  const Numeric cost_start =
+      (dx * sdx + dy * sdy) / static_cast<Numeric>(m);
+  oem_diagnostics[1] = cost_start;
+
+  if (max_start_cost > 0 && cost_start > max_start_cost) {
+    oem_diagnostics[0] = 99;
+    if (display_progress) {
+      std::cout << "\n   No OEM inversion, too high start cost:\n"
+                << "        Set limit : " << max_start_cost << std::endl
+                << "      Found value : " << cost_start << std::endl
+                << std::endl;
+    }
+    return;
+  }
+
+  bool apply_norm = false;
+  oem::Matrix T{};
+  if (model_state_covariance_matrix_normalization.nelem() == n) {
+    T.resize(n, n);
+    T *= 0.0;
+    for (Index i = 0; i < n; i++) {
+      T(i, i) = model_state_covariance_matrix_normalization[i];
+    }
+    apply_norm = true;
+  }
+
+  oem::CovarianceMatrix Se(measurement_vector_error_covariance_matrix),
+      Sa(model_state_covariance_matrix);
+  oem::Vector xa_oem(model_state_vector_apriori), y_oem(measurement_vector),
+      x_oem(model_state_vector);
+  oem::ProductAgendaWrapper aw(&ws,
+                               (unsigned int)m,
+                               (unsigned int)n,
+                               measurement_vector_fitted,
+                               &inversion_iterate_agenda,
+                               &measurement_jacobian_product_agenda);
+  oem::OEM_STANDARD<oem::ProductAgendaWrapper> oem(aw, xa_oem, Sa, Se);
+  int oem_verbosity = static_cast<int>(display_progress);
+
+  const auto t1 = std::chrono::steady_clock::now();
+  try {
+    oem::CG cg(T, apply_norm, 1e-10, 0);
+    if (method == "li_cg") {
+      oem::GN_CG gn(stop_dx, 1, cg);  // Linear case, only one step.
+      oem_diagnostics[0] = oem.compute<oem::GN_CG, oem::ArtsLog>(
+          x_oem, y_oem, gn, oem_verbosity, lm_ga_history, true);
+    } else if (method == "gn_cg") {
+      oem::GN_CG gn(stop_dx, (unsigned int)max_iter, cg);
+      oem_diagnostics[0] = oem.compute<oem::GN_CG, oem::ArtsLog>(
+          x_oem, y_oem, gn, oem_verbosity, lm_ga_history);
+    } else {
+      Sparse diagonal =
+          Sparse::diagonal(model_state_covariance_matrix.inverse_diagonal());
+      CovarianceMatrix SaDiag{};
+      SaDiag.add_correlation_inverse(Block(Range(0, n),
+                                           Range(0, n),
+                                           std::make_pair(0, 0),
+                                           std::make_shared<Sparse>(diagonal)));
+      oem::LM_CG lm(SaDiag, cg);
+
+      lm.set_maximum_iterations((unsigned int)max_iter);
+      lm.set_lambda(lm_ga_settings[0]);
+      lm.set_lambda_decrease(lm_ga_settings[1]);
+      lm.set_lambda_increase(lm_ga_settings[2]);
+      lm.set_lambda_threshold(lm_ga_settings[3]);
+      lm.set_lambda_maximum(lm_ga_settings[4]);
+
+      oem_diagnostics[0] = oem.compute<oem::LM_CG&, oem::ArtsLog>(
+          x_oem, y_oem, lm, oem_verbosity, lm_ga_history);
+      if (lm.get_lambda() > lm.get_lambda_maximum()) {
+        oem_diagnostics[0] = 2;
+      }
+    }
+
+    oem_diagnostics[2] = oem.cost / static_cast<Numeric>(m);
+    oem_diagnostics[3] = oem.cost_y / static_cast<Numeric>(m);
+    oem_diagnostics[4] = static_cast<Numeric>(oem.iterations);
+  } catch (const std::exception& e) {
+    oem_diagnostics[0]           = 9;
+    oem_diagnostics[2]           = oem.cost;
+    oem_diagnostics[3]           = oem.cost_y;
+    oem_diagnostics[4]           = static_cast<Numeric>(oem.iterations);
+    x_oem                       *= NAN;
+    std::vector<std::string> sv  = oem::handle_nested_exception(e);
+    for (auto& s : sv) {
+      std::stringstream ss{s};
+      std::string t{};
+      while (std::getline(ss, t)) {
+        errors.push_back(t.c_str());
+      }
+    }
+  }
+  const std::chrono::duration<double> total =
+      std::chrono::steady_clock::now() - t1;
+
+  model_state_vector        = x_oem;
+  measurement_vector_fitted = aw.get_measurement_vector();
+
+  const oem::JacobianProductStatistics& stats = aw.statistics();
+  oem_performance[0] = static_cast<Numeric>(stats.nproducts);
+  oem_performance[1] = static_cast<Numeric>(stats.ntransposed);
+  oem_performance[2] = stats.time.count();
+  oem_performance[3] =
+      total.count() / static_cast<Numeric>(std::max<Index>(oem.iterations, 1));
+
+  if (display_progress) {
+    // These are estimates from the sizes, not measured memory use: the CG
+    // iteration holds about 8 vectors of size n or m at once
+    constexpr Numeric MiB = 1024.0 * 1024.0;
+    const Numeric dense   = static_cast<Numeric>(m * n * sizeof(Numeric)) / MiB;
+    const Numeric vectors =
+        static_cast<Numeric>(8 * (m + n) * sizeof(Numeric)) / MiB;
+    std::cout << "Jacobian products K v:                        "
+              << stats.nproducts << std::endl
+              << "Jacobian products K^T w:                      "
+              << stats.ntransposed << std::endl
+              << "Time in measurement_jacobian_product_agenda:  "
+              << stats.time.count() << std::endl
+              << "Time per iteration:                           "
+              << oem_performance[3] << std::endl
+              << "Estimated size of the CG vectors [MiB]:       " << vectors
+              << std::endl
+              << "Size a dense Jacobian would have [MiB]:       " << dense
+              << std::endl
+              << std::endl;
+  }
+}
+
 void measurement_vector_error_covariance_matrix_observation_systemCalc(
     Matrix& measurement_vector_error_covariance_matrix_observation_system,
     const Matrix& measurement_gain_matrix,
@@ -178,6 +178,67 @@ void ray_path_propagation_matrixFromPath(
 }
 ARTS_METHOD_ERROR_CATCH
 
+void propagation_matrix_profileFromAltitudeGrid(
+    const Workspace &ws,
+    ArrayOfPropmatVector &propagation_matrix_profile,
+    AscendingGrid &propagation_matrix_profile_altitude,
+    const Agenda &propagation_matrix_agenda,
+    const AscendingGrid &frequency_grid,
+    const AtmField &atmospheric_field,
+    const AscendingGrid &altitude_grid,
+    const Numeric &latitude,
+    const Numeric &longitude) try {
+  const Size nalt = altitude_grid.size();
+  ARTS_USER_ERROR_IF(nalt < 2, "Need at least two altitudes in altitude_grid")
+
+  propagation_matrix_profile_altitude = altitude_grid;
+  propagation_matrix_profile.resize(nalt);
+
+  const JacobianTargets jacobian_targets{};
+
+  String error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Size ialt = 0; ialt < nalt; ialt++) {
+    try {
+      // Looking straight up, so there are no wind or Zeeman effects along the line-of-sight
+      const PropagationPathPoint ray_path_point{
+          .pos_type = PathPositionType::atm,
+          .los_type = PathPositionType::atm,
+          .pos      = Vector3{altitude_grid[ialt], latitude, longitude},
+          .los      = Vector2{0, 0}};
+      const AtmPoint atmospheric_point{
+          atmospheric_field.at(altitude_grid[ialt], latitude, longitude)};
+
+      StokvecVector source_vector_nonlte;
+      PropmatMatrix propagation_matrix_jacobian;
+      StokvecMatrix source_vector_nonlte_jacobian;
+      propagation_matrix_agendaExecute(ws,
+                                       propagation_matrix_profile[ialt],
+                                       source_vector_nonlte,
+                                       propagation_matrix_jacobian,
+                                       source_vector_nonlte_jacobian,
+                                       jacobian_targets,
+                                       {},
+                                       frequency_grid,
+                                       ray_path_point,
+                                       atmospheric_point,
+                                       propagation_matrix_agenda);
+
+      ARTS_USER_ERROR_IF(
+          propagation_matrix_profile[ialt].size() != frequency_grid.size(),
+          "Bad size of propagation matrix at altitude {} m",
+          altitude_grid[ialt])
+    } catch (const std::exception &e) {
+#pragma omp critical
+      error += e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(error.size(), "{}", error)
+}
+ARTS_METHOD_ERROR_CATCH
+
 void ray_path_zeeman_magnetic_fieldFromPath(
     ArrayOfVector3 &ray_path_zeeman_magnetic_field,
     const ArrayOfPropagationPathPoint &ray_path,
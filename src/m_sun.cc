@@ -5,6 +5,7 @@
 #include <workspace.h>
 
 #include <algorithm>
+#include <optional>
 
 #include "arts_omp.h"
 #include "atm.h"
@@ -119,6 +120,53 @@ void sun_pathFromObserverAgenda(const Workspace& ws,
                 just_hit);
 }
 
+namespace {
+/*! Find the sun paths of the points [i0, i1) of a ray path
+
+Each search starts from the line-of-sight found for the previous point,
+since neighbouring points have nearly the same line-of-sight to the sun.
+The first point starts from the geometric line-of-sight to the sun.
+*/
+template <typename SunPath>
+void sun_paths_along_path(const Workspace& ws,
+                          SunPath&& sun_path,
+                          const SurfaceField& surface_field,
+                          const Agenda& ray_path_observer_agenda,
+                          const ArrayOfPropagationPathPoint& ray_path,
+                          const Sun& sun,
+                          const Numeric angle_cut,
+                          const Index refinements,
+                          const bool just_hit,
+                          const Size i0,
+                          const Size i1) {
+  std::optional<Vector2> los{};
+  for (Size i = i0; i < i1; ++i) {
+    los = find_sun_path(ws,
+                        sun_path(i),
+                        sun,
+                        ray_path_observer_agenda,
+                        surface_field,
+                        ray_path[i].pos,
+                        angle_cut,
+                        refinements,
+                        just_hit,
+                        los);
+  }
+}
+
+/*! The number of path points searched in sequence from one cold start
+
+The blocks do not depend on the number of threads, so neither does the
+start line-of-sight of any point nor the result.
+*/
+constexpr Size path_block_size = 16;
+
+//! The number of blocks of np path points
+constexpr Size path_blocks(const Size np) {
+  return (np + path_block_size - 1) / path_block_size;
+}
+}  // namespace
+
 void ray_path_sun_pathFromPathObserver(
     const Workspace& ws,
     ArrayOfArrayOfPropagationPathPoint& ray_path_sun_path,
@@ -131,45 +179,35 @@ void ray_path_sun_pathFromPathObserver(
     const Index& just_hit) {
   ARTS_USER_ERROR_IF(angle_cut < 0.0, "angle_cut must be positive")
 
-  const Size np = ray_path.size();
+  const Size np      = ray_path.size();
+  const Size nblocks = path_blocks(np);
 
   ray_path_sun_path.resize(np);
-  if (arts_omp_in_parallel() and
-      static_cast<Index>(np) >= arts_omp_get_max_threads()) {
-    for (Size i = 0; i < np; ++i) {
-      sun_pathFromObserverAgenda(ws,
-                                 ray_path_sun_path[i],
-                                 surface_field,
-                                 ray_path_observer_agenda,
-                                 sun,
-                                 ray_path[i].pos,
-                                 angle_cut,
-                                 refinements,
-                                 just_hit);
-    }
-  } else {
-    String error{};
 
-#pragma omp parallel for
-    for (Size i = 0; i < np; ++i) {
-      try {
-        sun_pathFromObserverAgenda(ws,
-                                   ray_path_sun_path[i],
-                                   surface_field,
-                                   ray_path_observer_agenda,
-                                   sun,
-                                   ray_path[i].pos,
-                                   angle_cut,
-                                   refinements,
-                                   just_hit);
-      } catch (const std::exception& e) {
+  String error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel() and nblocks > 1)
+  for (Size c = 0; c < nblocks; ++c) {
+    try {
+      sun_paths_along_path(
+          ws,
+          [&](Size i) -> auto& { return ray_path_sun_path[i]; },
+          surface_field,
+          ray_path_observer_agenda,
+          ray_path,
+          sun,
+          angle_cut,
+          refinements,
+          just_hit,
+          c * path_block_size,
+          std::min(np, (c + 1) * path_block_size));
+    } catch (const std::exception& e) {
 #pragma omp critical
-        error += e.what();
-      }
+      error += e.what();
     }
-
-    ARTS_USER_ERROR_IF(error.size(), "{}", error)
   }
+
+  ARTS_USER_ERROR_IF(error.size(), "{}", error)
 }
 
 void ray_path_suns_pathFromPathObserver(
@@ -184,52 +222,40 @@ void ray_path_suns_pathFromPathObserver(
     const Index& just_hit) {
   ARTS_USER_ERROR_IF(angle_cut < 0.0, "angle_cut must be positive")
 
-  const Size np    = ray_path.size();
-  const Size nsuns = suns.size();
+  const Size np      = ray_path.size();
+  const Size nsuns   = suns.size();
+  const Size nblocks = path_blocks(np);
 
   ray_path_suns_path.resize(np);
   for (auto& p : ray_path_suns_path) p.resize(nsuns);
 
-  if (arts_omp_in_parallel() and
-      static_cast<Index>(np * nsuns) >= arts_omp_get_max_threads()) {
-    for (Size i = 0; i < np; ++i) {
-      for (Size j = 0; j < nsuns; ++j) {
-        sun_pathFromObserverAgenda(ws,
-                                   ray_path_suns_path[i][j],
-                                   surface_field,
-                                   ray_path_observer_agenda,
-                                   suns[j],
-                                   ray_path[i].pos,
-                                   angle_cut,
-                                   refinements,
-                                   just_hit);
-      }
-    }
-  } else {
-    String error{};
+  String error{};
 
-#pragma omp parallel for collapse(2)
-    for (Size i = 0; i < np; ++i) {
-      for (Size j = 0; j < nsuns; ++j) {
-        try {
-          sun_pathFromObserverAgenda(ws,
-                                     ray_path_suns_path[i][j],
-                                     surface_field,
-                                     ray_path_observer_agenda,
-                                     suns[j],
-                                     ray_path[i].pos,
-                                     angle_cut,
-                                     refinements,
-                                     just_hit);
-        } catch (const std::exception& e) {
+#pragma omp parallel for collapse(2) if (not arts_omp_in_parallel() and \
+                                            nsuns * nblocks > 1)
+  for (Size j = 0; j < nsuns; ++j) {
+    for (Size c = 0; c < nblocks; ++c) {
+      try {
+        sun_paths_along_path(
+            ws,
+            [&](Size i) -> auto& { return ray_path_suns_path[i][j]; },
+            surface_field,
+            ray_path_observer_agenda,
+            ray_path,
+            suns[j],
+            angle_cut,
+            refinements,
+            just_hit,
+            c * path_block_size,
+            std::min(np, (c + 1) * path_block_size));
+      } catch (const std::exception& e) {
 #pragma omp critical
-          error += e.what();
-        }
+        error += e.what();
       }
     }
-
-    ARTS_USER_ERROR_IF(error.size(), "{}", error)
   }
+
+  ARTS_USER_ERROR_IF(error.size(), "{}", error)
 }
 
 void propagation_matrix_scatteringInit(
@@ -520,3 +546,214 @@ void ray_path_spectral_radiance_scatteringSunsFirstOrderRayleigh(
   ARTS_USER_ERROR_IF(error.size(), "{}", error)
 }
 ARTS_METHOD_ERROR_CATCH
+
+namespace {
+/*! Linear interpolation of the propagation matrix profile in altitude
+
+@param[out] k The propagation matrix at the altitude
+@param[in] propagation_matrix_profile As WSV
+@param[in] propagation_matrix_profile_altitude As WSV
+@param[in] altitude The altitude [m]
+*/
+void interp_propagation_matrix_profile(
+    PropmatVector& k,
+    const ArrayOfPropmatVector& propagation_matrix_profile,
+    const AscendingGrid& propagation_matrix_profile_altitude,
+    const Numeric altitude) {
+  const auto& alt = propagation_matrix_profile_altitude;
+
+  ARTS_USER_ERROR_IF(
+      altitude < alt.front() or altitude > alt.back(),
+      "Altitude {} m is outside the range [{}, {}] m of propagation_matrix_profile_altitude",
+      altitude,
+      alt.front(),
+      alt.back())
+
+  const Size i = std::clamp<Size>(
+      std::distance(alt.begin(), std::ranges::upper_bound(alt, altitude)),
+      1,
+      alt.size() - 1);
+  const Numeric w = (altitude - alt[i - 1]) / (alt[i] - alt[i - 1]);
+
+  const auto& k1 = propagation_matrix_profile[i - 1];
+  const auto& k2 = propagation_matrix_profile[i];
+  for (Index iv = 0; iv < k.size(); iv++) {
+    k[iv] = (1.0 - w) * k1[iv] + w * k2[iv];
+  }
+}
+
+/*! The cumulative transmission from the front to the back of a sun path
+
+@param[out] transmission_matrix The transmission matrix [nf]
+@param[inout] layer_transmission_matrix Buffer for a layer's transmission matrix [nf]
+@param[inout] k1 Buffer for the propagation matrix [nf]
+@param[inout] k2 Buffer for the propagation matrix [nf]
+@param[in] sun_path As WSV
+@param[in] propagation_matrix_profile As WSV
+@param[in] propagation_matrix_profile_altitude As WSV
+@param[in] ellipsoid The ellipsoid of the surface
+*/
+void sun_path_transmission(
+    MuelmatVector& transmission_matrix,
+    MuelmatVector& layer_transmission_matrix,
+    PropmatVector& k1,
+    PropmatVector& k2,
+    const ArrayOfPropagationPathPoint& sun_path,
+    const ArrayOfPropmatVector& propagation_matrix_profile,
+    const AscendingGrid& propagation_matrix_profile_altitude,
+    const Vector2 ellipsoid) {
+  transmission_matrix = 1;
+
+  if (sun_path.empty()) return;
+
+  interp_propagation_matrix_profile(k1,
+                                    propagation_matrix_profile,
+                                    propagation_matrix_profile_altitude,
+                                    sun_path.front().pos[0]);
+
+  for (Size ip = 1; ip < sun_path.size(); ip++) {
+    interp_propagation_matrix_profile(k2,
+                                      propagation_matrix_profile,
+                                      propagation_matrix_profile_altitude,
+                                      sun_path[ip].pos[0]);
+
+    rtepack::two_level_exp(
+        layer_transmission_matrix,
+        k1,
+        k2,
+        path::distance(sun_path[ip - 1].pos, sun_path[ip].pos, ellipsoid));
+    for (Index iv = 0; iv < transmission_matrix.size(); iv++) {
+      transmission_matrix[iv] *= layer_transmission_matrix[iv];
+    }
+
+    std::swap(k1, k2);
+  }
+}
+}  // namespace
+
+void ray_path_spectral_radiance_scatteringSunsFirstOrderRayleighFromProfile(
+    // [np, nf]:
+    ArrayOfStokvecVector& ray_path_spectral_radiance_scattering,
+    // [np, nf]:
+    const ArrayOfPropmatVector& ray_path_propagation_matrix_scattering,
+    // [np]:
+    const ArrayOfPropagationPathPoint& ray_path,
+    // [np, suns, np2]:
+    const ArrayOfArrayOfArrayOfPropagationPathPoint& ray_path_suns_path,
+    // [nsuns]:
+    const ArrayOfSun& suns,
+    // [nf]:
+    const AscendingGrid& frequency_grid,
+    const SurfaceField& surface_field,
+    // [nalt, nf]:
+    const ArrayOfPropmatVector& propagation_matrix_profile,
+    // [nalt]:
+    const AscendingGrid& propagation_matrix_profile_altitude,
+    const Numeric& depolarization_factor) try {
+  const Size np = ray_path.size();
+  ARTS_USER_ERROR_IF(
+      np != ray_path_propagation_matrix_scattering.size(),
+      "Bad ray_path_propagation_matrix_scattering: incorrect number of path points")
+  ARTS_USER_ERROR_IF(np != ray_path_suns_path.size(),
+                     "Bad ray_path_suns_path: incorrect number of path points")
+
+  const Size nsuns = suns.size();
+  ARTS_USER_ERROR_IF(
+      std::ranges::any_of(ray_path_suns_path,
+                          Cmp::ne(nsuns),
+                          &ArrayOfArrayOfPropagationPathPoint::size),
+      "Bad ray_path_suns_path: incorrect number of suns")
+
+  const Index nf = frequency_grid.size();
+  ARTS_USER_ERROR_IF(
+      std::ranges::any_of(ray_path_propagation_matrix_scattering,
+                          Cmp::ne(nf),
+                          &PropmatVector::size),
+      "Bad ray_path_propagation_matrix_scattering: incorrect number of frequencies")
+
+  ARTS_USER_ERROR_IF(
+      propagation_matrix_profile.size() !=
+              propagation_matrix_profile_altitude.size() or
+          propagation_matrix_profile_altitude.size() < 2,
+      "Bad propagation_matrix_profile: must have the size of propagation_matrix_profile_altitude, which must be at least 2")
+  ARTS_USER_ERROR_IF(
+      std::ranges::any_of(
+          propagation_matrix_profile, Cmp::ne(nf), &PropmatVector::size),
+      "Bad propagation_matrix_profile: incorrect number of frequencies")
+
+  ray_path_spectral_radiance_scattering.resize(np);
+  for (auto& p : ray_path_spectral_radiance_scattering) {
+    p.resize(nf);
+    p = 0;
+  }
+
+  StokvecVector spectral_radiance_background(nf);
+  MuelmatVector transmission_matrix(nf), layer_transmission_matrix(nf);
+  PropmatVector k1(nf), k2(nf);
+
+  String error{};
+
+#pragma omp parallel for firstprivate(spectral_radiance_background, \
+                                          transmission_matrix,          \
+                                          layer_transmission_matrix,    \
+                                          k1,                           \
+                                          k2) if (not arts_omp_in_parallel())
+  for (Size ip = 0; ip < np; ip++) {
+    try {
+      auto& spectral_radiance_scattered =
+          ray_path_spectral_radiance_scattering[ip];
+
+      const auto& propagation_matrix_scattering =
+          ray_path_propagation_matrix_scattering[ip];
+      const auto& ray_path_point = ray_path[ip];
+      const auto& suns_path      = ray_path_suns_path[ip];
+
+      for (Size isun = 0; isun < nsuns; isun++) {
+        const auto& sun_path = suns_path[isun];
+        const auto& sun      = suns[isun];
+
+        ARTS_USER_ERROR_IF(sun_path.empty(), "Empty sun path")
+
+        spectral_radianceSunOrCosmicBackground(spectral_radiance_background,
+                                               frequency_grid,
+                                               sun_path,
+                                               sun,
+                                               surface_field);
+
+        sun_path_transmission(transmission_matrix,
+                              layer_transmission_matrix,
+                              k1,
+                              k2,
+                              sun_path,
+                              propagation_matrix_profile,
+                              propagation_matrix_profile_altitude,
+                              surface_field.ellipsoid);
+
+        // irradiance ratio
+        const Numeric radiance_2_irradiance =
+            pi * suns[isun].sin_alpha_squared(sun_path.back().pos,
+                                              surface_field.ellipsoid);
+
+        const Muelmat scatmat =
+            rtepack::rayleigh_scattering(sun_path.front().los,
+                                         ray_path_point.los,
+                                         depolarization_factor) /
+            (4 * pi);
+
+        // Add the source to the target
+        for (Index iv = 0; iv < nf; iv++) {
+          spectral_radiance_scattered[iv] +=
+              propagation_matrix_scattering[iv] * scatmat *
+              radiance_2_irradiance *
+              (transmission_matrix[iv] * spectral_radiance_background[iv]);
+        }
+      }
+    } catch (const std::exception& e) {
+#pragma omp critical
+      error += e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(error.size(), "{}", error)
+}
+ARTS_METHOD_ERROR_CATCH
@@ -194,7 +194,10 @@ void agenda_checker(std::ostream& os, const std::string& name, bool array) {
 void workspace_setup_and_exec(std::ostream& os,
                               const std::string& name,
                               const auto_ag& ag) {
-  os << "\n  Workspace _lws{WorkspaceInitialization::Empty};\n\n";
+  os << "\n  // Reuse the storage of earlier calls on this thread\n"
+        "  static thread_local AgendaWorkspacePool _pool;\n"
+        "  auto _fork = _pool.acquire();\n"
+        "  Workspace& _lws = _fork.ws();\n\n";
 
   os << "  // Always share original data here\n";
 
@@ -205,12 +208,12 @@ void workspace_setup_and_exec(std::ostream& os,
   }
 
   os << "\n"
-        "  // Copy and share data from old workspace (this will copy pure inputs that are modified)\n  ";
-  os << name;
+        "  // Copy and share data from old workspace (this will copy pure inputs that are modified)\n";
+  os << "  _fork.copy_workspace(" << name;
   if (ag.array) {
     os << "[agenda_array_index]";
   }
-  os << ".copy_workspace(_lws, ws);\n";
+  os << ", ws);\n";
 
   os << "\n  // Modified data must be copied here\n";
   for (auto& o : ag.o) {
@@ -218,11 +221,11 @@ void workspace_setup_and_exec(std::ostream& os,
        << o.second << ");\n";
   }
 
-  os << "\n  // Run all the methods\n  " << name;
+  os << "\n  // Run all the methods\n  _fork.execute(" << name;
   if (ag.array) {
     os << "[agenda_array_index]";
   }
-  os << ".execute(_lws);\n";
+  os << ");\n";
 }
 
 void implementation(std::ostream& os) {
@@ -308,6 +308,15 @@ template <> {}& Workspace::get<{}>(const std::string& name) const try {{
 }} catch (std::exception& e) {{
   throw std::runtime_error(var_string("Error getting workspace variable ", '"', name, '"', ":\n", e.what()));
 }}
+template <> {}& Workspace::get_or<{}>(const WorkspaceSlot& slot) {{
+  if (Wsv* ptr = find(slot); ptr != nullptr) return ptr->template get<{}>();
+  return get_or<{}>(slot.name);
+}}
+template <> {}& Workspace::get<{}>(const WorkspaceSlot& slot) try {{
+  return share(slot).get<{}>();
+}} catch (std::exception& e) {{
+  throw std::runtime_error(var_string("Error getting workspace variable ", '"', slot.name, '"', ":\n", e.what()));
+}}
 )",
                       group,
                       group,
@@ -319,6 +328,13 @@ template <> {}& Workspace::get<{}>(const std::string& name) const try {{
                       group,
                       group,
                       group,
+                      group,
+                      group,
+                      group,
+                      group,
+                      group,
+                      group,
+                      group,
                       group);
   }
 }
@@ -231,13 +231,15 @@ void header(std::ostream& os) try {
 
 #include <auto_wsg.h>
 
+#include "workspace_slot.h"
+
 class Workspace;
 
 struct WorkspaceMethodRecord {
   std::vector<std::string> out;
   std::vector<std::string> in;
   std::unordered_map<std::string, Wsv> defs;
-  std::function<void(Workspace&, const std::vector<std::string>&, const std::vector<std::string>&)> func;
+  std::function<void(Workspace&, const std::vector<WorkspaceSlot>&, const std::vector<WorkspaceSlot>&)> func;
 };
 
 const std::unordered_map<std::string, WorkspaceMethodRecord>& workspace_methods();
@@ -275,7 +277,7 @@ void call_function(std::ostream& os,
 
     // MOSTLY COPY-PASTA
 
-    os << "[](Workspace& ws [[maybe_unused]], const std::vector<std::string>& out [[maybe_unused]], const std::vector<std::string>& in [[maybe_unused]]) {\n";
+    os << "[](Workspace& ws [[maybe_unused]], const std::vector<WorkspaceSlot>& out [[maybe_unused]], const std::vector<WorkspaceSlot>& in [[maybe_unused]]) {\n";
 
     bool first = true;
 
@@ -350,7 +352,7 @@ void call_function(std::ostream& os,
     }
 
   } else if (wsmr.has_overloads()) {
-    os << "[map = std::unordered_map<std::string, std::function<void(Workspace&, const std::vector<std::string>&, const std::vector<std::string>&)>>{\n";
+    os << "[map = std::unordered_map<std::string, std::function<void(Workspace&, const std::vector<WorkspaceSlot>&, const std::vector<WorkspaceSlot>&)>>{\n";
 
     const auto ol = overloads(wsmr);
 
@@ -386,7 +388,7 @@ void call_function(std::ostream& os,
       os << "}";
     }
 
-    os << R"--(}] (Workspace& ws [[maybe_unused]],const std::vector<std::string>& out [[maybe_unused]], const std::vector<std::string>& in [[maybe_unused]]) {
+    os << R"--(}] (Workspace& ws [[maybe_unused]],const std::vector<WorkspaceSlot>& out [[maybe_unused]], const std::vector<WorkspaceSlot>& in [[maybe_unused]]) {
       const auto& func = map.at(var_string()--";
 
     bool final_first = true;
@@ -414,7 +416,7 @@ void call_function(std::ostream& os,
     }
 )--";
   } else {
-    os << "[](Workspace& ws [[maybe_unused]], const std::vector<std::string>& out [[maybe_unused]], const std::vector<std::string>& in [[maybe_unused]]) {\n";
+    os << "[](Workspace& ws [[maybe_unused]], const std::vector<WorkspaceSlot>& out [[maybe_unused]], const std::vector<WorkspaceSlot>& in [[maybe_unused]]) {\n";
 
     bool first = true;
     os << "      " << name << "(";
@@ -12,6 +12,11 @@
 
 #include "nc_io.h"
 
+#include <file.h>
+
+#include <algorithm>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////
 //   Default file name
 ////////////////////////////////////////////////////////////////////////////
@@ -65,6 +70,10 @@ void nca_def_dim(const int ncid, const String &name, const Index size,
 
 //! Define NetCDF variable.
 /**
+ Variables larger than nca_chunk_min_bytes are chunked and deflated, see
+ nca_chunk_shape.  Smaller variables are stored contiguously, since the
+ chunk index and the compression would only add to their size.
+
  \param[in]  ncid   NetCDF file descriptor
  \param[in]  name   Variable name in NetCDF file
  \param[in]  type   NetCDF type
@@ -79,6 +88,49 @@ void nca_def_var(const int ncid, const String &name, const nc_type type,
   int retval;
   if ((retval = nc_def_var(ncid, name.c_str(), type, ndims, dims, varid)))
     nca_error(retval, "nc_def_var");
+
+  if (ndims == 0) return;
+
+  size_t elem_size;
+  if ((retval = nc_inq_type(ncid, type, nullptr, &elem_size)))
+    nca_error(retval, "nc_inq_type");
+
+  std::vector<size_t> chunks(ndims);
+  size_t nbytes = elem_size;
+  for (int i = 0; i < ndims; i++) {
+    if ((retval = nc_inq_dimlen(ncid, dims[i], &chunks[i])))
+      nca_error(retval, "nc_inq_dimlen");
+    nbytes *= chunks[i];
+  }
+  if (nbytes <= nca_chunk_min_bytes) return;
+
+  nca_chunk_shape(chunks, elem_size);
+
+  if ((retval = nc_def_var_chunking(ncid, *varid, NC_CHUNKED, chunks.data())))
+    nca_error(retval, "nc_def_var_chunking");
+  if ((retval = nc_def_var_deflate(ncid, *varid, 1, 1, 1)))
+    nca_error(retval, "nc_def_var_deflate");
+}
+
+//! Chunk shape of a NetCDF variable.
+/**
+ The chunks are at most about 1 MiB large.  The innermost dimensions are
+ kept whole as long as they fit, and the outer dimensions are split first,
+ so that a hyperslab of a few outer indices, e.g., one frequency window or
+ one profile, only needs to decompress a few chunks.
+
+ \param[inout] shape      The dimension sizes in, the chunk sizes out
+ \param[in]    elem_size  The size of an element in bytes
+ */
+void nca_chunk_shape(std::span<size_t> shape, const size_t elem_size) {
+  constexpr size_t max_chunk_bytes = 1 << 20;
+
+  size_t inner = elem_size;
+  for (auto it = shape.rbegin(); it != shape.rend(); ++it) {
+    const size_t n = std::max<size_t>(1, max_chunk_bytes / inner);
+    *it = std::max<size_t>(1, std::min(*it, n));
+    inner *= *it;
+  }
 }
 
 //! Define NetCDF dimensions and variable for an ArrayOfIndex.
@@ -279,6 +331,35 @@ void nca_get_data(const int ncid, const String &name, size_t start,
     nca_error(retval, "nc_get_var(" + name + ")");
 }
 
+//! Read a hyperslab of a variable of type double from NetCDF file.
+/**
+ \param[in]  ncid   NetCDF file descriptor
+ \param[in]  name   Variable name in NetCDF file
+ \param[in]  start  The first index of the hyperslab in each dimension
+ \param[in]  count  The size of the hyperslab in each dimension
+ \param[out] data   Data read from file, must hold the product of count
+ */
+void nca_get_data(const int ncid, const String &name,
+                  const std::span<const size_t> start,
+                  const std::span<const size_t> count, Numeric *data) {
+  int retval, varid, ndims;
+  if ((retval = nc_inq_varid(ncid, name.c_str(), &varid)))
+    nca_error(retval, "nc_inq_varid(" + name + ")");
+  if ((retval = nc_inq_varndims(ncid, varid, &ndims)))
+    nca_error(retval, "nc_inq_varndims(" + name + ")");
+
+  ARTS_USER_ERROR_IF(static_cast<Size>(ndims) != start.size() or
+                         static_cast<Size>(ndims) != count.size(),
+                     "Variable {} has {} dimensions, but the hyperslab has {}",
+                     name,
+                     ndims,
+                     start.size())
+
+  if ((retval = nc_get_vara_double(
+           ncid, varid, start.data(), count.data(), data)))
+    nca_error(retval, "nc_get_vara(" + name + ")");
+}
+
 //! Read variable of type array of char from NetCDF file.
 /**
  \param[in]  ncid   NetCDF file descriptor
@@ -530,5 +611,81 @@ void nca_error(const int e, const std::string_view s) {
   ARTS_USER_ERROR("NetCDF error: {}m {}" "\nCheck your input file.", s, e);
 }
 
+//! Opens a NetCDF file for reading and passes it to read
+/**
+ The NetCDF library is not thread-safe, so all access to files is
+ serialized.  Only the calls into the library are done while holding the
+ lock, so read should not do much more than reading the data.
+
+ \param[in]  filename  The name of the file
+ \param[in]  read      Reads the data from the NetCDF file descriptor
+
+ \author Oliver Lemke
+ */
+void nca_read_file(const String &filename,
+                   const std::function<void(const int)> &read) {
+  const String efilename = expand_path(filename);
+
+  bool fail = false;
+  String fail_msg;
+#pragma omp critical(netcdf__critical_region)
+  {
+    int ncid;
+    if (nc_open(efilename.c_str(), NC_NOWRITE, &ncid)) {
+      fail = true;
+      fail_msg = "Error opening file. Does it exists?";
+    } else {
+      try {
+        read(ncid);
+      } catch (const std::exception &e) {
+        fail = true;
+        fail_msg = e.what();
+      }
+      nc_close(ncid);
+    }
+  }
+
+  if (fail)
+    ARTS_USER_ERROR("Error reading file: {}\n{}", efilename, fail_msg);
+}
+
+//! Creates a NetCDF4 file and passes it to write
+/**
+ See nca_read_file for the locking.
+
+ \param[in]  filename  The name of the file
+ \param[in]  write     Writes the data to the NetCDF file descriptor
+
+ \author Oliver Lemke
+ */
+void nca_write_file(const String &filename,
+                    const std::function<void(const int)> &write) {
+  const String efilename = add_basedir(filename);
+
+  bool fail = false;
+  String fail_msg;
+#pragma omp critical(netcdf__critical_region)
+  {
+    int ncid;
+    if (nc_create(efilename.c_str(), NC_CLOBBER | NC_NETCDF4, &ncid)) {
+      fail = true;
+      fail_msg = "Error opening file for writing.";
+    } else {
+      try {
+        write(ncid);
+      } catch (const std::exception &e) {
+        fail = true;
+        fail_msg = e.what();
+      }
+      nc_close(ncid);
+    }
+  }
+
+  if (fail)
+    ARTS_USER_ERROR("Error writing file: {}\n{}", efilename, fail_msg);
+}
+
 // We can't do the instantiation at the beginning of this file, because the
 // implementation of nca_write_to_file and nca_read_from_file have to be known.
+
+#include "nc_io_instantiation.h"
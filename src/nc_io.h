@@ -17,6 +17,11 @@
 #include <mystring.h>
 #include <species_tags.h>
 
+#include <functional>
+#include <span>
+
+class GasAbsLookup;
+
 ////////////////////////////////////////////////////////////////////////////
 //   Default file names
 ////////////////////////////////////////////////////////////////////////////
@@ -36,6 +41,42 @@ void nca_read_from_file(const String& filename, T& type);
 template <typename T>
 void nca_write_to_file(const String& filename, const T& type);
 
+/** Reads a hyperslab of a Vector, Matrix, or Tensor from a NetCDF file
+ *
+ * Only the hyperslab is read from the file.  A negative count means
+ * all the elements from start to the end of the dimension.
+ *
+ * @param[in] filename The name of the file
+ * @param[out] type The hyperslab
+ * @param[in] start The first index in each dimension
+ * @param[in] count The number of elements in each dimension
+ */
+template <typename T>
+void nca_read_slab_from_file(const String& filename,
+                             T& type,
+                             const ArrayOfIndex& start,
+                             const ArrayOfIndex& count);
+
+/** Reads the frequency window [fmin, fmax] of a lookup table from a NetCDF file
+ *
+ * Only the cross-sections of the frequencies in the window are read.
+ *
+ * @param[in] filename The name of the file
+ * @param[out] gal The lookup table
+ * @param[in] fmin The lowest frequency [Hz]
+ * @param[in] fmax The highest frequency [Hz]
+ */
+void nca_read_from_file(const String& filename,
+                        GasAbsLookup& gal,
+                        const Numeric fmin,
+                        const Numeric fmax);
+
+void nca_read_file(const String& filename,
+                   const std::function<void(const int)>& read);
+
+void nca_write_file(const String& filename,
+                    const std::function<void(const int)>& write);
+
 /*void nc_read_var(const int ncf, const int **ncvar,
                   const Index dims, const String& name);*/
 
@@ -43,6 +84,10 @@ void nca_def_dim(const int ncid,
                  const String& name,
                  const Index nelem,
                  int* ncdim);
+
+//! Variables of at most this size are neither chunked nor deflated
+inline constexpr size_t nca_chunk_min_bytes = 1 << 16;
+
 void nca_def_var(const int ncid,
                  const String& name,
                  const nc_type type,
@@ -50,6 +95,8 @@ void nca_def_var(const int ncid,
                  const int* dims,
                  int* varid);
 
+void nca_chunk_shape(std::span<size_t> shape, const size_t elem_size);
+
 int nca_def_ArrayOfIndex(const int ncid,
                          const String& name,
                          const ArrayOfIndex& a);
@@ -78,6 +125,12 @@ void nca_get_data(const int ncid,
                   size_t count,
                   Numeric* data);
 
+void nca_get_data(const int ncid,
+                  const String& name,
+                  const std::span<const size_t> start,
+                  const std::span<const size_t> count,
+                  Numeric* data);
+
 void nca_get_data(const int ncid, const String& name, char* data);
 
 void nca_get_data(const int ncid,
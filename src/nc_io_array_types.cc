@@ -38,8 +38,7 @@ void nca_write_to_file(const int ncid, const ArrayOfIndex& v) {
   int ncdim, varid;
   if ((retval = nc_def_dim(ncid, "size", v.size(), &ncdim)))
     nca_error(retval, "nc_def_dim");
-  if ((retval = nc_def_var(ncid, "ArrayOfIndex", NC_INT64, 1, &ncdim, &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "ArrayOfIndex", NC_INT64, 1, &ncdim, &varid);
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
   if ((retval = nc_put_var(ncid, varid, v.data())))
     nca_error(retval, "nc_put_var");
@@ -106,9 +105,7 @@ void nca_write_to_file(const int ncid,
   if ((retval =
            nc_def_var(ncid, "Matrix_ncols", NC_INT64, 1, &ncdim, &varid_ncols)))
     nca_error(retval, "nc_def_var");
-  if ((retval = nc_def_var(
-           ncid, "ArrayOfMatrix", NC_DOUBLE, 1, &ncdim_total, &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "ArrayOfMatrix", NC_DOUBLE, 1, &ncdim_total, &varid);
 
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
 
@@ -180,9 +177,7 @@ void nca_write_to_file(const int ncid,
   if ((retval =
            nc_def_var(ncid, "Vector_size", NC_INT64, 1, &ncdim, &varid_size)))
     nca_error(retval, "nc_def_var");
-  if ((retval = nc_def_var(
-           ncid, "ArrayOfVector", NC_DOUBLE, 1, &ncdim_total, &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "ArrayOfVector", NC_DOUBLE, 1, &ncdim_total, &varid);
 
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
 
@@ -10,9 +10,52 @@
 
 */
 
+#include <array>
+#include <utility>
+
 #include "nc_io.h"
 #include "nc_io_types.h"
 
+namespace {
+//! Checks a hyperslab against the dimensions of a variable
+/*!
+  A negative count means all elements from start to the end.
+
+  \param ncid    NetCDF file descriptor
+  \param dims    The dimension names of the variable
+  \param start   The first index in each dimension
+  \param count   The number of elements in each dimension
+  \return The start and count for the NetCDF library
+*/
+template <Size N>
+std::pair<std::array<size_t, N>, std::array<size_t, N>> nca_slab(
+    const int ncid,
+    const std::array<const char*, N>& dims,
+    const ArrayOfIndex& start,
+    const ArrayOfIndex& count) {
+  ARTS_USER_ERROR_IF(start.size() != N or count.size() != N,
+                     "Need {} start and count indices, got {} and {}",
+                     N,
+                     start.size(),
+                     count.size())
+
+  std::array<size_t, N> s, c;
+  for (Size i = 0; i < N; i++) {
+    const Index n  = nca_get_dim(ncid, dims[i]);
+    const Index ci = count[i] < 0 ? n - start[i] : count[i];
+    ARTS_USER_ERROR_IF(start[i] < 0 or ci < 0 or start[i] + ci > n,
+                       "Hyperslab [{}, {}) is out of range [0, {}) of {}",
+                       start[i],
+                       start[i] + ci,
+                       n,
+                       dims[i])
+    s[i] = static_cast<size_t>(start[i]);
+    c[i] = static_cast<size_t>(ci);
+  }
+  return {s, c};
+}
+}  // namespace
+
 //=== Matrix ==========================================================
 
 //! Reads a Matrix from a NetCDF file
@@ -29,6 +72,23 @@ void nca_read_from_file(const int ncid, Matrix& m) {
   nca_get_data(ncid, "Matrix", m.unsafe_data_handle());
 }
 
+//! Reads a hyperslab of a Matrix from a NetCDF file
+/*!
+  \param ncid    NetCDF file descriptor
+  \param m       Matrix
+  \param start   The first row and column
+  \param count   The number of rows and columns
+*/
+void nca_read_slab_from_file(const int ncid,
+                             Matrix& m,
+                             const ArrayOfIndex& start,
+                             const ArrayOfIndex& count) {
+  const auto [s, c] = nca_slab<2>(ncid, {"nrows", "ncols"}, start, count);
+
+  m.resize(c[0], c[1]);
+  nca_get_data(ncid, "Matrix", s, c, m.unsafe_data_handle());
+}
+
 //! Writes a Matrix to a NetCDF file
 /*!
   \param ncf     NetCDF file descriptor
@@ -41,8 +101,7 @@ void nca_write_to_file(const int ncid, const Matrix& m) {
     nca_error(retval, "nc_def_dim");
   if ((retval = nc_def_dim(ncid, "ncols", m.ncols(), &ncdims[1])))
     nca_error(retval, "nc_def_dim");
-  if ((retval = nc_def_var(ncid, "Matrix", NC_DOUBLE, 2, &ncdims[0], &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "Matrix", NC_DOUBLE, 2, &ncdims[0], &varid);
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
   if ((retval = nc_put_var_double(ncid, varid, m.unsafe_data_handle())))
     nca_error(retval, "nc_put_var");
@@ -65,6 +124,24 @@ void nca_read_from_file(const int ncid, Tensor3& t) {
   nca_get_data(ncid, "Tensor3", t.unsafe_data_handle());
 }
 
+//! Reads a hyperslab of a Tensor3 from a NetCDF file
+/*!
+  \param ncid    NetCDF file descriptor
+  \param t       Tensor3
+  \param start   The first index in each dimension
+  \param count   The number of elements in each dimension
+*/
+void nca_read_slab_from_file(const int ncid,
+                             Tensor3& t,
+                             const ArrayOfIndex& start,
+                             const ArrayOfIndex& count) {
+  const auto [s, c] =
+      nca_slab<3>(ncid, {"npages", "nrows", "ncols"}, start, count);
+
+  t.resize(c[0], c[1], c[2]);
+  nca_get_data(ncid, "Tensor3", s, c, t.unsafe_data_handle());
+}
+
 //! Writes a Tensor3 to a NetCDF file
 /*!
   \param ncf     NetCDF file descriptor
@@ -79,8 +156,7 @@ void nca_write_to_file(const int ncid, const Tensor3& t) {
     nca_error(retval, "nc_def_dim");
   if ((retval = nc_def_dim(ncid, "ncols", t.ncols(), &ncdims[2])))
     nca_error(retval, "nc_def_dim");
-  if ((retval = nc_def_var(ncid, "Tensor3", NC_DOUBLE, 3, &ncdims[0], &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "Tensor3", NC_DOUBLE, 3, &ncdims[0], &varid);
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
   if ((retval = nc_put_var_double(ncid, varid, t.unsafe_data_handle())))
     nca_error(retval, "nc_put_var");
@@ -104,6 +180,24 @@ void nca_read_from_file(const int ncid, Tensor4& t) {
   nca_get_data(ncid, "Tensor4", t.unsafe_data_handle());
 }
 
+//! Reads a hyperslab of a Tensor4 from a NetCDF file
+/*!
+  \param ncid    NetCDF file descriptor
+  \param t       Tensor4
+  \param start   The first index in each dimension
+  \param count   The number of elements in each dimension
+*/
+void nca_read_slab_from_file(const int ncid,
+                             Tensor4& t,
+                             const ArrayOfIndex& start,
+                             const ArrayOfIndex& count) {
+  const auto [s, c] = nca_slab<4>(
+      ncid, {"nbooks", "npages", "nrows", "ncols"}, start, count);
+
+  t.resize(c[0], c[1], c[2], c[3]);
+  nca_get_data(ncid, "Tensor4", s, c, t.unsafe_data_handle());
+}
+
 //! Writes a Tensor4 to a NetCDF file
 /*!
   \param ncf     NetCDF file descriptor
@@ -120,8 +214,7 @@ void nca_write_to_file(const int ncid, const Tensor4& t) {
     nca_error(retval, "nc_def_dim");
   if ((retval = nc_def_dim(ncid, "ncols", t.ncols(), &ncdims[3])))
     nca_error(retval, "nc_def_dim");
-  if ((retval = nc_def_var(ncid, "Tensor4", NC_DOUBLE, 4, &ncdims[0], &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "Tensor4", NC_DOUBLE, 4, &ncdims[0], &varid);
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
   if ((retval = nc_put_var_double(ncid, varid, t.unsafe_data_handle())))
     nca_error(retval, "nc_put_var");
@@ -146,6 +239,24 @@ void nca_read_from_file(const int ncid, Tensor5& t) {
   nca_get_data(ncid, "Tensor5", t.unsafe_data_handle());
 }
 
+//! Reads a hyperslab of a Tensor5 from a NetCDF file
+/*!
+  \param ncid    NetCDF file descriptor
+  \param t       Tensor5
+  \param start   The first index in each dimension
+  \param count   The number of elements in each dimension
+*/
+void nca_read_slab_from_file(const int ncid,
+                             Tensor5& t,
+                             const ArrayOfIndex& start,
+                             const ArrayOfIndex& count) {
+  const auto [s, c] = nca_slab<5>(
+      ncid, {"nshelves", "nbooks", "npages", "nrows", "ncols"}, start, count);
+
+  t.resize(c[0], c[1], c[2], c[3], c[4]);
+  nca_get_data(ncid, "Tensor5", s, c, t.unsafe_data_handle());
+}
+
 //! Writes a Tensor5 to a NetCDF file
 /*!
   \param ncf     NetCDF file descriptor
@@ -164,8 +275,7 @@ void nca_write_to_file(const int ncid, const Tensor5& t) {
     nca_error(retval, "nc_def_dim");
   if ((retval = nc_def_dim(ncid, "ncols", t.ncols(), &ncdims[4])))
     nca_error(retval, "nc_def_dim");
-  if ((retval = nc_def_var(ncid, "Tensor5", NC_DOUBLE, 5, &ncdims[0], &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "Tensor5", NC_DOUBLE, 5, &ncdims[0], &varid);
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
   if ((retval = nc_put_var_double(ncid, varid, t.unsafe_data_handle())))
     nca_error(retval, "nc_put_var");
@@ -186,6 +296,23 @@ void nca_read_from_file(const int ncid, Vector& v) {
   nca_get_data(ncid, "Vector", v.unsafe_data_handle());
 }
 
+//! Reads a hyperslab of a Vector from a NetCDF file
+/*!
+  \param ncid    NetCDF file descriptor
+  \param v       Vector
+  \param start   The first element
+  \param count   The number of elements
+*/
+void nca_read_slab_from_file(const int ncid,
+                             Vector& v,
+                             const ArrayOfIndex& start,
+                             const ArrayOfIndex& count) {
+  const auto [s, c] = nca_slab<1>(ncid, {"nelem"}, start, count);
+
+  v.resize(c[0]);
+  nca_get_data(ncid, "Vector", s, c, v.unsafe_data_handle());
+}
+
 //! Writes a Vector to a NetCDF file
 /*!
   \param ncid    NetCDF file descriptor
@@ -196,8 +323,7 @@ void nca_write_to_file(const int ncid, const Vector& v) {
   int ncdim, varid;
   if ((retval = nc_def_dim(ncid, "nelem", v.nelem(), &ncdim)))
     nca_error(retval, "nc_def_dim");
-  if ((retval = nc_def_var(ncid, "Vector", NC_DOUBLE, 1, &ncdim, &varid)))
-    nca_error(retval, "nc_def_var");
+  nca_def_var(ncid, "Vector", NC_DOUBLE, 1, &ncdim, &varid);
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
   if ((retval = nc_put_var_double(ncid, varid, v.unsafe_data_handle())))
     nca_error(retval, "nc_put_var");
@@ -12,6 +12,8 @@
 
 #include "config.h"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 #include "nc_io.h"
@@ -43,6 +45,70 @@ void nca_read_from_file(const int ncid, GasAbsLookup& gal) {
   nca_get_data(ncid, "xsec", gal.xsec, true);
 }
 
+//! Reads a frequency window of a GasAbsLookup table from a NetCDF file
+/*!
+ Only the part of the cross-sections that is inside the window is read.
+
+ \param[in] ncid    NetCDF file descriptor
+ \param[in] gal     GasAbsLookup
+ \param[in] fmin    The lowest frequency [Hz]
+ \param[in] fmax    The highest frequency [Hz]
+*/
+void nca_read_from_file(const int ncid,
+                        GasAbsLookup& gal,
+                        const Numeric fmin,
+                        const Numeric fmax) {
+  nca_get_data(ncid, "species", gal.species, true);
+
+  ARTS_USER_ERROR_IF(!gal.species.size(),
+                     "No species found in lookup table file!");
+
+  nca_get_data(
+      ncid, "nonlinear_species", gal.nonlinear_species, true);
+  nca_get_data(ncid, "p_grid", gal.p_grid, true);
+  nca_get_data(ncid, "vmrs_ref", gal.vmrs_ref, true);
+  nca_get_data(ncid, "t_ref", gal.t_ref, true);
+  nca_get_data(ncid, "t_pert", gal.t_pert, true);
+  nca_get_data(ncid, "nls_pert", gal.nls_pert, true);
+
+  Vector f_grid;
+  nca_get_data(ncid, "f_grid", f_grid, true);
+
+  const auto first = std::ranges::lower_bound(f_grid, fmin);
+  const auto last  = std::ranges::upper_bound(f_grid, fmax);
+  const Index i0   = std::distance(f_grid.begin(), first);
+  const Index nf   = std::max<Index>(0, std::distance(first, last));
+
+  gal.f_grid = f_grid[Range(i0, nf)];
+
+  const std::array<size_t, 4> start{0, 0, static_cast<size_t>(i0), 0};
+  const std::array<size_t, 4> count{
+      static_cast<size_t>(nca_get_dim(ncid, "xsec_nbooks", true)),
+      static_cast<size_t>(nca_get_dim(ncid, "xsec_npages", true)),
+      static_cast<size_t>(nf),
+      static_cast<size_t>(nca_get_dim(ncid, "xsec_ncols", true))};
+
+  gal.xsec.resize(count[0], count[1], count[2], count[3]);
+  if (count[0] * count[1] * count[2] * count[3] > 0)
+    nca_get_data(ncid, "xsec", start, count, gal.xsec.unsafe_data_handle());
+}
+
+//! Reads a frequency window of a GasAbsLookup table from a NetCDF file
+/*!
+ \param[in] filename  The name of the file
+ \param[in] gal       GasAbsLookup
+ \param[in] fmin      The lowest frequency [Hz]
+ \param[in] fmax      The highest frequency [Hz]
+*/
+void nca_read_from_file(const String& filename,
+                        GasAbsLookup& gal,
+                        const Numeric fmin,
+                        const Numeric fmax) {
+  nca_read_file(filename, [&](const int ncid) {
+    nca_read_from_file(ncid, gal, fmin, fmax);
+  });
+}
+
 //! Writes a GasAbsLookup table to a NetCDF file
 /*!
  \param[in]  ncid    NetCDF file descriptor
@@ -16,63 +16,29 @@
 
 #include <workspace.h>
 
-#include <stdexcept>
-
 #include "nc_io.h"
 #include "nc_io_types.h"
 
-template <WorkspaceGroup T>
+template <typename T>
 void nca_write_to_file(const String& filename, const T& type) {
-  String efilename = add_basedir(filename);
-
-  bool fail = false;
-  String fail_msg;
-#pragma omp critical(netcdf__critical_region)
-  {
-    int ncid;
-    if (nc_create(efilename.c_str(), NC_CLOBBER | NC_NETCDF4, &ncid)) {
-      fail = true;
-      fail_msg = "Error opening file for writing.";
-    } else {
-      try {
-        nca_write_to_file(ncid, type);
-      } catch (const std::runtime_error &e) {
-        fail = true;
-        fail_msg = e.what();
-      }
-      nc_close(ncid);
-    }
-  }
-
-  if (fail)
-    ARTS_USER_ERROR("Error writing file: {}\n{}", efilename, fail_msg);
+  nca_write_file(filename,
+                 [&type](const int ncid) { nca_write_to_file(ncid, type); });
+}
+
+template <typename T>
+void nca_read_from_file(const String& filename, T& type) {
+  nca_read_file(filename,
+                [&type](const int ncid) { nca_read_from_file(ncid, type); });
 }
 
-template <WorkspaceGroup T>
-void nca_read_from_file(const String &filename, T &type) {
-  String efilename = expand_path(filename);
-
-  bool fail = false;
-  String fail_msg;
-#pragma omp critical(netcdf__critical_region)
-  {
-    int ncid;
-    if (nc_open(efilename.c_str(), NC_NOWRITE, &ncid)) {
-      fail = true;
-      fail_msg = "Error opening file. Does it exists?";
-    } else {
-      try {
-        nca_read_from_file(ncid, type);
-      } catch (const std::runtime_error &e) {
-        fail = true;
-        fail_msg = e.what();
-      }
-      nc_close(ncid);
-    }
-  }
-
-  if (fail)
-    ARTS_USER_ERROR("Error reading file: {}\n{}", efilename, fail_msg);
+template <typename T>
+void nca_read_slab_from_file(const String& filename,
+                             T& type,
+                             const ArrayOfIndex& start,
+                             const ArrayOfIndex& count) {
+  nca_read_file(filename, [&](const int ncid) {
+    nca_read_slab_from_file(ncid, type, start, count);
+  });
 }
 
 #define TMPL_NC_READ_WRITE_FILE(what)                                \
@@ -107,6 +73,18 @@ TMPL_NC_READ_WRITE_FILE(ArrayOfVector)
 // Undefine the macro to avoid it being used anywhere else
 #undef TMPL_NC_READ_WRITE_FILE
 
+#define TMPL_NC_READ_SLAB_FILE(what)                                   \
+  template void nca_read_slab_from_file<what>(                         \
+      const String&, what&, const ArrayOfIndex&, const ArrayOfIndex&);
+
+TMPL_NC_READ_SLAB_FILE(Matrix)
+TMPL_NC_READ_SLAB_FILE(Tensor3)
+TMPL_NC_READ_SLAB_FILE(Tensor4)
+TMPL_NC_READ_SLAB_FILE(Tensor5)
+TMPL_NC_READ_SLAB_FILE(Vector)
+
+#undef TMPL_NC_READ_SLAB_FILE
+
 /*void
 xml_parse_from_stream (istream&, Vector&, bifstream *, ArtsXMLTag&);
 
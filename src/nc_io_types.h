@@ -34,11 +34,30 @@ TMPL_NC_READ_WRITE_FILE(Tensor4)
 TMPL_NC_READ_WRITE_FILE(Tensor5)
 TMPL_NC_READ_WRITE_FILE(Vector)
 
+#define TMPL_NC_READ_SLAB(what)                        \
+  void nca_read_slab_from_file(const int,              \
+                               what&,                  \
+                               const ArrayOfIndex&,    \
+                               const ArrayOfIndex&);
+
+TMPL_NC_READ_SLAB(Matrix)
+TMPL_NC_READ_SLAB(Tensor3)
+TMPL_NC_READ_SLAB(Tensor4)
+TMPL_NC_READ_SLAB(Tensor5)
+TMPL_NC_READ_SLAB(Vector)
+
+#undef TMPL_NC_READ_SLAB
+
 //=== Compound Types =======================================================
 
 TMPL_NC_READ_WRITE_FILE(Agenda)
 TMPL_NC_READ_WRITE_FILE(GasAbsLookup)
 
+void nca_read_from_file(const int ncid,
+                        GasAbsLookup& gal,
+                        const Numeric fmin,
+                        const Numeric fmax);
+
 //=== Array Types ==========================================================
 
 TMPL_NC_READ_WRITE_FILE(ArrayOfIndex)
@@ -12,6 +12,7 @@
 #ifndef _ARTS_OEM_H_
 #define _ARTS_OEM_H_
 
+#include <chrono>
 #include <type_traits>
 
 #include "invlib/algebra.h"
@@ -574,6 +575,193 @@ class AgendaWrapper {
   /** Cached simulation result. */
   Vector yi_;
 };
+
+/** Counters of the Jacobian products of a matrix-free OEM computation.*/
+struct JacobianProductStatistics {
+  /** Number of products K v.*/
+  Size nproducts = 0;
+  /** Number of products K^T w.*/
+  Size ntransposed = 0;
+  /** Time spent in measurement_jacobian_product_agenda.*/
+  std::chrono::duration<double> time = std::chrono::duration<double>::zero();
+};
+
+/** Matrix-free Jacobian
+ *
+ *  Represents the Jacobian K of the forward model at a given state vector
+ *  by its products K v and K^T w with vectors, which is all that the CG
+ *  solvers need. Each product executes measurement_jacobian_product_agenda,
+ *  so K itself is never stored.
+ */
+class JacobianProducts {
+ public:
+  using RealType   = Numeric;
+  using VectorType = ArtsVector;
+  using MatrixType = ArtsMatrix;
+  using ResultType = ArtsMatrix;
+
+  /** Create the Jacobian at a state vector.
+   *
+   * \param[in] ws Pointer to the current ARTS workspace.
+   * \param[in] agenda Pointer to the measurement_jacobian_product_agenda.
+   * \param[in] x The state vector at which the Jacobian is evaluated.
+   * \param[in] m Dimension of the measurement space.
+   * \param[in,out] stats Pointer to the counters of the products.
+   */
+  JacobianProducts(const Workspace *ws,
+                   const Agenda *agenda,
+                   const ::Vector &x,
+                   Index m,
+                   JacobianProductStatistics *stats)
+      : ws_(ws), agenda_(agenda), x_(x), m_(m), stats_(stats) {}
+
+  Index rows() const { return m_; }
+  Index cols() const { return x_.nelem(); }
+
+  /** Compute K v. */
+  ArtsVector multiply(const ArtsVector &v) const { return product(v, 0); }
+
+  /** Compute K^T w. */
+  ArtsVector transpose_multiply(const ArtsVector &w) const {
+    return product(w, 1);
+  }
+
+ private:
+  ArtsVector product(const ArtsVector &v, Index transpose) const {
+    const auto t1 = std::chrono::steady_clock::now();
+    ::Vector w;
+    measurement_jacobian_product_agendaExecute(
+        *ws_, w, x_, v, transpose, *agenda_);
+    stats_->time += std::chrono::steady_clock::now() - t1;
+
+    const Index size = transpose ? cols() : rows();
+    ARTS_USER_ERROR_IF(w.nelem() != size,
+                       "The measurement_jacobian_product_agenda returned a "
+                       "vector of size {}, but the expected size is {}",
+                       w.nelem(),
+                       size)
+
+    if (transpose) {
+      stats_->ntransposed++;
+    } else {
+      stats_->nproducts++;
+    }
+    return w;
+  }
+
+  /** Pointer to current ARTS workspace */
+  const Workspace *ws_;
+  /** Pointer to the measurement_jacobian_product_agenda of the workspace. */
+  const Agenda *agenda_;
+  /** The state vector at which the Jacobian is evaluated. */
+  ::Vector x_;
+  /** Dimension of the measurement space.*/
+  Index m_;
+  /** Counters of the products. */
+  JacobianProductStatistics *stats_;
+};
+
+/** invlib wrapper type for the matrix-free Jacobian.*/
+using JacobianOperator = invlib::Matrix<JacobianProducts>;
+
+/** Matrix-free interface to ARTS inversion_iterate_agenda
+ *
+ *  Like AgendaWrapper, but the Jacobian is provided by its products with
+ *  vectors from measurement_jacobian_product_agenda. The
+ *  inversion_iterate_agenda is only used to evaluate the forward model.
+ */
+class ProductAgendaWrapper {
+ public:
+  /** Dimension of the measurement space.*/
+  const unsigned int m = 0;
+  /** Dimension of the state space.*/
+  const unsigned int n = 0;
+
+  /** Create the wrapper.
+   *
+   * \param[in] ws Pointer to the current ARTS workspace.
+   * \param[in] measurment_space_dimension Dimension of the measurement space
+   * \param[in] state_space_dimension Dimension of the state space
+   * \param[in] arts_y Reference to the arts y WSV. Used for the first
+   * evaluation if not empty.
+   * \param[in] inversion_iterate_agenda Pointer to the forward model agenda.
+   * \param[in] product_agenda Pointer to the Jacobian product agenda.
+   */
+  ProductAgendaWrapper(const Workspace *const ws,
+                       unsigned int measurement_space_dimension,
+                       unsigned int state_space_dimension,
+                       ::Vector &arts_y,
+                       const Agenda *inversion_iterate_agenda,
+                       const Agenda *product_agenda)
+      : m(measurement_space_dimension),
+        n(state_space_dimension),
+        inversion_iterate_agenda_(inversion_iterate_agenda),
+        product_agenda_(product_agenda),
+        reuse_y_(arts_y.nelem() != 0),
+        ws_(ws),
+        yi_(arts_y) {}
+
+  ProductAgendaWrapper(const ProductAgendaWrapper &)            = delete;
+  ProductAgendaWrapper(ProductAgendaWrapper &&)                 = delete;
+  ProductAgendaWrapper &operator=(const ProductAgendaWrapper &) = delete;
+  ProductAgendaWrapper &operator=(ProductAgendaWrapper &&)      = delete;
+
+  /** Return most recently simulated measurement vector.*/
+  ArtsVector get_measurement_vector() { return yi_; }
+
+  /** Return the counters of the Jacobian products.*/
+  const JacobianProductStatistics &statistics() const { return stats_; }
+
+  /** Evaluate forward model and return the matrix-free Jacobian.
+   *
+   * \param[in] xi The current state vector x.
+   * \param[out] yi The measurement vector y = K(x) for the current state
+   * vector x as computed by the forward model.
+   * \return The Jacobian at xi.
+   */
+  JacobianOperator Jacobian(const Vector &xi, Vector &yi) {
+    yi                  = evaluate(xi);
+    iteration_counter_ += 1;
+    return JacobianProducts(ws_, product_agenda_, xi, m, &stats_);
+  }
+
+  /** Evaluate the ARTS forward model.
+   *
+   * @param[in] xi The current state vector of the OEM iteration.
+   * @return The observation vector y contained in the yf WSV after
+   *   executing the inversion_iterate_agenda.
+   */
+  Vector evaluate(const Vector &xi) {
+    if (!reuse_y_) {
+      ::Matrix dummy;
+      inversion_iterate_agendaExecute(*ws_,
+                                      yi_,
+                                      dummy,
+                                      xi,
+                                      0,
+                                      iteration_counter_,
+                                      *inversion_iterate_agenda_);
+    } else {
+      reuse_y_ = false;
+    }
+    return yi_;
+  }
+
+ private:
+  /** Pointer to the inversion_iterate_agenda of the workspace. */
+  const Agenda *inversion_iterate_agenda_;
+  /** Pointer to the measurement_jacobian_product_agenda of the workspace. */
+  const Agenda *product_agenda_;
+  unsigned int iteration_counter_ = 0;
+  /** Flag whether to reuse the measurement vector of the workspace. */
+  bool reuse_y_;
+  /** Pointer to current ARTS workspace */
+  const Workspace *const ws_;
+  /** Cached simulation result. */
+  Vector yi_;
+  /** Counters of the Jacobian products. */
+  JacobianProductStatistics stats_{};
+};
 }  // namespace oem
 
 /** Clip Tensor4
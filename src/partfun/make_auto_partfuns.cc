@@ -14,7 +14,9 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <ostream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -115,7 +117,24 @@ std::string func_name(std::string spec, bool deriv) {
   return spec;
 }
 
-void make_cc(const std::filesystem::path& xmlfile) {
+//! Writes the info as it is used by the generated function of data
+void print_info(const PartitionFunctionsData& data, auto& os) {
+  using enum PartitionFunctionsType;
+  switch (data.type) {
+    case Interp:
+      os << "{Interp}";
+      break;
+    case Coeff:
+      os << "{Coeff, 0, 0, " << data.data.nrows() << "}";
+      break;
+    case StaticInterp:
+      os << "{StaticInterp, " << data.data(1, 0) - data.data(0, 0) << ", "
+         << data.data(0, 0) << ", " << data.data.nrows() << "}";
+      break;
+  }
+}
+
+std::string make_cc(const std::filesystem::path& xmlfile) {
   if (xmlfile.extension() not_eq ".xml")
     throw std::runtime_error("Not an xml file");
 
@@ -146,13 +165,18 @@ void make_cc(const std::filesystem::path& xmlfile) {
         "  constexpr auto derivative = Derivatives::Yes;\n  ";
   print_method(data.type, os);
   os << '}' << '\n';
+
+  std::ostringstream info;
+  print_info(data, info);
+  return info.str();
 }
 
 std::string species_name(SpeciesEnum spec, const std::string& isot) {
   return std::string{toString<1>(spec)} + "-" + isot;
 }
 
-void make_h(const std::vector<std::string>& xmlfiles) {
+void make_h(const std::vector<std::string>& xmlfiles,
+            const std::map<std::string, std::string>& infos) {
   // Make a complete species list and isotopologues:
   const auto data = [&] {
     std::map<SpeciesEnum, std::vector<std::string>> x;
@@ -177,6 +201,7 @@ void make_h(const std::vector<std::string>& xmlfiles) {
   file_wrap os("auto_partfun.h",
                "array",
                "debug.h",
+               "enumsSpeciesEnum.h",
                "matpack_concepts.h",
                "string_view",
                "template_partfun.h");
@@ -205,6 +230,28 @@ void make_h(const std::vector<std::string>& xmlfiles) {
   os << '\n';
   }
 
+  // Write the kind of data of each isotopologue
+  os << "\ninline DataInfo data_info(SpeciesEnum spec, "
+        "std::string_view isot) {\n"
+        "  using enum PartitionFunctionsType;\n\n"
+        "  switch (spec) {\n";
+  for (auto& spec : data) {
+    if (spec.second.empty()) continue;
+
+    os << "    case SpeciesEnum::" << toString<0>(spec.first) << ":\n";
+    for (auto& isot : spec.second) {
+      os << "      if (isot == \"" << isot << "\") return "
+         << infos.at(species_name(spec.first, isot)) << ";\n";
+    }
+    os << "      break;\n";
+  }
+  os << "    default:\n"
+        "      break;\n"
+        "  }\n\n"
+        "  ARTS_USER_ERROR(\"No partition function data for {}-{}\", "
+        "spec, isot)\n"
+        "}\n";
+
   // Write the call operator
   for (auto& spec : data) {
     Index i = 0;
@@ -233,12 +280,13 @@ int main(int argn, char** argv) try {
         "USAGE: PROG INPUT1.XML INPUT2.xml ... INPUTX.xml");
   const std::vector<std::string> xmlfiles{argv + 1, argv + argn};
 
+  std::map<std::string, std::string> infos;
   for (auto& fn : xmlfiles) {
     auto xmlfile = std::filesystem::canonical(fn);
-    make_cc(xmlfile);
+    infos[spec_from_xml(xmlfile)] = make_cc(xmlfile);
   }
 
-  make_h(xmlfiles);
+  make_h(xmlfiles, infos);
 
   return EXIT_SUCCESS;
 } catch (std::exception& e) {
@@ -1,5 +1,12 @@
 #include "partfun.h"
 
+#include <debug.h>
+
+#include <array>
+#include <limits>
+#include <utility>
+#include <vector>
+
 namespace PartitionFunctions {
 namespace detail {
 
@@ -11,11 +18,165 @@ template Numeric partfun_impl<Derivatives::No>(
 
 }  // namespace detail
 
+namespace {
+struct Table {
+  static constexpr Size npos = std::numeric_limits<Size>::max();
+
+  struct entry {
+    //! Position of the coefficients, npos if there are none
+    Size start{npos};
+
+    //! Coefficients per interval, 2 for lines and 4 for cubic polynomials
+    Size ncoeff{0};
+  };
+
+  std::array<entry, Species::Isotopologues.size()> entries;
+
+  //! The coefficients per interval, in (T - T_i) / table_dT, lowest power first
+  std::vector<Numeric> coeffs;
+
+  //! The lines through the data at the nodes
+  void push_linear(const SpeciesIsotope& ir) {
+    Numeric q0 = detail::partfun_impl<Derivatives::No>(table_T0, ir);
+    for (Size i = 0; i < table_n; i++) {
+      const Numeric q1 = detail::partfun_impl<Derivatives::No>(
+          table_T0 + table_dT * static_cast<Numeric>(i + 1), ir);
+      coeffs.push_back(q0);
+      coeffs.push_back(q1 - q0);
+      q0 = q1;
+    }
+  }
+
+  //! The cubic Hermite polynomials through the values and slopes at the nodes
+  void push_hermite(const SpeciesIsotope& ir) {
+    const auto node = [&ir](Size i) {
+      const Numeric T = table_T0 + table_dT * static_cast<Numeric>(i);
+      return std::pair{
+          detail::partfun_impl<Derivatives::No>(T, ir),
+          table_dT * detail::partfun_impl<Derivatives::Yes>(T, ir)};
+    };
+
+    auto [q0, m0] = node(0);
+    for (Size i = 0; i < table_n; i++) {
+      const auto [q1, m1] = node(i + 1);
+      coeffs.push_back(q0);
+      coeffs.push_back(m0);
+      coeffs.push_back(3.0 * (q1 - q0) - 2.0 * m0 - m1);
+      coeffs.push_back(2.0 * (q0 - q1) + m0 + m1);
+      q0 = q1;
+      m0 = m1;
+    }
+  }
+
+  Table() {
+    for (Size iso = 0; iso < Species::Isotopologues.size(); iso++) {
+      const auto& ir = Species::Isotopologues[iso];
+      if (ir.joker() or not has_partfun(ir)) continue;
+
+      const DataInfo info = data_info(ir.spec, ir.isotname);
+      const Size start    = coeffs.size();
+
+      using enum PartitionFunctionsType;
+      switch (info.type) {
+        case StaticInterp:
+          //! Only exact if the nodes of the table are nodes of the data
+          if (info.T0 == table_T0 and info.dT == table_dT and
+              static_cast<Size>(info.N) > table_n) {
+            push_linear(ir);
+            entries[iso] = {.start = start, .ncoeff = 2};
+          }
+          break;
+        case Coeff:
+          if (info.N <= 4) {
+            push_hermite(ir);
+            entries[iso] = {.start = start, .ncoeff = 4};
+          }
+          break;
+        case Interp:
+          break;
+      }
+    }
+  }
+
+  //! The coefficients of the interval holding T, or nullptr if there is none
+  [[nodiscard]] const Numeric* find(Numeric& x,
+                                    Numeric T,
+                                    const entry& e) const {
+    x = (T - table_T0) * (1.0 / table_dT);
+    if (e.start == npos or
+        not(x >= 0.0 and x < static_cast<Numeric>(table_n))) {
+      return nullptr;
+    }
+
+    const auto i  = static_cast<Size>(x);
+    x            -= static_cast<Numeric>(i);
+    return coeffs.data() + e.start + e.ncoeff * i;
+  }
+
+  [[nodiscard]] const entry& entry_of(const SpeciesIsotope& ir) const {
+    return entries[Species::find_species_index(ir)];
+  }
+};
+
+const Table& table() {
+  static const Table t{};
+  return t;
+}
+
+Numeric table_Q(const Numeric* c, Size ncoeff, Numeric x) {
+  if (ncoeff == 2) return c[0] + x * c[1];
+  return ((c[3] * x + c[2]) * x + c[1]) * x + c[0];
+}
+
+Numeric table_dQdT(const Numeric* c, Size ncoeff, Numeric x) {
+  if (ncoeff == 2) return c[1] * (1.0 / table_dT);
+  return ((3.0 * c[3] * x + 2.0 * c[2]) * x + c[1]) * (1.0 / table_dT);
+}
+}  // namespace
+
 Numeric Q(Numeric T, const SpeciesIsotope& ir) {
+  const Table& t = table();
+  const auto& e  = t.entry_of(ir);
+
+  Numeric x;
+  if (const Numeric* c = t.find(x, T, e)) return table_Q(c, e.ncoeff, x);
   return detail::partfun_impl<Derivatives::No>(T, ir);
 }
 
 Numeric dQdT(Numeric T, const SpeciesIsotope& ir) {
+  const Table& t = table();
+  const auto& e  = t.entry_of(ir);
+
+  Numeric x;
+  if (const Numeric* c = t.find(x, T, e)) return table_dQdT(c, e.ncoeff, x);
   return detail::partfun_impl<Derivatives::Yes>(T, ir);
 }
+
+void Q(VectorView out, const ConstVectorView& T, const SpeciesIsotope& ir) {
+  ARTS_ASSERT(out.size() == T.size())
+
+  const Table& t = table();
+  const auto& e  = t.entry_of(ir);
+
+  Numeric x;
+  for (Index i = 0; i < T.size(); i++) {
+    const Numeric* c = t.find(x, T[i], e);
+    out[i]           = c ? table_Q(c, e.ncoeff, x)
+                         : detail::partfun_impl<Derivatives::No>(T[i], ir);
+  }
+}
+
+void dQdT(VectorView out, const ConstVectorView& T, const SpeciesIsotope& ir) {
+  ARTS_ASSERT(out.size() == T.size())
+
+  const Table& t = table();
+  const auto& e  = t.entry_of(ir);
+
+  Numeric x;
+  for (Index i = 0; i < T.size(); i++) {
+    const Numeric* c = t.find(x, T[i], e);
+    out[i]           = c ? table_dQdT(c, e.ncoeff, x)
+                         : detail::partfun_impl<Derivatives::Yes>(T[i], ir);
+  }
+}
 }  // namespace PartitionFunctions
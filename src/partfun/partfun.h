@@ -145,10 +145,34 @@ extern template Numeric partfun_impl<Derivatives::No>(
 
 } // namespace detail
 
+/*! The partition functions of all isotopologues are tabulated
+
+The table is a uniform temperature grid from table_T0 with table_n intervals
+of width table_dT, in one contiguous block.  It is computed once, on first
+use.  The grid is made of nodes of the StaticInterp data, so their linear
+interpolation is tabulated as the coefficients of the same lines, and the
+table gives the same values as the data.  Coeff data of at most third
+degree are tabulated as cubic Hermite polynomials through the values and
+derivatives at the end points of each interval, which is the same
+polynomial.  Other data are not tabulated.
+
+Q and dQdT are lookups in this table inside of the grid and evaluate the
+partition function directly outside of it.
+*/
+inline constexpr Numeric table_T0 = 1.0;
+inline constexpr Numeric table_dT = 1.0;
+inline constexpr Size table_n     = 999;
+
 Numeric Q(Numeric T, const SpeciesIsotope& ir);
 
 Numeric dQdT(Numeric T, const SpeciesIsotope& ir);
 
+//! As Q but for many temperatures, e.g., along a path, out must have the size of T
+void Q(VectorView out, const ConstVectorView& T, const SpeciesIsotope& ir);
+
+//! As dQdT but for many temperatures, e.g., along a path, out must have the size of T
+void dQdT(VectorView out, const ConstVectorView& T, const SpeciesIsotope& ir);
+
 constexpr bool has_partfun(const SpeciesIsotope& ir) noexcept {
   using enum SpeciesEnum;
 
@@ -15,6 +15,20 @@ struct Data {
 
 enum class Derivatives : bool {No, Yes};
 
+//! The kind of data of a partition function
+struct DataInfo {
+  PartitionFunctionsType type;
+
+  //! The first temperature of the grid of StaticInterp data
+  Numeric T0{0};
+
+  //! The step of the grid of StaticInterp data
+  Numeric dT{0};
+
+  //! The number of grid points of StaticInterp or coefficients of Coeff data
+  Index N{0};
+};
+
 template <Derivatives deriv, std::size_t N> 
 constexpr Numeric linterp(const std::array<Numeric, N>& Tg,
                           const std::array<Numeric, N>& Qg,
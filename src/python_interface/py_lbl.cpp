@@ -4,6 +4,7 @@
 #include <nanobind/stl/pair.h>
 #include <nanobind/stl/shared_ptr.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 #include <python_interface.h>
 
@@ -382,6 +383,173 @@ void py_lbl(py::module_& m) try {
       "atm"_a,
       "T"_a);
 
+  py::class_<lbl::voigt::ecs::equivalent_lines_table> eqv_table(
+      lbl, "equivalent_lines_table");
+  eqv_table.def_rw("P0",
+                   &lbl::voigt::ecs::equivalent_lines_table::P0,
+                   "The pressure the table was computed at");
+  eqv_table.def_rw(
+      "T", &lbl::voigt::ecs::equivalent_lines_table::T, "The temperature grid");
+  eqv_table.def_rw("dstr",
+                   &lbl::voigt::ecs::equivalent_lines_table::dstr,
+                   "Relative offset of the equivalent strengths");
+  eqv_table.def_rw("dval",
+                   &lbl::voigt::ecs::equivalent_lines_table::dval,
+                   "Offset of the equivalent centers and widths");
+  eqv_table.doc() = "Equivalent lines of a band tabulated in temperature";
+
+  py::class_<LinemixingEcsTables> let(m, "LinemixingEcsTables");
+  workspace_group_interface(let);
+  let.def(
+         "__getitem__",
+         [](LinemixingEcsTables& t, const QuantumIdentifier& key)
+             -> lbl::voigt::ecs::equivalent_lines_table& {
+           auto it = t.data.find(key);
+           if (it == t.data.end())
+             throw py::key_error(var_string(key).c_str());
+           return it->second;
+         },
+         py::rv_policy::reference_internal,
+         "key"_a)
+      .def(
+          "__setitem__",
+          [](LinemixingEcsTables& t,
+             const QuantumIdentifier& key,
+             const lbl::voigt::ecs::equivalent_lines_table& table) {
+            t[key] = table;
+          },
+          "key"_a,
+          "table"_a)
+      .def(
+          "__contains__",
+          [](const LinemixingEcsTables& t, const QuantumIdentifier& key) {
+            return t.data.contains(key);
+          },
+          "key"_a)
+      .def("__len__", [](const LinemixingEcsTables& t) { return t.size(); });
+
+  lbl.def(
+      "tabulate_equivalent_lines",
+      [](const AbsorptionBand& band,
+         const LinemixingEcsData& ecs_data,
+         const AtmPoint& atm,
+         const Vector& T) {
+        lbl::voigt::ecs::ComputeData com_data({}, atm);
+        return lbl::voigt::ecs::tabulate(com_data,
+                                         band.key,
+                                         band.data,
+                                         ecs_data.data.at(band.key.Isotopologue()),
+                                         atm,
+                                         T);
+      },
+      "Tabulate the equivalent lines of a band in temperature",
+      "band"_a,
+      "ecs_data"_a,
+      "atm"_a,
+      "T"_a);
+
+  lbl.def(
+      "tabulated_equivalent_lines",
+      [](const AbsorptionBand& band,
+         const lbl::voigt::ecs::equivalent_lines_table& table,
+         const AtmPoint& atm) {
+        lbl::voigt::ecs::ComputeData com_data({}, atm);
+        com_data.adapt_tabulated(band.key, band.data, table, atm);
+        return std::pair{com_data.eqv_strs, com_data.eqv_vals};
+      },
+      "Equivalent lines of a band from a table, in band line order",
+      "band"_a,
+      "table"_a,
+      "atm"_a);
+
+  lbl.def(
+      "adaptive_calculate",
+      [](const AscendingGrid& f_grid,
+         const ArrayOfAbsorptionBand& bands,
+         const LinemixingEcsData& ecs_data,
+         const AtmPoint& atm,
+         const Vector2& los,
+         SpeciesEnum species,
+         Numeric rtol,
+         Numeric min_df,
+         Size max_points,
+         bool add_line_centers,
+         const LinemixingEcsTables& ecs_tables) {
+        auto out = lbl::adaptive_calculate(
+            f_grid,
+            species,
+            bands,
+            ecs_data,
+            ecs_tables,
+            atm,
+            los,
+            {.rtol             = rtol,
+             .min_df           = min_df,
+             .max_points       = max_points,
+             .add_line_centers = add_line_centers});
+        return std::tuple{
+            std::move(out.f_grid), std::move(out.pm), std::move(out.sv)};
+      },
+      "Compute the spectrum on an adaptively refined frequency grid\n\n"
+      "Returns the refined grid, the propagation matrix and the source vector",
+      "f_grid"_a,
+      "bands"_a,
+      "ecs_data"_a,
+      "atm"_a,
+      "los"_a              = Vector2{0, 0},
+      "species"_a          = SpeciesEnum::Bath,
+      "rtol"_a             = 1e-3,
+      "min_df"_a           = 1.0,
+      "max_points"_a       = Size{1'000'000},
+      "add_line_centers"_a = true,
+      "ecs_tables"_a       = LinemixingEcsTables{});
+
+  py::class_<lbl::prune_report> prune_report(lbl, "prune_report");
+  prune_report.def_ro("nlines",
+                      &lbl::prune_report::nlines,
+                      "The number of lines in the bands of the species");
+  prune_report.def_ro("nkept",
+                      &lbl::prune_report::nkept,
+                      "The number of lines that are kept and will be evaluated");
+  prune_report.def_ro("nwindowed",
+                      &lbl::prune_report::nwindowed,
+                      "The number of kept lines limited to a local window");
+  prune_report.def_ro("error",
+                      &lbl::prune_report::error,
+                      "The estimated relative error");
+  prune_report.doc() = "The lines considered and kept by pruning";
+
+  py::class_<lbl::band_selection> band_selection(lbl, "band_selection");
+  band_selection.def_ro("lines",
+                        &lbl::band_selection::lines,
+                        "The positions of the kept lines in the band");
+  band_selection.def_ro("cutoff",
+                        &lbl::band_selection::cutoff,
+                        "The cutoff frequency of the kept lines");
+  band_selection.doc() = "The lines of a band kept by pruning";
+
+  lbl.def(
+      "prune",
+      [](const ArrayOfAbsorptionBand& bands,
+         const AtmPoint& atm,
+         Numeric fmin,
+         Numeric fmax,
+         Numeric rel_err,
+         SpeciesEnum species) {
+        std::vector<lbl::band_selection> out;
+        auto report =
+            lbl::prune(out, bands, species, atm, fmin, fmax, rel_err);
+        return std::pair{std::move(out), report};
+      },
+      "Prune the lines that are not needed at an atmospheric point\n\n"
+      "Returns the selection of each band and a report of the lines kept",
+      "bands"_a,
+      "atm"_a,
+      "fmin"_a,
+      "fmax"_a,
+      "rel_err"_a,
+      "species"_a = SpeciesEnum::Bath);
+
   lbl.def(
       "Q",
       [](py::object t, SpeciesIsotope isot) {
@@ -394,6 +562,12 @@ void py_lbl(py::module_& m) try {
 
   py::class_<LinemixingEcsData> led(m, "LinemixingEcsData");
   workspace_group_interface(led);
+
+  py::class_<AbsorptionBandIndex> abi(m, "AbsorptionBandIndex");
+  workspace_group_interface(abi);
+  abi.def_prop_ro("size",
+                  &AbsorptionBandIndex::size,
+                  "The number of bands the index was built from");
 } catch (std::exception& e) {
   throw std::runtime_error(
       var_string("DEV ERROR:\nCannot initialize lbl\n", e.what()));
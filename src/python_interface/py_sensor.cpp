@@ -85,7 +85,22 @@ void py_sensor(py::module_& m) try {
       .def_prop_ro("weight_matrix", &SensorObsel::weight_matrix, "Weights matrix")
       .def_prop_ro("poslos",
                    &SensorObsel::poslos_grid,
-                   "Position and line of sight grid");
+                   "Position and line of sight grid")
+      .def("weights_on",
+           &SensorObsel::weights_on,
+           "The weights for a spectrum on another frequency grid",
+           "f_grid"_a,
+           "ip"_a = 0)
+      .def(
+          "sumup",
+          [](const SensorObsel& self,
+             const StokvecVector& i,
+             const AscendingGrid& f_grid,
+             Index ip) { return self.sumup(i, f_grid, ip); },
+          "Apply the obsel to a spectrum on any frequency grid",
+          "i"_a,
+          "f_grid"_a,
+          "ip"_a = 0);
 
   auto a1 =
       py::bind_vector<ArrayOfSensorObsel, py::rv_policy::reference_internal>(
@@ -7,6 +7,7 @@
 #include <iomanip>
 #include <limits>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -203,51 +204,104 @@ std::pair<Numeric, bool> beta_angle(const Workspace& ws,
   return {Conversion::rad2deg(beta), hit};
 }
 
-void find_sun_path(const Workspace& ws,
-                   ArrayOfPropagationPathPoint& sun_path,
-                   const Sun& sun,
-                   const Agenda& ray_path_observer_agenda,
-                   const SurfaceField& surface_field,
-                   const Vector3 observer_pos,
-                   const Numeric angle_cut,
-                   const Index count_limit,
-                   const bool just_hit) {
+namespace {
+//! The difference a - b of two line-of-sights, with the azimuth in [-180, 180)
+Vector2 los_difference(const Vector2 a, const Vector2 b) {
+  Numeric daa = std::fmod(a[1] - b[1] + 180.0, 360.0);
+  if (daa < 0) daa += 360.0;
+  return {a[0] - b[0], daa - 180.0};
+}
+}  // namespace
+
+Vector2 find_sun_path(const Workspace& ws,
+                      ArrayOfPropagationPathPoint& sun_path,
+                      const Sun& sun,
+                      const Agenda& ray_path_observer_agenda,
+                      const SurfaceField& surface_field,
+                      const Vector3 observer_pos,
+                      const Numeric angle_cut,
+                      const Index count_limit,
+                      const bool just_hit,
+                      const std::optional<Vector2>& start_los) {
   using Conversion::rad2deg;
 
   ARTS_ASSERT(angle_cut >= 0.0)
 
+  //! The number of secant steps before falling back to the search pattern
+  constexpr Index secant_limit = 5;
+
   const Vector3 sun_pos{
       {sun.distance - surface_field.single_value(
                           SurfaceKey::h, observer_pos[1], observer_pos[2]),
        sun.latitude,
        sun.longitude}};
-  auto los = geometric_los(observer_pos, sun_pos, surface_field.ellipsoid);
+  auto los = start_los.value_or(
+      geometric_los(observer_pos, sun_pos, surface_field.ellipsoid));
   auto best_los = los;
 
   Numeric best_beta = 360;
   Numeric fac = 1.0;
 
-  //! Startup close to (?) target
+  /*! Secant steps on the line-of-sight
+
+  The residual is the offset of the line-of-sight leaving the atmosphere
+  from the geometric line-of-sight to the sun at the exit point.  It is
+  driven to zero component-wise by the secant method.  The first step
+  assumes a unit slope, i.e., that the exit line-of-sight turns as much as
+  the observer line-of-sight.  This is only approximate, also without
+  refraction, since the exit point moves with the line-of-sight.  The
+  later steps use the slope between the two latest line-of-sights.
+  */
   {
-    const auto [beta, hit] = beta_angle(ws,
-                                        sun_path,
-                                        sun,
-                                        observer_pos,
-                                        best_los,
-                                        ray_path_observer_agenda,
-                                        surface_field,
-                                        angle_cut);
-
-    if (hit and just_hit) return;
-    if (beta < best_beta) {
-      best_beta = beta;
-      best_los = los;
+    Vector2 prev_los{}, prev_res{};
+    for (Index i = 0; i < secant_limit; i++) {
+      const auto [beta, hit] = beta_angle(ws,
+                                          sun_path,
+                                          sun,
+                                          observer_pos,
+                                          los,
+                                          ray_path_observer_agenda,
+                                          surface_field,
+                                          angle_cut);
+
+      if (hit and just_hit) return sun_path.front().los;
+      if (beta < best_beta) {
+        best_beta = beta;
+        best_los  = sun_path.front().los;
+      } else if (i > 0) {
+        break;
+      }
+      if (best_beta < angle_cut) return best_los;
+
+      //! The horizon might have replaced the line-of-sight
+      const Vector2 used_los = sun_path.front().los;
+      const Vector2 res      = los_difference(
+          geometric_los(
+              sun_path.back().pos, sun_pos, surface_field.ellipsoid),
+          path::mirror(sun_path.back().los));
+
+      Vector2 step = res;
+      if (i > 0) {
+        const Vector2 dlos = los_difference(used_los, prev_los);
+        for (Index j = 0; j < 2; j++) {
+          const Numeric dres = res[j] - prev_res[j];
+          if (std::abs(dlos[j]) > 1e-12 and std::abs(dres) > 1e-12) {
+            step[j] = -res[j] * dlos[j] / dres;
+          }
+        }
+      }
+
+      prev_los = used_los;
+      prev_res = res;
+      los      = used_los;
+      los[0]   = std::clamp(los[0] + step[0], 0.0, 180.0);
+      los[1]  += step[1];
     }
   }
 
   Index count = 0;
   do {
-    if (best_beta < angle_cut) return;
+    if (best_beta < angle_cut) return best_los;
 
     {
       los = best_los;
@@ -261,7 +315,7 @@ void find_sun_path(const Workspace& ws,
                                           surface_field,
                                           angle_cut);
 
-      if (hit and just_hit) return;
+      if (hit and just_hit) return los;
       if (beta < best_beta) {
         best_beta = beta;
         best_los = los;
@@ -281,7 +335,7 @@ void find_sun_path(const Workspace& ws,
                                           surface_field,
                                           angle_cut);
 
-      if (hit and just_hit) return;
+      if (hit and just_hit) return los;
       if (beta < best_beta) {
         best_beta = beta;
         best_los = los;
@@ -301,7 +355,7 @@ void find_sun_path(const Workspace& ws,
                                           surface_field,
                                           angle_cut);
 
-      if (hit and just_hit) return;
+      if (hit and just_hit) return los;
       if (beta < best_beta) {
         best_beta = beta;
         best_los = los;
@@ -321,7 +375,7 @@ void find_sun_path(const Workspace& ws,
                                           surface_field,
                                           angle_cut);
 
-      if (hit and just_hit) return;
+      if (hit and just_hit) return los;
       if (beta < best_beta) {
         best_beta = beta;
         best_los = los;
@@ -334,4 +388,6 @@ void find_sun_path(const Workspace& ws,
     if (count < count_limit) continue;
     break;
   } while (true);
+
+  return best_los;
 }
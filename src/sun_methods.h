@@ -2,6 +2,8 @@
 
 #include <sun.h>
 
+#include <optional>
+
 class Agenda;
 class Workspace;
 
@@ -41,9 +43,13 @@ void get_scattered_sunsource(const Workspace& ws,
  *
  * Computes the angular offset between the observer and the sun, and returns the
  * the path in output parameter.  The algorithm first checks the path to the sun
- * as if it was geometric.  It then proceeds to look up, down, left, and right,
- * using a multiple of the angular offset from the sun based on the space-facing
- * point in the ray path.
+ * as if it was geometric, or from the start line-of-sight if one is given.  It
+ * then takes a few secant steps on the line-of-sight, driving the offset of the
+ * line-of-sight leaving the atmosphere from the direction to the sun to zero.
+ *
+ * If that does not reach the sun, it proceeds to look up, down, left, and
+ * right, using a multiple of the angular offset from the sun based on the
+ * space-facing point in the ray path.
  *
  * This multiple starts a 1x the angular offset and is decreased by a factor of
  * 0.5 per level of refinement.  So a refinement of 2 would look at 1x, 0.5x, and
@@ -61,16 +67,20 @@ void get_scattered_sunsource(const Workspace& ws,
  * @param[in] angle_cut Angular cutoff to return the path, see above.
  * @param[in] refinements Refinements of the resolution, see above.
  * @param[in] just_hit If true, exits the moment a sun is hit.
+ * @param[in] start_los The line-of-sight to start from, e.g., the one found
+ *                      for a nearby observer.
+ * @return The line-of-sight of the observer of the best path found.
  */
-void find_sun_path(const Workspace& ws,
-                   ArrayOfPropagationPathPoint& sun_path,
-                   const Sun& sun,
-                   const Agenda& ray_path_observer_agenda,
-                   const SurfaceField& surface_field,
-                   const Vector3 observer_pos,
-                   const Numeric angle_cut,
-                   const Index refinements,
-                   const bool just_hit);
+Vector2 find_sun_path(const Workspace& ws,
+                      ArrayOfPropagationPathPoint& sun_path,
+                      const Sun& sun,
+                      const Agenda& ray_path_observer_agenda,
+                      const SurfaceField& surface_field,
+                      const Vector3 observer_pos,
+                      const Numeric angle_cut,
+                      const Index refinements,
+                      const bool just_hit,
+                      const std::optional<Vector2>& start_los = std::nullopt);
 
 std::pair<Numeric, bool> beta_angle(const Workspace& ws,
                                     ArrayOfPropagationPathPoint& sun_path,
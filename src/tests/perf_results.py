@@ -1,7 +1,13 @@
+import os
 import sys
 import numpy as np
 
+# Optional "--reference DIR" with the output files of an earlier run
+reference = None
 files = sys.argv[1:]
+if len(files) > 1 and files[0] == "--reference":
+    reference = files[1]
+    files = files[2:]
 
 def treat_file(f):
     text = open(f).read().split("\n")
@@ -9,35 +15,52 @@ def treat_file(f):
     n = int(n)
     out = {}
 
+    # Extra columns after the time are counters, e.g., of allocations
+    counts = {}
+
     new = False
     for line in text:
         s = line.split(' ')
-        if len(s) != 2:
+        if len(s) < 2:
             new = True
             continue
 
         if new:
             new = False
-            m, test = line.split(" ")
+            m, test = s
             if test not in out:
                 out[test] = {}
+                counts[test] = {}
             cur = out[test]
             continue
 
-        name, time = line.split(" ")
+        name, time = s[:2]
         if name not in cur:
             cur[name] = []
         cur[name].append(float(time))
+        counts[test][name] = s[2:]
 
     for test in out:
         for name in out[test]:
             if len (out[test][name]) != n:
                 raise ValueError("Number of runs is not consistent")
-            out[test][name] = np.min(out[test][name]), np.max(out[test][name])
+            out[test][name] = np.min(out[test][name]), np.max(out[test][name]), counts[test][name]
     
     return title, out
 
 
+def reference_min(f, test, name):
+    if reference is None:
+        return None
+    ref = os.path.join(reference, os.path.basename(f))
+    if not os.path.exists(ref):
+        return None
+    data = treat_file(ref)[1]
+    if test not in data or name not in data[test]:
+        return None
+    return data[test][name][0]
+
+
 out = {}
 for f in files:
     out[f] = treat_file(f)
@@ -46,17 +69,35 @@ for f in out:
     title = out[f][0]
     data = out[f][1]
     print(f".. list-table:: {title}")
-    print( "    :widths: 80 14 14")
+    if reference is None:
+        print( "    :widths: 80 14 14")
+    else:
+        print( "    :widths: 60 14 14 14 14")
     print( "    :header-rows: 1")
     print()
     print( "    * - Test")
     print( "      - Min (μs)")
     print( "      - Max (μs)")
+    if reference is not None:
+        print( "      - Reference min (μs)")
+        print( "      - Change (%)")
     for test in data:
         for name in data[test]:
             min_us = round(1e6 * data[test][name][0])
             max_us = round(1e6 * data[test][name][1])
-            print(f"    * - ``{name}``")
+            if len(data[test][name][2]):
+                print(f"    * - ``{name}`` [{' '.join(data[test][name][2])}]")
+            else:
+                print(f"    * - ``{name}``")
             print(f"      - {min_us}")
             print(f"      - {max_us}")
+            if reference is not None:
+                ref = reference_min(f, test, name)
+                if ref is None or ref == 0:
+                    print( "      - ")
+                    print( "      - ")
+                else:
+                    change = round(100 * (data[test][name][0] - ref) / ref, 1)
+                    print(f"      - {round(1e6 * ref)}")
+                    print(f"      - {change:+}")
     print()
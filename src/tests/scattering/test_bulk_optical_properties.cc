@@ -0,0 +1,222 @@
+#include <iostream>
+
+#include "bulk_optical_properties.h"
+#include "matpack_math.h"
+#include "psd.h"
+#include "test_utils.h"
+
+using TROData =
+    scattering::SingleScatteringData<Numeric,
+                                     scattering::Format::TRO,
+                                     scattering::Representation::Gridded,
+                                     1>;
+
+TROData make_random_ssd(std::shared_ptr<const Vector> t_grid,
+                        std::shared_ptr<const Vector> f_grid) {
+  auto za_scat_grid = std::make_shared<scattering::IrregularLatitudeGrid>(
+      Vector{0.0, 90.0, 180.0});
+
+  scattering::PhaseMatrixData<Numeric,
+                              scattering::Format::TRO,
+                              scattering::Representation::Gridded,
+                              1>
+      phase_matrix(t_grid, f_grid, za_scat_grid);
+  scattering::ExtinctionMatrixData<Numeric,
+                                   scattering::Format::TRO,
+                                   scattering::Representation::Gridded,
+                                   1>
+      extinction_matrix(t_grid, f_grid);
+  scattering::AbsorptionVectorData<Numeric,
+                                   scattering::Format::TRO,
+                                   scattering::Representation::Gridded,
+                                   1>
+      absorption_vector(t_grid, f_grid);
+  extinction_matrix = random_tensor<Tensor3>(extinction_matrix.shape());
+  absorption_vector = random_tensor<Tensor3>(absorption_vector.shape());
+
+  auto backscatter_matrix    = phase_matrix.extract_backscatter_matrix();
+  auto forwardscatter_matrix = phase_matrix.extract_forwardscatter_matrix();
+  return TROData(phase_matrix,
+                 extinction_matrix,
+                 absorption_vector,
+                 backscatter_matrix,
+                 forwardscatter_matrix);
+}
+
+/** Reference bulk properties from regridding each element separately */
+void reference_bulk(Vector& ext,
+                    Vector& abs,
+                    std::vector<TROData> ssd,
+                    const Vector& pnd,
+                    Numeric t,
+                    const Vector& f_grid) {
+  ext = 0.0;
+  abs = 0.0;
+
+  auto t_grid_new = std::make_shared<Vector>(Vector{t});
+  auto f_grid_new = std::make_shared<Vector>(f_grid);
+  scattering::ScatteringDataGrids grids(t_grid_new, f_grid_new, nullptr);
+
+  for (Size i = 0; i < ssd.size(); i++) {
+    auto& ext_data = ssd[i].extinction_matrix;
+    auto& abs_data = ssd[i].absorption_vector;
+    auto weights   = calc_regrid_weights(ext_data.get_t_grid(),
+                                       ext_data.get_f_grid(),
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       grids);
+    auto ext_interp = ext_data.regrid(grids, weights);
+    auto abs_interp = abs_data.regrid(grids, weights);
+    for (Index iv = 0; iv < f_grid.size(); iv++) {
+      ext[iv] += pnd[i] * ext_interp(0, iv, 0);
+      abs[iv] += pnd[i] * abs_interp(0, iv, 0);
+    }
+  }
+}
+
+bool test_bulk_optical_properties() {
+  auto f_grid = std::make_shared<Vector>(Vector{1e9, 10e9, 100e9, 200e9});
+  std::vector<TROData> ssd;
+  ssd.push_back(make_random_ssd(
+      std::make_shared<Vector>(Vector{210.0, 240.0, 270.0}), f_grid));
+  ssd.push_back(make_random_ssd(
+      std::make_shared<Vector>(Vector{200.0, 230.0, 260.0, 290.0}), f_grid));
+  ssd.push_back(make_random_ssd(
+      std::make_shared<Vector>(Vector{220.0, 250.0}), f_grid));
+
+  const Vector f_grid_new{2e9, 50e9, 100e9, 150e9, 199e9};
+  const scattering::BulkOpticalProperties bulk(ssd, f_grid_new);
+
+  const Vector pnd{1.0, 0.5, 2.0};
+  Vector ext(f_grid_new.size()), abs(f_grid_new.size());
+  Vector ext_ref(f_grid_new.size()), abs_ref(f_grid_new.size());
+
+  for (Numeric t : {225.0, 238.0, 249.0}) {
+    bulk.compute(ext, abs, pnd, t);
+    reference_bulk(ext_ref, abs_ref, ssd, pnd, t, f_grid_new);
+
+    if (max_error<VectorView>(ext, ext_ref) > 1e-10) return false;
+    if (max_error<VectorView>(abs, abs_ref) > 1e-10) return false;
+  }
+
+  // The temperature derivative is exact for linear interpolation as long as
+  // the perturbation does not cross a grid point
+  const Numeric t  = 235.0;
+  const Numeric dt = 0.1;
+  Vector dw(bulk.n_weights());
+  bulk.dweights_dt(dw, pnd, t);
+  Vector dext(f_grid_new.size()), dabs(f_grid_new.size());
+  bulk.contract(dext, dabs, dw);
+
+  bulk.compute(ext, abs, pnd, t);
+  bulk.compute(ext_ref, abs_ref, pnd, t + dt);
+  for (Index iv = 0; iv < f_grid_new.size(); iv++) {
+    if (std::abs((ext_ref[iv] - ext[iv]) / dt - dext[iv]) > 1e-8) return false;
+    if (std::abs((abs_ref[iv] - abs[iv]) / dt - dabs[iv]) > 1e-8) return false;
+  }
+
+  return true;
+}
+
+/** The legacy data equivalent of new-style TRO data */
+SingleScatteringData to_legacy(const TROData& ssd) {
+  const auto& ext = ssd.extinction_matrix;
+  const auto& abs = ssd.absorption_vector;
+  const Index nt  = ext.get_t_grid()->size();
+  const Index nf  = ext.get_f_grid()->size();
+
+  SingleScatteringData out;
+  out.ptype  = PTYPE_TOTAL_RND;
+  out.f_grid = *ext.get_f_grid();
+  out.T_grid = *ext.get_t_grid();
+  out.ext_mat_data.resize(nf, nt, 1, 1, 1);
+  out.abs_vec_data.resize(nf, nt, 1, 1, 1);
+  for (Index iv = 0; iv < nf; iv++) {
+    for (Index it = 0; it < nt; it++) {
+      out.ext_mat_data(iv, it, 0, 0, 0) = ext(it, iv, 0);
+      out.abs_vec_data(iv, it, 0, 0, 0) = abs(it, iv, 0);
+    }
+  }
+  return out;
+}
+
+bool test_bulk_optical_properties_psd() {
+  auto f_grid = std::make_shared<Vector>(Vector{1e9, 10e9, 100e9, 200e9});
+  std::vector<TROData> ssd;
+  ssd.push_back(make_random_ssd(
+      std::make_shared<Vector>(Vector{210.0, 240.0, 270.0}), f_grid));
+  ssd.push_back(make_random_ssd(
+      std::make_shared<Vector>(Vector{200.0, 230.0, 260.0, 290.0}), f_grid));
+  ssd.push_back(make_random_ssd(
+      std::make_shared<Vector>(Vector{220.0, 250.0}), f_grid));
+
+  ArrayOfSingleScatteringData legacy;
+  for (auto& s : ssd) legacy.push_back(to_legacy(s));
+
+  const Vector f_grid_new{2e9, 50e9, 100e9, 150e9, 199e9};
+  const scattering::BulkOpticalProperties bulk(ssd, f_grid_new);
+  const scattering::BulkOpticalProperties bulk_legacy(legacy, f_grid_new);
+
+  const ScatteringSpeciesProperty ice{"ice", ParticulateProperty::MassDensity};
+  const scattering::PSD psd = MGDSingleMoment(ice, "Abel12", 0.0, 400.0, false);
+  const Vector sizes{1e-4, 2e-4, 4e-4};
+  const Numeric a = 0.02;
+  const Numeric b = 2.0;
+
+  AtmPoint atm_point;
+  atm_point.temperature = 235.0;
+  atm_point[ice]        = 1e-4;
+
+  // Explicit number densities: the PSD times the trapezoidal bin widths
+  const Vector dndd = std::get<MGDSingleMoment>(psd).evaluate(
+      atm_point, sizes, a, b);
+  const Vector pnd{dndd[0] * 0.5 * (sizes[1] - sizes[0]),
+                   dndd[1] * 0.5 * (sizes[2] - sizes[0]),
+                   dndd[2] * 0.5 * (sizes[2] - sizes[1])};
+
+  const Vector pnd_psd = scattering::pnd_from_psd(psd, atm_point, sizes, a, b);
+  if (max_error(pnd, pnd_psd) > 1e-10 * max(pnd)) {
+    return false;
+  }
+
+  Vector ext(f_grid_new.size()), abs(f_grid_new.size());
+  Vector ext_ref(f_grid_new.size()), abs_ref(f_grid_new.size());
+  bulk.compute(ext, abs, psd, atm_point, sizes, a, b);
+  reference_bulk(ext_ref, abs_ref, ssd, pnd, atm_point.temperature, f_grid_new);
+
+  const Numeric tol = 1e-10 * max(ext_ref);
+  if (max_error<VectorView>(ext, ext_ref) > tol) return false;
+  if (max_error<VectorView>(abs, abs_ref) > tol) return false;
+
+  // Legacy data gives the same tables
+  bulk_legacy.compute(ext, abs, psd, atm_point, sizes, a, b);
+  if (max_error<VectorView>(ext, ext_ref) > tol) return false;
+  if (max_error<VectorView>(abs, abs_ref) > tol) return false;
+
+  return true;
+}
+
+int main() {
+  bool passed = false;
+  std::cout << "Testing bulk optical properties (TRO): ";
+  passed = test_bulk_optical_properties();
+  if (passed) {
+    std::cout << "PASSED." << std::endl;
+  } else {
+    std::cout << "FAILED." << std::endl;
+    return 1;
+  }
+
+  std::cout << "Testing bulk optical properties from a PSD (TRO): ";
+  passed = test_bulk_optical_properties_psd();
+  if (passed) {
+    std::cout << "PASSED." << std::endl;
+  } else {
+    std::cout << "FAILED." << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
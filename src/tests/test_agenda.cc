@@ -0,0 +1,140 @@
+#include <workspace.h>
+
+#include <stdexcept>
+
+//! Methods find their arguments via slots;  check they find the right ones
+void test_method_slots() {
+  Workspace ws{WorkspaceInitialization::Empty};
+  ws.set("species_a", ArrayOfString{"H2O", "O2"});
+  ws.set("species_b", ArrayOfString{"N2"});
+
+  const Method ma{"absorption_speciesSet",
+                  std::vector<std::string>{},
+                  std::unordered_map<std::string, std::string>{
+                      {"species", "species_a"}}};
+  const Method mb{"absorption_speciesSet",
+                  std::vector<std::string>{"other_species", "species_b"},
+                  std::unordered_map<std::string, std::string>{}};
+
+  ma(ws);
+  mb(ws);
+  ARTS_USER_ERROR_IF(
+      ws.get<ArrayOfArrayOfSpeciesTag>("absorption_species").size() != 2,
+      "Wrong input or output variable via slots")
+  ARTS_USER_ERROR_IF(
+      ws.get<ArrayOfArrayOfSpeciesTag>("other_species").size() != 1,
+      "Wrong renamed input or output variable via slots")
+
+  // A slot looks up the same variable as its name does
+  const WorkspaceSlot slot{"species_a"};
+  ARTS_USER_ERROR_IF(&ws.get<ArrayOfString>(slot) !=
+                         &ws.get<ArrayOfString>("species_a"),
+                     "Slot and name lookup differ")
+
+  // Copies must not use the slots the original has looked up
+  Workspace copy = ws.deepcopy();
+  copy.set("species_a", ArrayOfString{"CO2"});
+  ma(copy);
+  ARTS_USER_ERROR_IF(
+      copy.get<ArrayOfArrayOfSpeciesTag>("absorption_species").size() != 1,
+      "Copied workspace did not use its own variables")
+  ARTS_USER_ERROR_IF(
+      ws.get<ArrayOfArrayOfSpeciesTag>("absorption_species").size() != 2,
+      "Copied workspace changed the original")
+
+  // Variables added after a failed lookup are found
+  const Method mc{"absorption_speciesSet",
+                  std::vector<std::string>{},
+                  std::unordered_map<std::string, std::string>{
+                      {"species", "species_c"}}};
+  bool threw = false;
+  try {
+    mc(copy);
+  } catch (std::exception&) {
+    threw = true;
+  }
+  ARTS_USER_ERROR_IF(not threw, "Undefined input did not throw")
+  copy.set("species_c", ArrayOfString{"O3", "CO", "NO"});
+  mc(copy);
+  ARTS_USER_ERROR_IF(
+      copy.get<ArrayOfArrayOfSpeciesTag>("absorption_species").size() != 3,
+      "Variable set after a failed lookup not found")
+
+  // A moved workspace keeps working
+  Workspace moved = std::move(copy);
+  moved.set("species_c", ArrayOfString{"O3"});
+  mc(moved);
+  ARTS_USER_ERROR_IF(
+      moved.get<ArrayOfArrayOfSpeciesTag>("absorption_species").size() != 1,
+      "Moved workspace did not use its own variables")
+}
+
+//! A pooled agenda call must see the same workspace as a plain one
+void test_pooled_agenda() {
+  Agenda ag("pooled-test-agenda");
+  ag.add(Method{"model_state_vectorZero",
+                std::vector<std::string>{},
+                std::unordered_map<std::string, std::string>{}});
+  ag.add(Method{"absorption_speciesSet",
+                std::vector<std::string>{},
+                std::unordered_map<std::string, std::string>{
+                    {"species", "species_in"}}});
+  ag.finalize();
+
+  ARTS_USER_ERROR_IF(
+      ag.get_copy() != std::vector<std::string>{"model_state_vector"},
+      "Expected model_state_vector to be copied")
+
+  Workspace ws{WorkspaceInitialization::Empty};
+  AgendaWorkspacePool pool;
+
+  ws.set("model_state_vector", Vector{1, 2, 3});
+  ws.set("species_in", ArrayOfString{"H2O", "O2"});
+
+  Wsv held;
+  {
+    auto fork = pool.acquire();
+    fork.copy_workspace(ag, ws);
+    fork.execute(ag);
+
+    // Something keeps a handle to the local copy past the call
+    held = fork.ws().share("model_state_vector");
+  }
+
+  ws.set("model_state_vector", Vector{4, 5});
+  ws.set("species_in", ArrayOfString{"N2"});
+
+  auto fork = pool.acquire();
+  fork.copy_workspace(ag, ws);
+  fork.execute(ag);
+
+  Workspace plain = ag.copy_workspace(ws);
+  ag.execute(plain);
+
+  const auto& msv_pool  = fork.ws().get<Vector>("model_state_vector");
+  const auto& msv_plain = plain.get<Vector>("model_state_vector");
+  ARTS_USER_ERROR_IF(msv_pool != msv_plain,
+                     "Pooled and plain agenda calls differ:\n{:B,}\n{:B,}",
+                     msv_pool,
+                     msv_plain)
+
+  const auto& spec_pool =
+      fork.ws().get<ArrayOfArrayOfSpeciesTag>("absorption_species");
+  const auto& spec_plain =
+      plain.get<ArrayOfArrayOfSpeciesTag>("absorption_species");
+  ARTS_USER_ERROR_IF(spec_pool != spec_plain,
+                     "Pooled and plain agenda calls differ:\n{}\n{}",
+                     spec_pool,
+                     spec_plain)
+
+  ARTS_USER_ERROR_IF(ws.get<Vector>("model_state_vector") != Vector{4, 5},
+                     "Pooled agenda call changed a copied input")
+
+  ARTS_USER_ERROR_IF(held.get<Vector>() != Vector{0, 0, 0},
+                     "Pooled agenda call changed a handle from an earlier call")
+}
+
+int main() {
+  test_method_slots();
+  test_pooled_agenda();
+}
@@ -0,0 +1,102 @@
+#include <workspace.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <tuple>
+
+#include "test_perf.h"
+
+//! A small agenda, as is typical for the inner propagation matrix agendas
+Agenda small_agenda(Index nmethods) {
+  Agenda ag("perf-test-agenda");
+  for (Index i = 0; i < nmethods; i++) {
+    ag.add(Method{"Ignore",
+                  std::vector<std::string>{var_string("x", i)},
+                  std::unordered_map<std::string, std::string>{}});
+  }
+  ag.finalize();
+  return ag;
+}
+
+Array<Timing> test_agenda_dispatch(Index n) {
+  constexpr Index nmethods = 4;
+
+  Workspace ws{WorkspaceInitialization::Empty};
+  for (Index i = 0; i < nmethods; i++) {
+    ws.set(var_string("x", i), Wsv{Numeric{1.0}});
+  }
+
+  const Agenda ag = small_agenda(nmethods);
+
+  Array<Timing> out;
+
+  //! How the method wrappers used to find their arguments: by name, on every call
+  out.emplace_back("wsv-lookup-by-name")([&]() {
+    for (Index i = 0; i < n; i++) {
+      for (auto& m : ag.get_methods()) {
+        for (auto& arg : m.get_ins()) std::ignore = ws.get<Numeric>(arg);
+      }
+    }
+  });
+
+  //! The arguments are resolved to slots when the Method is created
+  out.emplace_back("wsv-lookup-by-slot")([&]() {
+    std::vector<WorkspaceSlot> slots;
+    for (auto& m : ag.get_methods()) {
+      for (auto& arg : m.get_ins()) slots.emplace_back(arg);
+    }
+
+    for (Index i = 0; i < n; i++) {
+      for (auto& slot : slots) std::ignore = ws.get<Numeric>(slot);
+    }
+  });
+
+  //! The method is resolved when the Method is created
+  out.emplace_back("method-pre-resolved")([&]() {
+    for (Index i = 0; i < n; i++) {
+      for (auto& m : ag.get_methods()) m(ws);
+    }
+  });
+
+  out.emplace_back("agenda-execute")([&]() {
+    for (Index i = 0; i < n; i++) ag.execute(ws);
+  });
+
+  out.emplace_back("agenda-copy-workspace-and-execute")([&]() {
+    for (Index i = 0; i < n; i++) {
+      Workspace lws = ag.copy_workspace(ws);
+      ag.execute(lws);
+    }
+  });
+
+  //! As the named agenda calls, reusing the local workspace between calls
+  out.emplace_back("agenda-pooled-fork-and-execute")([&]() {
+    AgendaWorkspacePool pool;
+    for (Index i = 0; i < n; i++) {
+      auto fork = pool.acquire();
+      fork.copy_workspace(ag, ws);
+      fork.execute(ag);
+    }
+  });
+
+  return out;
+}
+
+int main(int argc, char** c) {
+  std::array<Index, 1> N;
+  if (static_cast<std::size_t>(argc) < 1 + 1 + N.size()) {
+    std::cerr << "Expects PROGNAME NREPEAT NSIZE..., wehere NSIZE is "
+              << N.size() << " indices\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto n = static_cast<Index>(std::atoll(c[1]));
+  for (std::size_t i = 0; i < N.size(); i++)
+    N[i] = static_cast<Index>(std::atoll(c[2 + i]));
+
+  std::cout << n << " agenda-performance-tests\n\n";
+  for (Index i = 0; i < n; i++) {
+    std::cout << N[0] << " agenda_dispatch\n"
+              << test_agenda_dispatch(N[0]) << '\n';
+  }
+}
@@ -0,0 +1,135 @@
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "atm.h"
+#include "debug.h"
+#include "igrf13.h"
+
+namespace {
+struct Position {
+  Numeric alt, lat, lon;
+};
+
+//! More positions than the cache holds, so that entries are replaced
+std::vector<Position> positions() {
+  std::vector<Position> out;
+  for (Index i = 0; i < 21; i++) {
+    out.push_back({1e3 * static_cast<Numeric>(i),
+                   -80.0 + 7.5 * static_cast<Numeric>(i),
+                   -170.0 + 16.0 * static_cast<Numeric>(i)});
+  }
+  return out;
+}
+
+Vector synthetic(Numeric alt, Numeric lat, Numeric lon) {
+  return Vector{std::sin(alt) + lat, std::cos(lat) * lon, alt * lon};
+}
+
+//! Cached outputs must equal the function, in any order of the outputs
+void test_cached_equals_uncached() {
+  std::atomic<Size> ncalls{0};
+  const Atm::MultiFunctionalData data{
+      [&ncalls](Numeric alt, Numeric lat, Numeric lon) {
+        ncalls++;
+        return synthetic(alt, lat, lon);
+      },
+      3};
+
+  // A second instance at the same positions must not share cache entries
+  const Atm::MultiFunctionalData other{
+      [](Numeric alt, Numeric lat, Numeric lon) {
+        Vector out = synthetic(alt, lat, lon);
+        out       *= -1.0;
+        return out;
+      },
+      3};
+
+  const std::vector<Atm::FunctionalData> f{
+      data.component(0), data.component(1), data.component(2)};
+  const std::vector<Atm::FunctionalData> g{
+      other.component(0), other.component(1), other.component(2)};
+
+  const auto pos = positions();
+  constexpr Size npass = 3;
+  for (Size pass = 0; pass < npass; pass++) {
+    for (auto [alt, lat, lon] : pos) {
+      const Vector ref = synthetic(alt, lat, lon);
+      for (Size i : {2, 0, 1}) {
+        const Numeric x = f[i](alt, lat, lon);
+        const Numeric y = g[i](alt, lat, lon);
+        ARTS_USER_ERROR_IF(x != ref[i] or y != -ref[i],
+                           "Output {} at ({}, {}, {}) is {} and {}, not {}",
+                           i,
+                           alt,
+                           lat,
+                           lon,
+                           x,
+                           y,
+                           ref[i])
+      }
+    }
+  }
+
+  // One call per position and pass, whichever output is asked for first
+  ARTS_USER_ERROR_IF(ncalls != npass * pos.size(),
+                     "Expected {} calls, got {}",
+                     npass * pos.size(),
+                     ncalls.load())
+}
+
+//! As above, but evaluated by many threads at once
+void test_threads() {
+  const Atm::MultiFunctionalData data{synthetic, 3};
+  const auto pos = positions();
+
+  const Index n = static_cast<Index>(pos.size()) * 3;
+  Vector res(n), ref(n);
+#pragma omp parallel for
+  for (Index k = 0; k < n; k++) {
+    const auto [alt, lat, lon] = pos[k / 3];
+    res[k] = data(static_cast<Size>(k % 3), alt, lat, lon);
+    ref[k] = synthetic(alt, lat, lon)[k % 3];
+  }
+
+  for (Index k = 0; k < n; k++) {
+    ARTS_USER_ERROR_IF(
+        res[k] != ref[k], "Thread result {} is {}, not {}", k, res[k], ref[k])
+  }
+}
+
+//! The shared IGRF evaluation must equal separate evaluations
+void test_igrf() {
+  static constexpr Vector2 ell{6378137., 6356752.314245};
+  const Time time{};
+
+  const Atm::MultiFunctionalData mag{
+      [time](Numeric h, Numeric lat, Numeric lon) {
+        const Vector3 m = IGRF::igrf({h, lat, lon}, ell, time);
+        return Vector{m[0], m[1], m[2]};
+      },
+      3};
+
+  for (auto [alt, lat, lon] : positions()) {
+    const Vector3 ref = IGRF::igrf({alt, lat, lon}, ell, time);
+    for (Size i = 0; i < 3; i++) {
+      const Numeric x = mag.component(i)(alt, lat, lon);
+      ARTS_USER_ERROR_IF(
+          x != ref[i], "IGRF component {} is {}, not {}", i, x, ref[i])
+    }
+  }
+}
+}  // namespace
+
+int main() try {
+  test_cached_equals_uncached();
+  test_threads();
+  test_igrf();
+  std::cout << "All multi-output functional data tests passed\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
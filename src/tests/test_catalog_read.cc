@@ -0,0 +1,274 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include "absorptionlines.h"
+#include "debug.h"
+#include "m_absorptionlines.h"
+
+namespace {
+/*! A HITRAN 2004 record of 160 characters
+
+@param id The molecule (2) and isotopologue (1) field
+@param v The position field (12)
+@param s The intensity field (10)
+*/
+String hitran_record(std::string_view id,
+                     std::string_view v,
+                     std::string_view s) {
+  String out{id};
+  out += v;
+  out += s;
+  out += " 1.500E-05.0800.4000  100.50000.75-0.00300";
+  out += String(60, ' ');  // Quanta
+  out += "000000";
+  out += String(13, ' ');  // References and line mixing flag
+  out += "    9.0    7.0";
+  ARTS_USER_ERROR_IF(out.size() != 160, "Bad test record:\n{}", out)
+  return out;
+}
+
+String write_catalog(const String& name, const std::vector<String>& records) {
+  const auto path = std::filesystem::temp_directory_path() / name;
+  std::ofstream os(path);
+  for (auto& record : records) os << record << '\n';
+  return path.string();
+}
+
+void set_options(ArrayOfAbsorptionLines& abs_lines) {
+  abs_linesNormalization(abs_lines, "None");
+  abs_linesMirroring(abs_lines, "None");
+  abs_linesPopulation(abs_lines, "LTE");
+  abs_linesLineShapeType(abs_lines, "VP");
+  abs_linesCutoff(abs_lines, "None", -1);
+  abs_linesLinemixingLimit(abs_lines, -1);
+}
+
+//! The sequential HITRAN 2004 reader that ReadHITRAN replaced
+ArrayOfAbsorptionLines old_read_hitran(const String& file,
+                                       const Numeric fmin,
+                                       const Numeric fmax) {
+  const auto global_nums = string2vecqn("DEFAULT_GLOBAL");
+  const auto local_nums  = string2vecqn("DEFAULT_LOCAL");
+
+  std::ifstream is(file);
+  ArrayOfAbsorptionLines abs_lines(0);
+  ArrayOfAbsorptionLines local_bands(0);
+  while (true) {
+    auto sline = Absorption::ReadFromHitran2004Stream(is);
+    if (sline.bad) {
+      if (is.eof()) break;
+      ARTS_USER_ERROR("Cannot read line {}",
+                      size(abs_lines) + size(local_bands) + 1);
+    }
+    if (sline.line.F0 < fmin) continue;
+    if (sline.line.F0 > fmax) break;
+    sline.line.zeeman = Zeeman::GetAdvancedModel(sline.quantumidentity);
+    const QuantumIdentifier global_qid =
+        global_quantumidentifier(global_nums, sline.quantumidentity);
+    for (auto qn : local_nums) {
+      if (sline.quantumidentity.val.has(qn)) {
+        sline.line.localquanta.val.set(sline.quantumidentity.val[qn]);
+      }
+    }
+    merge_external_line(local_bands, sline, global_qid);
+  }
+  merge_local_lines(abs_lines, local_bands);
+
+  set_options(abs_lines);
+  return abs_lines;
+}
+
+//! The sequential JPL reader that ReadJPL replaced
+ArrayOfAbsorptionLines old_read_jpl(const String& file,
+                                    const Numeric fmin,
+                                    const Numeric fmax) {
+  const auto global_nums = string2vecqn("DEFAULT_GLOBAL");
+  const auto local_nums  = string2vecqn("DEFAULT_LOCAL");
+
+  std::ifstream is(file);
+  std::vector<Absorption::SingleLineExternal> v(0);
+  while (true) {
+    v.push_back(Absorption::ReadFromJplStream(is));
+    if (v.back().bad) {
+      v.pop_back();
+      break;
+    }
+    if (v.back().line.F0 < fmin) {
+      v.pop_back();
+    } else if (v.back().line.F0 > fmax) {
+      v.pop_back();
+      break;
+    }
+  }
+
+  for (auto& x : v) x.line.zeeman = Zeeman::GetAdvancedModel(x.quantumidentity);
+
+  auto x = Absorption::split_list_of_external_lines(v, local_nums, global_nums);
+  ArrayOfAbsorptionLines abs_lines(0);
+  while (x.size()) {
+    abs_lines.push_back(x.back());
+    abs_lines.back().sort_by_frequency();
+    x.pop_back();
+  }
+
+  set_options(abs_lines);
+  return abs_lines;
+}
+
+ArrayOfAbsorptionLines read_hitran(const String& file,
+                                   const Numeric fmin,
+                                   const Numeric fmax) {
+  ArrayOfAbsorptionLines abs_lines;
+  ReadHITRAN(abs_lines,
+             file,
+             fmin,
+             fmax,
+             "DEFAULT_GLOBAL",
+             "DEFAULT_LOCAL",
+             "Post2004",
+             "None",
+             "None",
+             "LTE",
+             "VP",
+             "None",
+             -1,
+             -1);
+  return abs_lines;
+}
+
+ArrayOfAbsorptionLines read_jpl(const String& file,
+                                const Numeric fmin,
+                                const Numeric fmax) {
+  ArrayOfAbsorptionLines abs_lines;
+  ReadJPL(abs_lines,
+          file,
+          fmin,
+          fmax,
+          "DEFAULT_GLOBAL",
+          "DEFAULT_LOCAL",
+          "None",
+          "None",
+          "LTE",
+          "VP",
+          "None",
+          -1,
+          -1);
+  return abs_lines;
+}
+
+void compare(const ArrayOfAbsorptionLines& lines,
+             const ArrayOfAbsorptionLines& ref,
+             const Size nbands,
+             const Size nlines,
+             std::string_view what) {
+  ARTS_USER_ERROR_IF(lines.size() != ref.size(),
+                     "{}: {} bands but the old reader gives {}",
+                     what,
+                     lines.size(),
+                     ref.size())
+  ARTS_USER_ERROR_IF(lines.size() != nbands,
+                     "{}: {} bands but expected {}",
+                     what,
+                     lines.size(),
+                     nbands)
+
+  Size n = 0;
+  for (Size i = 0; i < lines.size(); i++) {
+    std::ostringstream a, b;
+    a << lines[i].MetaData() << lines[i];
+    b << ref[i].MetaData() << ref[i];
+    ARTS_USER_ERROR_IF(a.str() != b.str(),
+                       "{}: band {} differs from the old reader:\n{}\nvs\n{}",
+                       what,
+                       i,
+                       a.str(),
+                       b.str())
+    n += static_cast<Size>(lines[i].NumLines());
+  }
+
+  ARTS_USER_ERROR_IF(
+      n != nlines, "{}: {} lines but expected {}", what, n, nlines)
+}
+
+void test_hitran() {
+  const std::vector<String> records{
+      hitran_record(" 11", "   10.000000", " 1.234E-20"),
+      hitran_record(" 12", "   11.500000", " 2.500E-22"),
+      hitran_record(" 31", "   12.250000", " 3.000E-21"),
+      hitran_record(" 11", "   13.000000", " 4.500E-20"),
+      hitran_record(" 12", "   14.750000", " 1.000E-23"),
+      hitran_record(" 31", "   15.500000", " 6.000E-21")};
+  const String file = write_catalog("arts_test_catalog_read.par", records);
+
+  constexpr Numeric inf = std::numeric_limits<Numeric>::infinity();
+  compare(read_hitran(file, -inf, inf),
+          old_read_hitran(file, -inf, inf),
+          3,
+          6,
+          "HITRAN");
+
+  // From 11 to 15 cm-1
+  compare(read_hitran(file, 330e9, 449e9),
+          old_read_hitran(file, 330e9, 449e9),
+          3,
+          4,
+          "HITRAN window");
+
+  // A malformed record is an error
+  std::vector<String> bad_records = records;
+  bad_records.insert(bad_records.begin() + 2, "This is not a HITRAN record");
+  const String bad_file =
+      write_catalog("arts_test_catalog_read_bad.par", bad_records);
+  bool failed = false;
+  try {
+    read_hitran(bad_file, -inf, inf);
+  } catch (std::exception&) {
+    failed = true;
+  }
+  ARTS_USER_ERROR_IF(not failed, "A malformed HITRAN record was accepted")
+
+  std::filesystem::remove(file);
+  std::filesystem::remove(bad_file);
+}
+
+void test_jpl() {
+  // The zero-frequency record is skipped as a comment
+  const std::vector<String> records{
+      "   60306.0440  0.0500 -5.1234 3   12.3456  7  32001 1404",
+      "         0.0000 comment",
+      "   61150.5570  0.0500 -5.1234 3   12.3456  7 -18003 1404",
+      "   62486.2550  0.0500 -5.1234 3   12.3456  7  32001 1404",
+      "   63568.5260  0.0500 -5.1234 3   12.3456  7  18003 1404"};
+  const String file = write_catalog("arts_test_catalog_read.cat", records);
+
+  constexpr Numeric inf = std::numeric_limits<Numeric>::infinity();
+  compare(read_jpl(file, -inf, inf),
+          old_read_jpl(file, -inf, inf),
+          2,
+          4,
+          "JPL");
+
+  compare(read_jpl(file, 61e9, 63e9),
+          old_read_jpl(file, 61e9, 63e9),
+          2,
+          2,
+          "JPL window");
+
+  std::filesystem::remove(file);
+}
+}  // namespace
+
+int main() try {
+  test_hitran();
+  test_jpl();
+  std::cout << "All catalog reading tests passed\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
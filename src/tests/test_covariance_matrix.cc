@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+#include "covariance_matrix.h"
+#include "debug.h"
+#include "lin_alg.h"
+#include "matpack_math.h"
+
+namespace {
+//! The largest absolute difference of A and B relative to the largest of B
+Numeric relative_difference(ConstMatrixView A, ConstMatrixView B) {
+  Numeric diff = 0.0, scale = 0.0;
+  for (Index i = 0; i < A.nrows(); i++) {
+    for (Index j = 0; j < A.ncols(); j++) {
+      diff  = std::max(diff, std::abs(A(i, j) - B(i, j)));
+      scale = std::max(scale, std::abs(B(i, j)));
+    }
+  }
+  return diff / scale;
+}
+
+Numeric relative_difference(ConstVectorView a, ConstVectorView b) {
+  Numeric diff = 0.0, scale = 0.0;
+  for (Index i = 0; i < a.size(); i++) {
+    diff  = std::max(diff, std::abs(a[i] - b[i]));
+    scale = std::max(scale, std::abs(b[i]));
+  }
+  return diff / scale;
+}
+
+void add_diagonal_block(CovarianceMatrix& covmat,
+                        Index index,
+                        Index offset,
+                        BlockMatrix matrix) {
+  const Range r(offset, matrix.nrows());
+  covmat.add_correlation(Block(r, r, {index, index}, std::move(matrix)));
+}
+
+//! A diagonal sparse block
+Sparse diagonal(Index n) {
+  Sparse S(n, n);
+  for (Index i = 0; i < n; i++) S.rw(i, i) = 0.5 + 0.25 * i;
+  return S;
+}
+
+//! A dense block with Markov correlation
+Matrix markov(Index n) {
+  Matrix C(n, n);
+  for (Index i = 0; i < n; i++) {
+    for (Index j = 0; j < n; j++) {
+      const Numeric si = 1.0 + 0.1 * i, sj = 1.0 + 0.1 * j;
+      C(i, j) = si * sj * std::pow(0.7, std::abs(i - j));
+    }
+  }
+  return C;
+}
+
+//! A general dense symmetric positive definite block
+Matrix dense(Index n) {
+  Matrix C(n, n);
+  for (Index i = 0; i < n; i++) {
+    for (Index j = 0; j < n; j++) {
+      C(i, j) = 1.0 / static_cast<Numeric>(1 + i + j);
+    }
+    C(i, i) += 1.0;
+  }
+  return C;
+}
+
+//! A banded sparse block
+Sparse banded(Index n) {
+  Sparse S(n, n);
+  for (Index i = 0; i < n; i++) {
+    S.rw(i, i) = 4.0;
+    if (i > 0) S.rw(i, i - 1) = -1.0;
+    if (i < n - 1) S.rw(i, i + 1) = -1.0;
+  }
+  return S;
+}
+
+//! Compare all inverse operations of covmat with the dense inverse
+void check(const CovarianceMatrix& covmat, std::string_view what) {
+  constexpr Numeric tolerance = 1e-10;
+
+  const Index n = covmat.nrows();
+  const Matrix S(covmat);
+  Matrix Sinv(n, n);
+  inv(Sinv, S);
+
+  Matrix A(n, 3);
+  for (Index i = 0; i < n; i++) {
+    for (Index j = 0; j < 3; j++) A(i, j) = std::sin(1.0 + i + 7.0 * j);
+  }
+
+  Matrix ref(n, 3), C(n, 3);
+  mult(ref, Sinv, A);
+  mult_inv(C, covmat, A);
+  ARTS_USER_ERROR_IF(relative_difference(C, ref) > tolerance,
+                     "{}: mult_inv(C, S, A) differs from inv(S) A",
+                     what)
+
+  const Matrix At{transpose(A)};
+  Matrix reft(3, n), Ct(3, n);
+  mult(reft, At, Sinv);
+  mult_inv(Ct, At, covmat);
+  ARTS_USER_ERROR_IF(relative_difference(Ct, reft) > tolerance,
+                     "{}: mult_inv(C, A, S) differs from A inv(S)",
+                     what)
+
+  Vector w(n);
+  solve(w, covmat, A(joker, 0));
+  ARTS_USER_ERROR_IF(relative_difference(w, ref(joker, 0)) > tolerance,
+                     "{}: solve differs from inv(S) v",
+                     what)
+
+  Vector d(n);
+  for (Index i = 0; i < n; i++) d[i] = Sinv(i, i);
+  ARTS_USER_ERROR_IF(
+      relative_difference(covmat.inverse_diagonal(), d) > tolerance,
+      "{}: inverse_diagonal differs from the diagonal of inv(S)",
+      what)
+
+  ARTS_USER_ERROR_IF(
+      relative_difference(covmat.get_inverse(), Sinv) > tolerance,
+      "{}: get_inverse differs from inv(S)",
+      what)
+
+  Matrix B(n, n, 0.0);
+  add_inv(B, covmat);
+  ARTS_USER_ERROR_IF(relative_difference(B, Sinv) > tolerance,
+                     "{}: add_inv differs from inv(S)",
+                     what)
+}
+}  // namespace
+
+int main() try {
+  CovarianceMatrix covmat;
+
+  add_diagonal_block(covmat, 0, 0, diagonal(4));
+  check(covmat, "Diagonal");
+
+  add_diagonal_block(covmat, 1, 4, markov(6));
+  check(covmat, "Markov");
+
+  add_diagonal_block(covmat, 2, 10, dense(5));
+  check(covmat, "Dense");
+
+  add_diagonal_block(covmat, 3, 15, banded(7));
+  check(covmat, "Sparse");
+
+  // Two correlated blocks are factorized together
+  add_diagonal_block(covmat, 4, 22, dense(3));
+  add_diagonal_block(covmat, 5, 25, markov(4));
+  Matrix cross(3, 4);
+  for (Index i = 0; i < 3; i++) {
+    for (Index j = 0; j < 4; j++) cross(i, j) = 0.05 * (1 + i + j);
+  }
+  covmat.add_correlation(Block(Range(22, 3), Range(25, 4), {4, 5}, cross));
+  check(covmat, "Correlated");
+
+  // A diagonal block with a user-provided inverse
+  Matrix user(2, 2, 0.0), user_inv(2, 2, 0.0);
+  user(0, 0) = 2.0;
+  user(1, 1) = 4.0;
+  user_inv(0, 0) = 0.5;
+  user_inv(1, 1) = 0.25;
+  add_diagonal_block(covmat, 6, 29, user);
+  covmat.add_correlation_inverse(
+      Block(Range(29, 2), Range(29, 2), {6, 6}, user_inv));
+  check(covmat, "User inverse");
+
+  std::cout << "All covariance matrix tests passed\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
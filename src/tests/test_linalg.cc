@@ -11,10 +11,13 @@
 #include <stdlib.h>
 #include <time.h>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <random>
+#include <stdexcept>
 #include "array.h"
 #include "lin_alg.h"
+#include "matpack_constexpr_lin_alg.h"
 #include "matpack_math.h"
 #include "test_utils.h"
 
@@ -285,6 +288,54 @@ void test_solve_linear_system(Index ntests, Index dim, bool verbose) {
   }
 }
 
+//! Test the fixed-size solver against Lapack.
+/*!
+  Generates random, square (n,n)-matrices A and length-n vectors b for all
+  n up to max_n and solves A*x = b with both matpack::solve_inplace_fixed and
+  solve_inplace.  The maximum relative, component-wise difference is written
+  to standard out, and the test fails if it is not small.
+
+  \param[in] ntests Number of tests to be performed per size.
+  \return void
+*/
+void test_solve_fixed_size(Index ntests) {
+  constexpr Index max_n = 16;
+
+  // initialize random seed
+  srand((unsigned int)time(0));
+
+  cout << endl << endl << "Testing fixed-size linear system solution";
+  cout << ", ntests = " << ntests << endl;
+  cout << endl << setw(10) << "n" << setw(25) << "max rel. difference";
+  cout << endl << endl;
+
+  for (Index n = 1; n <= max_n + 1; n++) {
+    Matrix A(n, n), LU(n, n);
+    Vector b(n), x(n), x_ref(n);
+
+    Numeric err = 0.0;
+    for (Index i = 0; i < ntests; i++) {
+      random_fill_matrix_pos_def(A, 10, false);
+      random_fill_vector(b, 10, false);
+
+      x  = b;
+      LU = A;
+      const bool fixed = matpack::solve_inplace_fixed<max_n>(x, LU);
+      if (fixed != (n <= max_n)) throw std::runtime_error("Bad dispatch");
+      if (not fixed) continue;
+
+      x_ref = b;
+      LU    = A;
+      solve_inplace(x_ref, LU);
+
+      err = std::max(err, get_maximum_error(x, x_ref, true));
+    }
+
+    cout << setw(10) << n << setw(25) << err << endl;
+    if (err > 1e-8) throw std::runtime_error("Fixed-size solver differs");
+  }
+}
+
 //! Test matrix inversion.
 /*!
   Generates a random, square (n,n)-matrix A and computes its inverse Ainv and
@@ -511,12 +562,16 @@ void test_complex_diagonalize(Index ntests, Index dim) {
   }
 }
 
-int main() {
+int main() try {
   // test_lusolve4D();
   // test_inv( 20, 1000 );
   // test_solve_linear_system( 20, 1000, false );
   // test_matrix_exp1D();
   //  test_real_diagonalize(20,100);
   test_complex_diagonalize(20,100);
+  test_solve_fixed_size(20);
   return (0);
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
 }
@@ -1,12 +1,29 @@
 #include <artstime.h>
 #include <matpack.h>
+#include <matpack_arena.h>
 
+#include <atomic>
 #include <cstdlib>
+#include <format>
 #include <iostream>
+#include <new>
 #include <stdexcept>
 
 #include "test_perf.h"
 
+//! The number of calls to the global operator new, i.e., of heap allocations
+std::atomic<Size> heap_allocations{0};
+
+void* operator new(std::size_t n) {
+  heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(n == 0 ? 1 : n)) return ptr;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
 Array<Timing> test_sum(Index N) {
   Numeric X;
   Vector a(N, 1);
@@ -603,8 +620,63 @@ Array<Timing> test_ops_Matrix(Index N) {
   return out;
 }
 
+Array<Timing> test_scratch_alloc(Index N) {
+  Numeric X = 0;
+
+  Array<Numeric> results_;
+  Array<Timing> out;
+
+  const auto scratch = [&X](Index i) {
+    Vector a(3, static_cast<Numeric>(i));
+    Matrix b(4, 4, 1.0);
+    ComplexVector c(1);
+    c[0] = a[2] + b(3, 3);
+    X   += c[0].real();
+  };
+
+  // The columns after the time are the number of allocations and the number
+  // of these that went to the system heap
+  Size nheap = 0;
+  out.emplace_back("Vector+Matrix+ComplexVector-heap")([&]() {
+    const Size n0 = heap_allocations.load();
+    for (Index i = 0; i < N; i++) scratch(i);
+    nheap = heap_allocations.load() - n0;
+  });
+  out.back().counts = {nheap, nheap};
+  results_.push_back(X);
+
+  matpack::arena pool;
+  out.emplace_back("Vector+Matrix+ComplexVector-arena")([&]() {
+    const Size n0 = heap_allocations.load();
+    for (Index i = 0; i < N; i++) {
+      matpack::scratch_data<Numeric, 1> a(pool, {3}, static_cast<Numeric>(i));
+      matpack::scratch_data<Numeric, 2> b(pool, {4, 4}, 1.0);
+      matpack::scratch_data<Complex, 1> c(pool, {1});
+      c.view()[0] = a.view()[2] + b.view()(3, 3);
+      X          += c.view()[0].real();
+    }
+    nheap = heap_allocations.load() - n0;
+  });
+  results_.push_back(X);
+
+  const auto& stats = pool.stats();
+  if (stats.nalloc != static_cast<Size>(3 * N) or stats.nblock != 1 or
+      pool.nlive() != 0)
+    throw std::runtime_error(std::format(
+        "Arena served {} allocations from {} blocks with {} live, expected {} from 1 with 0 live",
+        stats.nalloc,
+        stats.nblock,
+        pool.nlive(),
+        3 * N));
+  out.back().counts = {stats.nalloc, nheap};
+
+  out.emplace_back("dummy")([results_]() { return results_[results_.size() - 1]; });
+
+  return out;
+}
+
 int main(int argc, char** c) {
-  std::array<Index, 8> N;
+  std::array<Index, 9> N;
   if (static_cast<std::size_t>(argc) < 1 + 1 + N.size()) {
     std::cerr << "Expects PROGNAME NREPEAT NSIZE..., wehere NSIZE is "
               << N.size() << " indices\n";
@@ -629,5 +701,6 @@ int main(int argc, char** c) {
               << test_elementary_ops_Matrix(N[5]) << '\n';
     std::cout << N[6] << " vector_ops_vector\n" << test_ops_Vector(N[6]) << '\n';
     std::cout << N[7] << " matrix_ops_matrix\n" << test_ops_Matrix(N[7]) << '\n';
+    std::cout << N[8] << " scratch_alloc\n" << test_scratch_alloc(N[8]) << '\n';
   }
 }
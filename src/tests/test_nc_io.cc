@@ -0,0 +1,194 @@
+#include <netcdf.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+#include "debug.h"
+#include "gas_abs_lookup.h"
+#include "nc_io.h"
+
+namespace {
+String temp_file(const String& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+//! A value that is unique for every element
+template <typename T>
+void fill(T& x) {
+  Numeric v = 0.0;
+  for (auto& e : x.flat_view()) e = v++;
+}
+
+//! Write x, read the slab [start, start + count) back and compare
+template <typename T, typename Slab>
+void test_slab(const T& x,
+               const ArrayOfIndex& start,
+               const ArrayOfIndex& count,
+               Slab&& slab,
+               const String& name) {
+  const String file = temp_file("arts_test_nc_io_" + name + ".nc");
+  nca_write_to_file(file, x);
+
+  T y;
+  nca_read_from_file(file, y);
+  ARTS_USER_ERROR_IF(y.shape() != x.shape() or
+                         not std::ranges::equal(y.flat_view(), x.flat_view()),
+                     "{}: Reading the whole file changes the data",
+                     name)
+
+  T z;
+  nca_read_slab_from_file(file, z, start, count);
+  const T ref{slab(x)};
+  ARTS_USER_ERROR_IF(z.shape() != ref.shape() or
+                         not std::ranges::equal(z.flat_view(), ref.flat_view()),
+                     "{}: The slab differs from the data",
+                     name)
+
+  std::filesystem::remove(file);
+}
+
+void test_slabs() {
+  Vector v(11);
+  fill(v);
+  test_slab(
+      v, {3}, {-1}, [](const Vector& x) { return x[Range(3, 8)]; }, "Vector");
+
+  Matrix m(7, 5);
+  fill(m);
+  test_slab(
+      m,
+      {2, 1},
+      {3, -1},
+      [](const Matrix& x) { return x(Range(2, 3), Range(1, 4)); },
+      "Matrix");
+
+  Tensor3 t3(4, 5, 6);
+  fill(t3);
+  test_slab(
+      t3,
+      {1, 0, 2},
+      {2, -1, 3},
+      [](const Tensor3& x) { return x(Range(1, 2), joker, Range(2, 3)); },
+      "Tensor3");
+
+  Tensor4 t4(3, 4, 5, 6);
+  fill(t4);
+  test_slab(
+      t4,
+      {0, 1, 2, 3},
+      {-1, 2, 1, 3},
+      [](const Tensor4& x) {
+        return x(joker, Range(1, 2), Range(2, 1), Range(3, 3));
+      },
+      "Tensor4");
+
+  Tensor5 t5(2, 3, 4, 5, 6);
+  fill(t5);
+  test_slab(
+      t5,
+      {1, 0, 1, 2, 0},
+      {1, -1, 2, 3, 4},
+      [](const Tensor5& x) {
+        return x(Range(1, 1), joker, Range(1, 2), Range(2, 3), Range(0, 4));
+      },
+      "Tensor5");
+
+  // Out of range slabs are errors
+  const String file = temp_file("arts_test_nc_io_range.nc");
+  nca_write_to_file(file, v);
+  bool failed = false;
+  try {
+    Vector w;
+    nca_read_slab_from_file(file, w, {5}, {7});
+  } catch (std::exception&) {
+    failed = true;
+  }
+  ARTS_USER_ERROR_IF(not failed, "An out of range slab was accepted")
+  std::filesystem::remove(file);
+}
+
+//! The storage of variable name in file
+int storage(const String& file, const String& name) {
+  int ncid, varid, out;
+  ARTS_USER_ERROR_IF(nc_open(file.c_str(), NC_NOWRITE, &ncid),
+                     "Cannot open {}",
+                     file)
+  const bool bad = nc_inq_varid(ncid, name.c_str(), &varid) or
+                   nc_inq_var_chunking(ncid, varid, &out, nullptr);
+  nc_close(ncid);
+  ARTS_USER_ERROR_IF(bad, "Cannot find {} in {}", name, file)
+  return out;
+}
+
+//! Only large variables are chunked
+void test_chunking() {
+  const String file = temp_file("arts_test_nc_io_chunking.nc");
+
+  nca_write_to_file(file, Vector(10, 1.0));
+  ARTS_USER_ERROR_IF(storage(file, "Vector") != NC_CONTIGUOUS,
+                     "A small vector is chunked")
+
+  nca_write_to_file(file, Tensor3(40, 40, 40, 1.0));
+  ARTS_USER_ERROR_IF(storage(file, "Tensor3") != NC_CHUNKED,
+                     "A large tensor is not chunked")
+
+  std::filesystem::remove(file);
+}
+
+//! A frequency window of a lookup table equals the slice of the table
+void test_lookup_window() {
+  GasAbsLookup gal;
+  gal.Species() = {ArrayOfSpeciesTag("O2-66"), ArrayOfSpeciesTag("H2O-161")};
+  gal.Fgrid()   = Vector{1e9, 2e9, 3e9, 4e9, 5e9, 6e9};
+  gal.Pgrid()   = Vector{1e5, 1e4, 1e3};
+  gal.VMRs()    = Matrix(2, 3, 1e-3);
+  gal.Tref()    = Vector{290, 250, 220};
+  gal.Tpert()   = Vector{-10, 10};
+  gal.Xsec().resize(2, 2, 6, 3);
+  fill(gal.Xsec());
+
+  const String file = temp_file("arts_test_nc_io_lookup.nc");
+  nca_write_to_file(file, gal);
+
+  GasAbsLookup window;
+  nca_read_from_file(file, window, 2.5e9, 5e9);
+
+  const Vector f_ref{3e9, 4e9, 5e9};
+  ARTS_USER_ERROR_IF(not std::ranges::equal(window.Fgrid(), f_ref),
+                     "Wrong frequency window: {:B,}",
+                     window.Fgrid())
+
+  const Tensor4 ref{gal.Xsec()(joker, joker, Range(2, 3), joker)};
+  ARTS_USER_ERROR_IF(
+      window.Xsec().shape() != ref.shape() or
+          not std::ranges::equal(window.Xsec().flat_view(), ref.flat_view()),
+      "The cross-sections of the window differ from the table")
+
+  ARTS_USER_ERROR_IF(not std::ranges::equal(window.Pgrid(), gal.Pgrid()) or
+                         not std::ranges::equal(window.Tpert(), gal.Tpert()) or
+                         window.Species().size() != gal.Species().size(),
+                     "The window changes the other data of the table")
+
+  // An empty window gives an empty table
+  GasAbsLookup empty;
+  nca_read_from_file(file, empty, 10e9, 20e9);
+  ARTS_USER_ERROR_IF(
+      empty.Fgrid().size() != 0 or empty.Xsec().size() != 0,
+      "A window outside the table is not empty")
+
+  std::filesystem::remove(file);
+}
+}  // namespace
+
+int main() try {
+  test_slabs();
+  test_chunking();
+  test_lookup_window();
+  std::cout << "All NetCDF tests passed\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numbers>
+#include <vector>
+
+#include "debug.h"
+#include "obsel.h"
+
+namespace {
+constexpr Numeric f_low  = 100e9;
+constexpr Numeric f_high = 101e9;
+
+AscendingGrid uniform_grid(Index n) {
+  Vector x(n);
+  for (Index i = 0; i < n; i++) {
+    x[i] = f_low + (f_high - f_low) * static_cast<Numeric>(i) /
+                       static_cast<Numeric>(n - 1);
+  }
+  return AscendingGrid(std::move(x));
+}
+
+//! Every point of x, with the intervals in [f0, f1] split into m parts
+AscendingGrid refined_grid(const AscendingGrid& x,
+                           Numeric f0,
+                           Numeric f1,
+                           Index m) {
+  std::vector<Numeric> out;
+  for (Index i = 0; i < x.size() - 1; i++) {
+    out.push_back(x[i]);
+    if (x[i] < f0 or x[i + 1] > f1) continue;
+    for (Index k = 1; k < m; k++) {
+      out.push_back(x[i] + (x[i + 1] - x[i]) * static_cast<Numeric>(k) /
+                               static_cast<Numeric>(m));
+    }
+  }
+  out.push_back(x[x.size() - 1]);
+
+  Vector y(static_cast<Index>(out.size()));
+  std::ranges::copy(out, y.begin());
+  return AscendingGrid(std::move(y));
+}
+
+Stokvec spectrum(Numeric f) {
+  const Numeric x = 2 * std::numbers::pi * (f - f_low) / 0.7e9;
+  return {1.0 + 0.5 * std::sin(x), 0.1 * std::cos(x), 0.0, 0.0};
+}
+
+StokvecVector spectrum(const AscendingGrid& fs) {
+  StokvecVector out(fs.size());
+  for (Index i = 0; i < fs.size(); i++) out[i] = spectrum(fs[i]);
+  return out;
+}
+
+//! A gaussian channel, with weights that are the response times the widths
+sensor::Obsel gaussian_obsel(const AscendingGrid& fo) {
+  constexpr Numeric f0    = 100.5e9;
+  constexpr Numeric sigma = 0.1e9;
+
+  StokvecMatrix w(1, fo.size());
+  for (Index i = 0; i < fo.size(); i++) {
+    const Numeric lo = fo[i == 0 ? i : i - 1];
+    const Numeric hi = fo[i == fo.size() - 1 ? i : i + 1];
+    const Numeric g  = std::exp(-0.5 * std::pow((fo[i] - f0) / sigma, 2));
+    w(0, i)          = (g * 0.5 * (hi - lo)) * Stokvec{1.0, 0.3, 0.0, 0.0};
+  }
+
+  sensor::Obsel obsel(fo, sensor::PosLosVector(1), w);
+  obsel.normalize();
+  return obsel;
+}
+
+Stokvec sum(const StokvecVector& w) {
+  Stokvec out{0.0, 0.0, 0.0, 0.0};
+  for (auto& x : w) out += x;
+  return out;
+}
+
+bool same(const Stokvec& x, const Stokvec& y) {
+  for (Index k = 0; k < 4; k++) {
+    if (x[k] != y[k]) return false;
+  }
+  return true;
+}
+
+bool close(Numeric x, Numeric y, Numeric rtol) {
+  return std::abs(x - y) <= rtol * std::max(std::abs(x), std::abs(y));
+}
+
+void test_same_grid() {
+  const AscendingGrid fo   = uniform_grid(401);
+  const sensor::Obsel obsel = gaussian_obsel(fo);
+
+  const StokvecVector w = obsel.weights_on(fo, 0);
+  for (Index k = 0; k < fo.size(); k++) {
+    ARTS_USER_ERROR_IF(not same(w[k], obsel.weight_matrix()(0, k)),
+                       "The weights change on the native grid")
+  }
+
+  const StokvecVector i = spectrum(fo);
+  ARTS_USER_ERROR_IF(obsel.sumup(i, fo, 0) != obsel.sumup(i, 0),
+                     "sumup changes on the native grid")
+}
+
+void test_refined_grid() {
+  const AscendingGrid fo   = uniform_grid(401);
+  const AscendingGrid fs   = refined_grid(fo, 100.3e9, 100.7e9, 7);
+  const sensor::Obsel obsel = gaussian_obsel(fo);
+
+  // The response is linear between the native points, so the trapezoidal
+  // sum of the weights is the same on any grid that contains them
+  const Stokvec wo = sum(StokvecVector{obsel.weight_matrix()[0]});
+  const Stokvec ws = sum(obsel.weights_on(fs, 0));
+  for (Index k = 0; k < 4; k++) {
+    ARTS_USER_ERROR_IF(wo[k] != ws[k] and not close(wo[k], ws[k], 1e-12),
+                       "Summed weights changed from {} to {}",
+                       wo,
+                       ws)
+  }
+
+  const Numeric io = obsel.sumup(spectrum(fo), 0);
+  const Numeric is = obsel.sumup(spectrum(fs), fs, 0);
+  ARTS_USER_ERROR_IF(not close(io, is, 1e-3),
+                     "Native sum {} and refined sum {} differ",
+                     io,
+                     is)
+
+  StokvecMatrix j(2, fs.size());
+  for (Index k = 0; k < fs.size(); k++) {
+    j(0, k) = spectrum(fs[k]);
+    j(1, k) = 2.0 * spectrum(fs[k]);
+  }
+
+  Vector out(2, 0.0);
+  obsel.sumup(out, j, fs, 0);
+  ARTS_USER_ERROR_IF(
+      not close(out[0], is, 1e-12) or not close(out[1], 2.0 * is, 1e-12),
+      "Jacobian sums {:B,} differ from the spectrum sum {}",
+      out,
+      is)
+}
+
+void test_outside_grid() {
+  const AscendingGrid fo   = uniform_grid(401);
+  const sensor::Obsel obsel = gaussian_obsel(fo);
+
+  const AscendingGrid fs{99.5e9, 99.9e9, 100.5e9, 101.1e9, 102e9};
+  const StokvecVector w = obsel.weights_on(fs, 0);
+  for (Index i : {0, 1, 3, 4}) {
+    ARTS_USER_ERROR_IF(not same(w[i], Stokvec{0.0, 0.0, 0.0, 0.0}),
+                       "Weight {} at {} Hz outside of the obsel",
+                       w[i],
+                       fs[i])
+  }
+}
+
+void test_single_frequency() {
+  StokvecMatrix w(1, 1);
+  w(0, 0) = Stokvec{1.0, 0.0, 0.0, 0.0};
+  const sensor::Obsel obsel(
+      AscendingGrid{100.45e9}, sensor::PosLosVector(1), w);
+
+  // A linear spectrum is sampled exactly
+  const AscendingGrid fs{100e9, 100.2e9, 100.7e9, 101e9};
+  StokvecVector i(fs.size());
+  for (Index k = 0; k < fs.size(); k++) {
+    i[k] = Stokvec{1.0 + (fs[k] - f_low) / 1e9, 0.0, 0.0, 0.0};
+  }
+
+  const Numeric x = obsel.sumup(i, fs, 0);
+  ARTS_USER_ERROR_IF(not close(x, 1.45, 1e-12),
+                     "Single frequency obsel samples {} instead of 1.45",
+                     x)
+}
+}  // namespace
+
+int main() try {
+  test_same_grid();
+  test_refined_grid();
+  test_outside_grid();
+  test_single_frequency();
+  std::cout << "All obsel tests passed\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
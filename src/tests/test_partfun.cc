@@ -1,5 +1,6 @@
 #include "isotopologues.h"
 #include "partfun.h"
+#include <cmath>
 #include <iostream>
 
 //! Don't call this manually, it only exists to catch a developer error
@@ -15,11 +16,73 @@ constexpr std::size_t nonexistentPartfun() noexcept {
   return Species::Isotopologues.size();
 }
 
+/*! The tabulated partition functions must agree with the direct evaluation
+
+The lines of StaticInterp data are the same as the data, and the Hermite
+polynomials of Coeff data are the same polynomials, so only rounding errors
+are allowed.
+*/
+void test_table() {
+  using namespace PartitionFunctions;
+
+  const Numeric T1 = table_T0 + table_dT * static_cast<Numeric>(table_n);
+  for (auto& ir : Species::Isotopologues) {
+    if (ir.joker() or not has_partfun(ir)) continue;
+
+    for (Numeric T = table_T0; T < T1; T += 0.37) {
+      const Numeric Q0 = detail::partfun_impl<Derivatives::No>(T, ir);
+      const Numeric Q1 = Q(T, ir);
+      ARTS_USER_ERROR_IF(std::abs(Q1 - Q0) > 1e-10 * std::abs(Q0),
+                         "Bad tabulated Q of {} at {} K: {} vs {}",
+                         ir.FullName(),
+                         T,
+                         Q1,
+                         Q0)
+
+      const Numeric dQ0 = detail::partfun_impl<Derivatives::Yes>(T, ir);
+      const Numeric dQ1 = dQdT(T, ir);
+      ARTS_USER_ERROR_IF(std::abs(dQ1 - dQ0) >
+                             1e-10 * (std::abs(dQ0) + std::abs(Q0) / table_dT),
+                         "Bad tabulated dQdT of {} at {} K: {} vs {}",
+                         ir.FullName(),
+                         T,
+                         dQ1,
+                         dQ0)
+    }
+  }
+}
+
+//! The path overloads must agree with the point-wise evaluation
+void test_path() {
+  using namespace PartitionFunctions;
+
+  //! The last temperature is the end of the table, which is evaluated directly
+  const Numeric T1 = table_T0 + table_dT * static_cast<Numeric>(table_n);
+  const Vector T{150.3, 180.0, 211.7, 250.25, 288.9, 996.4, T1};
+  Vector q(T.size()), dq(T.size());
+
+  for (auto& ir : Species::Isotopologues) {
+    if (ir.joker() or not has_partfun(ir)) continue;
+
+    Q(q, T, ir);
+    dQdT(dq, T, ir);
+    for (Index i = 0; i < T.size(); i++) {
+      ARTS_USER_ERROR_IF(q[i] != Q(T[i], ir) or dq[i] != dQdT(T[i], ir),
+                         "Bad path partition function of {} at {} K",
+                         ir.FullName(),
+                         T[i])
+    }
+  }
+}
+
 int main() try {
   const auto i = nonexistentPartfun();
   ARTS_USER_ERROR_IF(i not_eq Species::Isotopologues.size(),
     "A species without partition functions have been found.  It is the species: {}",
     Species::Isotopologues[i].FullName())
+
+  test_table();
+  test_path();
   return EXIT_SUCCESS;
 } catch (std::runtime_error&e) {
   std::cerr << e.what() << '\n';
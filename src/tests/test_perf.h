@@ -5,6 +5,7 @@
 #include <chrono>
 #include <iomanip>
 #include <string_view>
+#include <vector>
 
 #include "debug.h"
 
@@ -12,6 +13,10 @@ struct Timing {
   std::string_view name;
   Timing(const char* c) : name(c) {}
   TimeStep dt{};
+
+  //! Extra columns printed after the time, e.g., allocation counts
+  std::vector<Size> counts{};
+
   template <typename Function>
   void operator()(Function&& f) {
     Time start{};
@@ -26,7 +31,9 @@ inline std::ostream& operator<<(std::ostream& os, const Array<Timing>& vt) {
     if (t.name.contains('\n') or t.name.contains(' ') or t.name.empty())
       throw std::runtime_error(var_string("bad name: \"", t.name, '"'));
     if (t.name not_eq "dummy") {
-      os << std::setprecision(15) << t.name << " " << t.dt.count() << '\n';
+      os << std::setprecision(15) << t.name << " " << t.dt.count();
+      for (auto n : t.counts) os << " " << n;
+      os << '\n';
     }
   }
   return os;
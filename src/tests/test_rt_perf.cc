@@ -0,0 +1,688 @@
+#include <atm.h>
+#include <disort.h>
+#include <fwd.h>
+#include <jacobian.h>
+#include <lbl.h>
+#include <rtepack.h>
+#include <surf.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <tuple>
+
+#include "fwd_spectral_radiance.h"
+#include "igrf13.h"
+#include "matpack_math.h"
+#include "test_perf.h"
+#include "wigner_functions.h"
+
+//! Synthetic O2-66 band of evenly spaced lines between 1 and 300 GHz
+AbsorptionBand synthetic_band(Index nlines, LineByLineCutoffType cutoff) {
+  AbsorptionBand band;
+  band.key               = QuantumIdentifier{"O2-66"};
+  band.data.lineshape    = LineByLineLineshape::VP_LTE;
+  band.data.cutoff       = cutoff;
+  band.data.cutoff_value = 750e9;
+
+  for (Index i = 0; i < nlines; i++) {
+    auto& line = band.data.lines.emplace_back();
+    line.f0    = 1e9 + 299e9 * static_cast<Numeric>(i) /
+                        static_cast<Numeric>(nlines);
+    line.a     = 1e-5;
+    line.e0    = 1e-21;
+    line.gu    = 3;
+    line.gl    = 3;
+    line.ls.T0 = 296;
+
+    auto& spec   = line.ls.single_models.emplace_back();
+    spec.species = SpeciesEnum::Bath;
+    spec.data.emplace_back(
+        LineShapeModelVariable::G0,
+        lbl::temperature::data{LineShapeModelType::T1, Vector{2e4, 0.8}});
+  }
+
+  return band;
+}
+
+AtmPoint synthetic_atm_point() {
+  AtmPoint atm;
+  atm.pressure             = 1e4;
+  atm.temperature          = 250;
+  atm.mag                  = {0, 0, 0};
+  atm.wind                 = {0, 0, 0};
+  atm[SpeciesEnum::Oxygen] = 0.21;
+  return atm;
+}
+
+//! Synthetic 3D atmosphere, up to 100 km
+AtmField synthetic_atm_field(Index nalt, Index nlat, Index nlon) {
+  const Vector alt =
+      uniform_grid(0, nalt, 100e3 / static_cast<Numeric>(nalt - 1));
+  const Vector lat =
+      uniform_grid(-90, nlat, 180.0 / static_cast<Numeric>(nlat - 1));
+  const Vector lon =
+      uniform_grid(-180, nlon, 360.0 / static_cast<Numeric>(nlon - 1));
+
+  GriddedField3 t{.data_name  = "t",
+                  .data       = Tensor3(nalt, nlat, nlon),
+                  .grid_names = {"Altitude", "Latitude", "Longitude"},
+                  .grids      = {alt, lat, lon}};
+  GriddedField3 p = t;
+  p.data_name     = "p";
+  for (Index i = 0; i < nalt; i++) {
+    t.data[i] = 290.0 - 0.6e-3 * alt[i];
+    p.data[i] = 1e5 * std::exp(-alt[i] / 8e3);
+  }
+
+  AtmField atm;
+  atm.top_of_atmosphere    = alt.back();
+  atm[AtmKey::t]           = t;
+  atm[AtmKey::p]           = p;
+  atm[AtmKey::mag_u]       = 30e-6;
+  atm[AtmKey::mag_v]       = 0.0;
+  atm[AtmKey::mag_w]       = 0.0;
+  atm[AtmKey::wind_u]      = 0.0;
+  atm[AtmKey::wind_v]      = 0.0;
+  atm[AtmKey::wind_w]      = 0.0;
+  atm[SpeciesEnum::Oxygen] = 0.21;
+  return atm;
+}
+
+Array<Timing> test_lbl_calculate(Index nf) {
+  const Vector f_grid =
+      uniform_grid(1e9, nf, 299e9 / static_cast<Numeric>(nf - 1));
+  const AtmPoint atm = synthetic_atm_point();
+  const Jacobian::Targets jacobian_targets{};
+  const LinemixingEcsData ecs_data{};
+
+  PropmatVector pm(nf);
+  StokvecVector sv(nf);
+  PropmatMatrix dpm(0, nf);
+  StokvecMatrix dsv(0, nf);
+
+  const auto calc = [&](const ArrayOfAbsorptionBand& bands) {
+    pm = 0.0;
+    sv = 0.0;
+    lbl::calculate(pm,
+                   sv,
+                   dpm,
+                   dsv,
+                   f_grid,
+                   jacobian_targets,
+                   SpeciesEnum::Bath,
+                   bands,
+                   lbl::band_index{bands},
+                   {},
+                   ecs_data,
+                   {},
+                   atm,
+                   {0, 0},
+                   false);
+  };
+
+  Array<Timing> out;
+  for (auto cutoff :
+       {LineByLineCutoffType::None, LineByLineCutoffType::ByLine}) {
+    const ArrayOfAbsorptionBand b10{synthetic_band(10, cutoff)};
+    const ArrayOfAbsorptionBand b100{synthetic_band(100, cutoff)};
+    const ArrayOfAbsorptionBand b1000{synthetic_band(1000, cutoff)};
+
+    const bool c = cutoff == LineByLineCutoffType::ByLine;
+    out.emplace_back(c ? "lbl-10-lines-cutoff" : "lbl-10-lines")(
+        [&]() { calc(b10); });
+    out.emplace_back(c ? "lbl-100-lines-cutoff" : "lbl-100-lines")(
+        [&]() { calc(b100); });
+    out.emplace_back(c ? "lbl-1000-lines-cutoff" : "lbl-1000-lines")(
+        [&]() { calc(b1000); });
+  }
+  return out;
+}
+
+//! Many narrow bands of which only a few overlap a narrow frequency grid
+Array<Timing> test_lbl_band_index(Index nf) {
+  constexpr Index nbands = 100;
+
+  const Vector f_grid =
+      uniform_grid(55e9, nf, 5e9 / static_cast<Numeric>(nf - 1));
+  const AtmPoint atm = synthetic_atm_point();
+  const Jacobian::Targets jacobian_targets{};
+  const LinemixingEcsData ecs_data{};
+
+  ArrayOfAbsorptionBand bands;
+  for (Index i = 0; i < nbands; i++) {
+    auto& band =
+        bands.emplace_back(synthetic_band(10, LineByLineCutoffType::ByLine));
+    band.data.cutoff_value = 1e9;
+    const Numeric f_offset = 3e9 * static_cast<Numeric>(i);
+    for (auto& line : band.data.lines) line.f0 = f_offset + line.f0 / 100.0;
+  }
+
+  PropmatVector pm(nf);
+  StokvecVector sv(nf);
+  PropmatMatrix dpm(0, nf);
+  StokvecMatrix dsv(0, nf);
+
+  Array<Timing> out;
+  out.emplace_back("lbl-100-bands-new-index")([&]() {
+    pm = 0.0;
+    sv = 0.0;
+    lbl::calculate(pm,
+                   sv,
+                   dpm,
+                   dsv,
+                   f_grid,
+                   jacobian_targets,
+                   SpeciesEnum::Bath,
+                   bands,
+                   lbl::band_index{bands},
+                   {},
+                   ecs_data,
+                   {},
+                   atm,
+                   {0, 0},
+                   false);
+  });
+
+  const lbl::band_index index{bands};
+  out.emplace_back("lbl-100-bands-prebuilt-index")([&]() {
+    pm = 0.0;
+    sv = 0.0;
+    lbl::calculate(pm,
+                   sv,
+                   dpm,
+                   dsv,
+                   f_grid,
+                   jacobian_targets,
+                   SpeciesEnum::Bath,
+                   bands,
+                   index,
+                   {},
+                   ecs_data,
+                   {},
+                   atm,
+                   {0, 0},
+                   false);
+  });
+  return out;
+}
+
+//! Same band with and without derivatives to show the cost of the Jacobian
+Array<Timing> test_lbl_jacobian(Index nf) {
+  const Vector f_grid =
+      uniform_grid(1e9, nf, 299e9 / static_cast<Numeric>(nf - 1));
+  const AtmPoint atm = synthetic_atm_point();
+  const LinemixingEcsData ecs_data{};
+  const ArrayOfAbsorptionBand bands{
+      synthetic_band(100, LineByLineCutoffType::None)};
+
+  Jacobian::Targets jacobian_targets;
+  for (auto key : {AtmKeyVal{AtmKey::t},
+                   AtmKeyVal{AtmKey::wind_u},
+                   AtmKeyVal{SpeciesEnum::Oxygen}}) {
+    jacobian_targets.target<Jacobian::AtmTarget>().emplace_back(
+        key, 0.1, jacobian_targets.target_count());
+  }
+  for (Size i = 0; i < 3; i++) {
+    lbl::line_key key{.band = bands.front().key, .line = i};
+    if (i == 0) key.var = LineByLineVariable::f0;
+    if (i == 1) key.var = LineByLineVariable::a;
+    if (i == 2) {
+      key.spec     = 0;
+      key.ls_var   = LineShapeModelVariable::G0;
+      key.ls_coeff = LineShapeModelCoefficient::X0;
+    }
+    jacobian_targets.target<Jacobian::LineTarget>().emplace_back(
+        key, 0.1, jacobian_targets.target_count());
+  }
+
+  const Jacobian::Targets no_targets{};
+  const lbl::band_index index{bands};
+
+  PropmatVector pm(nf);
+  StokvecVector sv(nf);
+  PropmatMatrix dpm_off(0, nf);
+  StokvecMatrix dsv_off(0, nf);
+  PropmatMatrix dpm(jacobian_targets.target_count(), nf);
+  StokvecMatrix dsv(jacobian_targets.target_count(), nf);
+
+  const auto calc = [&](const Jacobian::Targets& targets,
+                        PropmatMatrix& dpm_,
+                        StokvecMatrix& dsv_) {
+    pm   = 0.0;
+    sv   = 0.0;
+    dpm_ = 0.0;
+    dsv_ = 0.0;
+    lbl::calculate(pm,
+                   sv,
+                   dpm_,
+                   dsv_,
+                   f_grid,
+                   targets,
+                   SpeciesEnum::Bath,
+                   bands,
+                   index,
+                   {},
+                   ecs_data,
+                   {},
+                   atm,
+                   {0, 0},
+                   false);
+  };
+
+  Array<Timing> out;
+  out.emplace_back("lbl-jacobian-off")(
+      [&]() { calc(no_targets, dpm_off, dsv_off); });
+  out.emplace_back("lbl-jacobian-6-targets")(
+      [&]() { calc(jacobian_targets, dpm, dsv); });
+  return out;
+}
+
+//! Zeeman component strengths of all lines up to J = 30, as set up for every line at every path point
+Array<Timing> test_zeeman_strengths(Index n) {
+  const lbl::zeeman::model z{lbl::zeeman::data{.gu = 2.0, .gl = 2.0}};
+
+  const auto calc = [&]() {
+    Numeric sum = 0;
+    for (Index i = 0; i < n; i++) {
+      for (Rational Ju = 1; Ju <= 30; Ju += 1) {
+        const Rational Jl = Ju - 1;
+        for (auto pol : {lbl::zeeman::pol::sm,
+                         lbl::zeeman::pol::pi,
+                         lbl::zeeman::pol::sp}) {
+          const Index nz = lbl::zeeman::size(Ju, Jl, pol);
+          for (Index k = 0; k < nz; k++) sum += z.Strength(Ju, Jl, pol, k);
+        }
+      }
+    }
+    return sum;
+  };
+
+  Array<Timing> out;
+  out.emplace_back("zeeman-strengths-J30")([&]() {
+    [[maybe_unused]] volatile Numeric x = calc();
+  });
+  return out;
+}
+
+//! The band with Zeeman split lines of J up to 30, for all three polarizations
+Array<Timing> test_lbl_zeeman(Index nf) {
+  const Vector f_grid =
+      uniform_grid(1e9, nf, 299e9 / static_cast<Numeric>(nf - 1));
+  const Jacobian::Targets jacobian_targets{};
+  const LinemixingEcsData ecs_data{};
+
+  AtmPoint atm = synthetic_atm_point();
+  atm.mag      = {30e-6, 20e-6, 10e-6};
+
+  ArrayOfAbsorptionBand bands{
+      synthetic_band(100, LineByLineCutoffType::ByLine)};
+  for (Size i = 0; i < bands.front().data.lines.size(); i++) {
+    auto& line    = bands.front().data.lines[i];
+    const Index J = 1 + static_cast<Index>(i % 30);
+    line.qn.val =
+        Quantum::Number::ValueList{var_string("J ", J, ' ', J - 1)};
+    line.z = lbl::zeeman::model{lbl::zeeman::data{.gu = 2.0, .gl = 2.0}};
+  }
+  const lbl::band_index index{bands};
+
+  PropmatVector pm(nf);
+  StokvecVector sv(nf);
+  PropmatMatrix dpm(0, nf);
+  StokvecMatrix dsv(0, nf);
+
+  Array<Timing> out;
+  out.emplace_back("lbl-100-zeeman-lines")([&]() {
+    pm = 0.0;
+    sv = 0.0;
+    lbl::calculate(pm,
+                   sv,
+                   dpm,
+                   dsv,
+                   f_grid,
+                   jacobian_targets,
+                   SpeciesEnum::Bath,
+                   bands,
+                   index,
+                   {},
+                   ecs_data,
+                   {},
+                   atm,
+                   {0, 0},
+                   false);
+  });
+  return out;
+}
+
+Array<Timing> test_lbl_adaptive_grid(Index nf) {
+  const Vector f_grid =
+      uniform_grid(1e9, nf, 299e9 / static_cast<Numeric>(nf - 1));
+  const Index nc = std::max<Index>(2, nf / 100);
+  const AscendingGrid f_coarse{
+      uniform_grid(1e9, nc, 299e9 / static_cast<Numeric>(nc - 1))};
+  const Jacobian::Targets jacobian_targets{};
+  const LinemixingEcsData ecs_data{};
+
+  //! Narrow lines, as in the mesosphere
+  AtmPoint atm = synthetic_atm_point();
+  atm.pressure = 1.0;
+
+  const ArrayOfAbsorptionBand bands{
+      synthetic_band(100, LineByLineCutoffType::None)};
+  const lbl::band_index index{bands};
+
+  PropmatVector pm(nf);
+  StokvecVector sv(nf);
+  PropmatMatrix dpm(0, nf);
+  StokvecMatrix dsv(0, nf);
+
+  Array<Timing> out;
+  out.emplace_back("lbl-uniform-grid")([&]() {
+    pm = 0.0;
+    sv = 0.0;
+    lbl::calculate(pm,
+                   sv,
+                   dpm,
+                   dsv,
+                   f_grid,
+                   jacobian_targets,
+                   SpeciesEnum::Bath,
+                   bands,
+                   index,
+                   {},
+                   ecs_data,
+                   {},
+                   atm,
+                   {0, 0},
+                   false);
+  });
+  out.emplace_back("lbl-adaptive-grid")([&]() {
+    std::ignore = lbl::adaptive_calculate(
+        f_coarse, SpeciesEnum::Bath, bands, ecs_data, {}, atm, {0, 0});
+  });
+  return out;
+}
+
+Array<Timing> test_lbl_prune(Index nf) {
+  const Vector f_grid =
+      uniform_grid(1e9, nf, 299e9 / static_cast<Numeric>(nf - 1));
+  const Jacobian::Targets jacobian_targets{};
+  const LinemixingEcsData ecs_data{};
+
+  AtmPoint atm = synthetic_atm_point();
+  atm.pressure = 1.0;
+
+  const ArrayOfAbsorptionBand bands{
+      synthetic_band(1000, LineByLineCutoffType::None)};
+
+  PropmatVector pm(nf);
+  StokvecVector sv(nf);
+  PropmatMatrix dpm(0, nf);
+  StokvecMatrix dsv(0, nf);
+
+  const lbl::band_index index{bands};
+
+  const auto calc = [&](const std::span<const lbl::band_selection>& selection) {
+    pm = 0.0;
+    sv = 0.0;
+    lbl::calculate(pm,
+                   sv,
+                   dpm,
+                   dsv,
+                   f_grid,
+                   jacobian_targets,
+                   SpeciesEnum::Bath,
+                   bands,
+                   index,
+                   selection,
+                   ecs_data,
+                   {},
+                   atm,
+                   {0, 0},
+                   false);
+  };
+
+  Array<Timing> out;
+  out.emplace_back("lbl-1000-lines")([&]() { calc({}); });
+  out.emplace_back("lbl-1000-lines-pruned")([&]() {
+    std::vector<lbl::band_selection> selection;
+    lbl::prune(selection,
+               bands,
+               SpeciesEnum::Bath,
+               atm,
+               f_grid.front(),
+               f_grid.back(),
+               1e-3);
+    calc(selection);
+  });
+  return out;
+}
+
+Array<Timing> test_two_level_exp(Index nf) {
+  const PropmatVector k1(nf,
+                         Propmat{1e-3, 1e-5, 1e-5, 1e-5, 1e-6, 1e-6, 1e-6});
+  const PropmatVector k2(nf,
+                         Propmat{2e-3, 2e-5, 2e-5, 2e-5, 2e-6, 2e-6, 2e-6});
+  const PropmatVector k1_unpol(nf, Propmat{1e-3});
+  const PropmatVector k2_unpol(nf, Propmat{2e-3});
+  MuelmatVector t(nf);
+
+  Array<Timing> out;
+  out.emplace_back("two-level-exp-polarized")(
+      [&]() { rtepack::two_level_exp(t, k1, k2, 1e3); });
+  out.emplace_back("two-level-exp-unpolarized")(
+      [&]() { rtepack::two_level_exp(t, k1_unpol, k2_unpol, 1e3); });
+  return out;
+}
+
+Array<Timing> test_atm_field_at(Index n) {
+  const AtmField atm = synthetic_atm_field(101, 19, 37);
+  const Vector alt = uniform_grid(0, n, 99e3 / static_cast<Numeric>(n - 1));
+
+  AtmPoint pnt;
+  Array<Timing> out;
+  out.emplace_back("atm-field-at")([&]() {
+    for (auto& a : alt) pnt = atm.at(a, 12.3, 45.6);
+  });
+  return out;
+}
+
+Array<Timing> test_atm_field_igrf(Index n) {
+  static constexpr Vector2 ell{6378137., 6356752.314245};
+
+  AtmField atm     = synthetic_atm_field(101, 19, 37);
+  const Vector alt = uniform_grid(0, n, 99e3 / static_cast<Numeric>(n - 1));
+  const Time time{};
+
+  AtmPoint pnt;
+  Array<Timing> out;
+
+  for (Index i = 0; i < 3; i++) {
+    atm[std::array{AtmKey::mag_u, AtmKey::mag_v, AtmKey::mag_w}[i]] =
+        Atm::FunctionalData{
+            [time, i](Numeric h, Numeric lat, Numeric lon) {
+              return IGRF::igrf({h, lat, lon}, ell, time)[i];
+            }};
+  }
+  out.emplace_back("atm-field-igrf-separate")([&]() {
+    for (auto& a : alt) pnt = atm.at(a, 12.3, 45.6);
+  });
+
+  const Atm::MultiFunctionalData mag{
+      [time](Numeric h, Numeric lat, Numeric lon) {
+        const Vector3 m = IGRF::igrf({h, lat, lon}, ell, time);
+        return Vector{m[0], m[1], m[2]};
+      },
+      3};
+  atm[AtmKey::mag_u] = mag.component(0);
+  atm[AtmKey::mag_v] = mag.component(1);
+  atm[AtmKey::mag_w] = mag.component(2);
+  out.emplace_back("atm-field-igrf-multi")([&]() {
+    for (auto& a : alt) pnt = atm.at(a, 12.3, 45.6);
+  });
+  return out;
+}
+
+Array<Timing> test_spectral_radiance(Index nf) {
+  const AtmField atm = synthetic_atm_field(101, 2, 2);
+  const Vector f_grid =
+      uniform_grid(1e9, nf, 299e9 / static_cast<Numeric>(nf - 1));
+
+  SurfaceField surf;
+  surf.ellipsoid      = {6371e3, 6371e3};
+  surf[SurfaceKey::t] = 280.0;
+  surf[SurfaceKey::h] = 0.0;
+
+  auto lines = std::make_shared<ArrayOfAbsorptionBand>(
+      ArrayOfAbsorptionBand{synthetic_band(100, LineByLineCutoffType::None)});
+
+  Array<Timing> out;
+
+  fwd::spectral_radiance op;
+  out.emplace_back("spectral-radiance-setup")([&]() {
+    op = fwd::spectral_radiance(uniform_grid(0, 101, 1e3),
+                                {0.0},
+                                {0.0},
+                                atm,
+                                surf,
+                                lines,
+                                nullptr,
+                                nullptr,
+                                nullptr);
+  });
+
+  const auto path = op.geometric_planar({0, 0, 0}, {180, 0});
+
+  Stokvec srad;
+  out.emplace_back("spectral-radiance-per-frequency")([&]() {
+    for (auto& f : f_grid) srad = op(f, path);
+  });
+  return out;
+}
+
+Array<Timing> test_update_bands(Index n) {
+  const AtmField atm = synthetic_atm_field(101, 2, 2);
+
+  SurfaceField surf;
+  surf.ellipsoid      = {6371e3, 6371e3};
+  surf[SurfaceKey::t] = 280.0;
+  surf[SurfaceKey::h] = 0.0;
+
+  auto lines = std::make_shared<ArrayOfAbsorptionBand>();
+  for (auto isot : {"O2-66", "O2-67", "O2-68"}) {
+    auto& band = lines->emplace_back(
+        synthetic_band(100, LineByLineCutoffType::None));
+    band.key = QuantumIdentifier{isot};
+  }
+
+  fwd::spectral_radiance op(uniform_grid(0, 101, 1e3),
+                            {0.0},
+                            {0.0},
+                            atm,
+                            surf,
+                            lines,
+                            nullptr,
+                            nullptr,
+                            nullptr);
+
+  //! Retrieve the line center of one line of the first band
+  const lbl::line_key key{.band = lines->front().key,
+                          .line = 50,
+                          .var  = LineByLineVariable::f0};
+
+  Array<Timing> out;
+  out.emplace_back("update-bands-rebuild")([&]() {
+    for (Index i = 0; i < n; i++) {
+      key.get_value(*lines) += 1e3;
+      for (auto& pm : op.pm.flat_view()) pm.set_bands(lines);
+    }
+  });
+
+  lbl::band_changes changes;
+  out.emplace_back("update-bands-incremental")([&]() {
+    for (Index i = 0; i < n; i++) {
+      key.get_value(*lines) += 1e3;
+      changes.set(key);
+      op.update_bands(changes.band_indices(*lines));
+      changes.clear();
+    }
+  });
+  return out;
+}
+
+Array<Timing> test_disort(Index nf) {
+  constexpr Index N     = 20;
+  constexpr Index NQuad = 16;
+
+  AscendingGrid tau(uniform_grid(0.1, N, 0.1));
+  const Matrix src(N, 2, 1e-15);
+
+  disort::main_data dis(N, NQuad, 1, 1, 2, 1, 1);
+  dis.solar_zenith()        = 1.0;
+  dis.beam_azimuth()        = 0.0;
+  dis.omega()               = 0.0;
+  dis.f()                   = 0.0;
+  dis.all_legendre_coeffs() = Matrix(N, 1, 1.0);
+  dis.positive_boundary()   = 0.0;
+  dis.negative_boundary()   = 0.0;
+  dis.brdf_modes()[0] =
+      disort::BDRF{[](ExhaustiveMatrixView x,
+                      const ExhaustiveConstVectorView&,
+                      const ExhaustiveConstVectorView&) { x = 0.0; }};
+
+  Tensor3 u(N, 1, NQuad);
+
+  Array<Timing> out;
+  out.emplace_back("disort-per-frequency")([&]() {
+    for (Index iv = 0; iv < nf; iv++) {
+      dis.tau()         = tau;
+      dis.source_poly() = src;
+      dis.update_all(0.0);
+      dis.gridded_u(u, {0.0});
+    }
+  });
+  return out;
+}
+
+int main(int argc, char** c) {
+  std::array<Index, 5> N;
+  if (static_cast<std::size_t>(argc) < 1 + 1 + N.size()) {
+    std::cerr << "Expects PROGNAME NREPEAT NSIZE..., wehere NSIZE is "
+              << N.size() << " indices\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto n = static_cast<Index>(std::atoll(c[1]));
+  for (std::size_t i = 0; i < N.size(); i++)
+    N[i] = static_cast<Index>(std::atoll(c[2 + i]));
+
+  make_wigner_ready(250, 20000000, 3);
+
+  std::cout << n << " radiative-transfer-performance-tests\n\n";
+  for (Index i = 0; i < n; i++) {
+    std::cout << N[0] << " lbl_calculate\n"
+              << test_lbl_calculate(N[0]) << '\n';
+    std::cout << N[0] << " lbl_jacobian\n"
+              << test_lbl_jacobian(N[0]) << '\n';
+    std::cout << N[0] << " lbl_band_index\n"
+              << test_lbl_band_index(N[0]) << '\n';
+    std::cout << N[0] << " zeeman_strengths\n"
+              << test_zeeman_strengths(N[0]) << '\n';
+    std::cout << N[0] << " lbl_zeeman\n"
+              << test_lbl_zeeman(N[0]) << '\n';
+    std::cout << N[0] << " lbl_adaptive_grid\n"
+              << test_lbl_adaptive_grid(N[0]) << '\n';
+    std::cout << N[0] << " lbl_prune\n" << test_lbl_prune(N[0]) << '\n';
+    std::cout << N[1] << " two_level_exp\n"
+              << test_two_level_exp(N[1]) << '\n';
+    std::cout << N[2] << " atm_field_at\n"
+              << test_atm_field_at(N[2]) << '\n';
+    std::cout << N[4] << " atm_field_igrf\n"
+              << test_atm_field_igrf(N[4]) << '\n';
+    std::cout << N[3] << " spectral_radiance\n"
+              << test_spectral_radiance(N[3]) << '\n';
+    std::cout << N[4] << " update_bands\n"
+              << test_update_bands(N[4]) << '\n';
+    std::cout << N[4] << " disort\n" << test_disort(N[4]) << '\n';
+  }
+}
@@ -0,0 +1,125 @@
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+#include "debug.h"
+#include "wigner_functions.h"
+
+namespace {
+constexpr bool triangle(int a, int b, int c) {
+  return std::abs(a - b) <= c and c <= a + b and (a + b + c) % 2 == 0;
+}
+
+bool same(Numeric x, Numeric y) {
+  return std::abs(x - y) <= 1e-12 * std::max(1.0, std::abs(y));
+}
+
+//! All 3j symbols with doubled arguments up to two_j, returns their count
+std::size_t test_wigner3j(int two_j) {
+  std::size_t n = 0;
+  for (int a = 0; a <= two_j; a++) {
+    for (int b = 0; b <= two_j; b++) {
+      for (int c = 0; c <= two_j; c++) {
+        if (not triangle(a, b, c)) continue;
+        for (int d = -a; d <= a; d += 2) {
+          for (int e = -b; e <= b; e += 2) {
+            const int f = -(d + e);
+            if (std::abs(f) > c) continue;
+
+            const Numeric x = wigner3j(Rational(a, 2),
+                                       Rational(b, 2),
+                                       Rational(c, 2),
+                                       Rational(d, 2),
+                                       Rational(e, 2),
+                                       Rational(f, 2));
+            const Numeric y = wig3jj(a, b, c, d, e, f);
+            ARTS_USER_ERROR_IF(not same(x, y),
+                               "3j ({} {} {}; {} {} {})/2 is {} but should "
+                               "be {}",
+                               a,
+                               b,
+                               c,
+                               d,
+                               e,
+                               f,
+                               x,
+                               y)
+            n++;
+          }
+        }
+      }
+    }
+  }
+  return n;
+}
+
+//! All 6j symbols with doubled arguments up to two_j, returns their count
+std::size_t test_wigner6j(int two_j) {
+  std::size_t n = 0;
+  for (int a = 0; a <= two_j; a++) {
+    for (int b = 0; b <= two_j; b++) {
+      for (int c = 0; c <= two_j; c++) {
+        if (not triangle(a, b, c)) continue;
+        for (int d = 0; d <= two_j; d++) {
+          for (int e = 0; e <= two_j; e++) {
+            if (not triangle(d, e, c)) continue;
+            for (int f = 0; f <= two_j; f++) {
+              if (not triangle(a, e, f) or not triangle(d, b, f)) continue;
+
+              const Numeric x = wigner6j(Rational(a, 2),
+                                         Rational(b, 2),
+                                         Rational(c, 2),
+                                         Rational(d, 2),
+                                         Rational(e, 2),
+                                         Rational(f, 2));
+              const Numeric y = wig6jj(a, b, c, d, e, f);
+              ARTS_USER_ERROR_IF(not same(x, y),
+                                 "6j {{{} {} {}; {} {} {}}}/2 is {} but "
+                                 "should be {}",
+                                 a,
+                                 b,
+                                 c,
+                                 d,
+                                 e,
+                                 f,
+                                 x,
+                                 y)
+              n++;
+            }
+          }
+        }
+      }
+    }
+  }
+  return n;
+}
+}  // namespace
+
+int main() try {
+  make_wigner_ready(100, 1000000, 6);
+  arts_wigner_thread_init(100);
+
+  // More symbols than the memo holds, so it is emptied during every pass.
+  // The second pass reads what survived the first, the third starts from
+  // an explicitly cleared memo
+  for (int pass = 0; pass < 3; pass++) {
+    if (pass == 2) arts_wigner_thread_clear();
+
+    const std::size_t n3 = test_wigner3j(16);
+    const std::size_t n6 = test_wigner6j(10);
+    ARTS_USER_ERROR_IF(n3 <= arts_wigner_cache_size or
+                           n6 <= arts_wigner_cache_size,
+                       "Only {} 3j and {} 6j symbols are tested, the memo "
+                       "holds {}",
+                       n3,
+                       n6,
+                       arts_wigner_cache_size)
+  }
+
+  arts_wigner_thread_free();
+  std::cout << "All Wigner symbol tests passed\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -1,17 +1,92 @@
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
 #include <iostream>
+
+#include "debug.h"
 #include "matpack_data.h"
 #include "xml_io_base.h"
 
-int main(int /*argc*/, char * /*argv*/[]) {
+namespace {
+String temp_file(const String& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+void remove_files(const String& filename) {
+  std::filesystem::remove(filename);
+  std::filesystem::remove(filename + ".bin");
+}
+
+//! A value that is unique for every element
+template <typename T>
+void fill(T& x) {
+  Numeric v = 0.0;
+  for (auto& e : x.flat_view()) e = v++;
+}
+
+template <typename T, typename U>
+bool equal(const T& x, const U& y) {
+  return x.shape() == y.shape() and
+         std::ranges::equal(x.flat_view(), y.flat_view());
+}
+
+void test_ascii() {
+  const String filename = temp_file("arts_test_xml_ascii.xml");
 
-  Vector v1{1, 2, 3, 4, 5};
-  String filename{"test.xml"};
+  const Vector v1{1, 2, 3, 4, 5};
   xml_write_to_file_base(filename, v1, FileType::ascii);
-  std::cout << v1 << '\n';
 
   Vector v2;
   xml_read_from_file_base(filename, v2);
-  std::cout << v2 << '\n';
+  ARTS_USER_ERROR_IF(not equal(v1, v2),
+                     "Ascii vector {:B,} is read as {:B,}",
+                     v1,
+                     v2)
+
+  remove_files(filename);
+}
+
+//! Binary data is read from the memory map, and can be mapped directly
+template <Index N, typename T>
+void test_binary(T x, const String& name) {
+  const String filename = temp_file("arts_test_xml_binary_" + name + ".xml");
+
+  fill(x);
+  xml_write_to_file_base(filename, x, FileType::binary);
+
+  T y;
+  xml_read_from_file_base(filename, y);
+  ARTS_USER_ERROR_IF(not equal(x, y), "{}: Reading changes the data", name)
+
+  {
+    auto mapped = xml_map_from_file<N>(filename);
+    ARTS_USER_ERROR_IF(
+        not equal(x, mapped.data), "{}: Mapping changes the data", name)
+
+    // Writing to the mapped data never changes the file
+    mapped.data.flat_view() = -1.0;
+    T z;
+    xml_read_from_file_base(filename, z);
+    ARTS_USER_ERROR_IF(
+        not equal(x, z), "{}: Writing to the map changes the file", name)
+  }
+
+  // Mapped files cannot be removed on Windows
+  remove_files(filename);
+}
+}  // namespace
 
-  return (0);
+int main() try {
+  test_ascii();
+  test_binary<1>(Vector(11), "Vector");
+  test_binary<2>(Matrix(4, 5), "Matrix");
+  test_binary<3>(Tensor3(2, 3, 4), "Tensor3");
+  test_binary<4>(Tensor4(2, 3, 4, 5), "Tensor4");
+  test_binary<7>(Tensor7(2, 1, 3, 1, 2, 2, 3), "Tensor7");
+  test_binary<1>(Vector(), "Empty");
+  std::cout << "All XML tests passed\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
 }
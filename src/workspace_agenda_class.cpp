@@ -228,6 +228,93 @@ Workspace Agenda::copy_workspace(const Workspace& in) const {
   return out;
 }
 
+struct AgendaWorkspacePool::Fork {
+  Workspace ws{WorkspaceInitialization::Empty};
+
+  //! Storage of copied variables, kept between calls
+  std::unordered_map<std::string, Wsv> slots{};
+
+  bool in_use{false};
+};
+
+AgendaWorkspacePool::AgendaWorkspacePool()  = default;
+AgendaWorkspacePool::~AgendaWorkspacePool() = default;
+
+AgendaWorkspacePool::Lease AgendaWorkspacePool::acquire() {
+  auto ptr = std::ranges::find_if(
+      forks, [](const auto& fork) { return not fork->in_use; });
+  if (ptr == forks.end()) {
+    forks.push_back(std::make_unique<Fork>());
+    ptr = std::prev(forks.end());
+  }
+  return Lease{ptr->get()};
+}
+
+AgendaWorkspacePool::Lease::Lease(Fork* f) : fork(f) { fork->in_use = true; }
+
+AgendaWorkspacePool::Lease::~Lease() {
+  fork->ws     = Workspace{WorkspaceInitialization::Empty};
+  fork->in_use = false;
+}
+
+Workspace& AgendaWorkspacePool::Lease::ws() { return fork->ws; }
+
+namespace {
+//! True if nothing but the pool holds the storage of the variable
+bool only_held_by_pool(const Wsv& v) {
+  return std::visit([](auto& ptr) { return ptr.use_count() == 1; }, v.value());
+}
+}  // namespace
+
+void AgendaWorkspacePool::Lease::copy_workspace(const Agenda& agenda,
+                                                const Workspace& in) try {
+  Workspace& out = fork->ws;
+
+  for (auto& str : agenda.get_share()) {
+    out.set(str, in.share(str));
+  }
+
+  for (auto& str : agenda.get_copy()) {
+    //! Same source as Agenda::copy_workspace
+    const Wsv& src = out.contains(str) ? out.share(str) : in.share(str);
+
+    //! The storage is only reused if no handle to it has escaped an earlier
+    //! call, otherwise a new copy is made so the holder is not modified
+    auto slot = fork->slots.find(str);
+    if (slot != fork->slots.end() and slot->second.holds_same(src) and
+        only_held_by_pool(slot->second)) {
+      std::visit(
+          [&src](auto& v) {
+            *v = *std::get<std::remove_cvref_t<decltype(v)>>(src.value());
+          },
+          slot->second.value());
+    } else {
+      slot = fork->slots.insert_or_assign(str, src.copy()).first;
+    }
+
+    out.overwrite(str, slot->second);
+  }
+
+  WorkspaceAgendaBoolHandler handle;
+  handle.set(agenda.get_name());
+  agenda_add_inner_logic(out, in, handle);
+} catch (std::exception& e) {
+  throw std::runtime_error(std::format(
+      R"(
+Error with workspace copying in Agenda
+
+Workspace contains:
+{:s}
+
+{})",
+      in,
+      e.what()));
+}
+
+void AgendaWorkspacePool::Lease::execute(const Agenda& agenda) {
+  agenda.execute(fork->ws);
+}
+
 void Agenda::execute(Workspace& ws) const try {
   for (auto& method : methods) {
     method(ws);
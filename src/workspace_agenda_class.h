@@ -2,7 +2,9 @@
 
 #include <array.h>
 
+#include <memory>
 #include <ostream>
+#include <string>
 #include <vector>
 
 class Method;
@@ -64,4 +66,51 @@ class Agenda {
 
 using ArrayOfAgenda = Array<Agenda>;
 
+/** Reusable local workspaces for repeated calls of a named agenda
+ *
+ * A named agenda call builds a local workspace that shares the calling
+ * workspace by pointer.  On its own, this deep-copies the "copy" variables
+ * on every call.
+ *
+ * A leased fork keeps the storage of the copies between calls on the same
+ * thread, so that repeated calls (e.g., per path point) assign into existing
+ * containers.  Only the storage is reused, the values are those of the
+ * current call, and storage that something outside the pool still holds is
+ * never reused.  Everything else is dropped when the lease ends, so a call
+ * sees the same workspace as with Agenda::copy_workspace.  Keep one pool per
+ * thread, e.g., as a static thread_local.  Recursive calls lease another fork
+ * from the same pool.
+ */
+class AgendaWorkspacePool {
+  struct Fork;
+  std::vector<std::unique_ptr<Fork>> forks{};
+
+ public:
+  class Lease {
+    Fork* fork;
+
+   public:
+    explicit Lease(Fork* f);
+    Lease(const Lease&)            = delete;
+    Lease& operator=(const Lease&) = delete;
+    ~Lease();
+
+    //! The local workspace of the agenda call
+    [[nodiscard]] Workspace& ws();
+
+    //! As Agenda::copy_workspace, but reuses the storage of earlier calls
+    void copy_workspace(const Agenda& agenda, const Workspace& in);
+
+    //! Executes the agenda on the local workspace
+    void execute(const Agenda& agenda);
+  };
+
+  AgendaWorkspacePool();
+  AgendaWorkspacePool(const AgendaWorkspacePool&)            = delete;
+  AgendaWorkspacePool& operator=(const AgendaWorkspacePool&) = delete;
+  ~AgendaWorkspacePool();
+
+  [[nodiscard]] Lease acquire();
+};
+
 std::ostream& operator<<(std::ostream& os, const ArrayOfAgenda& a);
@@ -111,6 +111,20 @@ is not yet any calculated Jacobian.
                  "inversion_iterate_agenda_counter"},
   };
 
+  wsa_data["measurement_jacobian_product_agenda"] = {
+      .desc   = R"--(Products of the Jacobian of the forward model with vectors.
+
+The Jacobian is that of *inversion_iterate_agenda* at *model_state_vector*.
+The agenda is used by *OEMMatrixFree*, which never needs the full
+*measurement_jacobian*.  The products can e.g. come from a tangent-linear
+and adjoint model, or from a Jacobian that is kept in a compressed form.
+)--",
+      .output = {"measurement_jacobian_product"},
+      .input  = {"model_state_vector",
+                 "measurement_jacobian_product_vector",
+                 "measurement_jacobian_product_transpose"},
+  };
+
   wsa_data["disort_settings_agenda"] = {
       .desc   = R"--(An agenda for setting up Disort.
 
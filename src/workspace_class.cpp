@@ -2,6 +2,7 @@
 
 #include <auto_wsv.h>
 
+#include <mutex>
 #include <ranges>
 #include <stdexcept>
 #include <type_traits>
@@ -20,6 +21,59 @@ Workspace::Workspace(WorkspaceInitialization how_to_initialize) : wsv{} {
   }
 }
 
+WorkspaceSlot::WorkspaceSlot(std::string n) : name(std::move(n)) {
+  static std::mutex mtx;
+  static std::unordered_map<std::string, std::size_t> indices;
+
+  std::lock_guard lock(mtx);
+  index = indices.try_emplace(name, indices.size()).first->second;
+}
+
+// The slot cache points into the map of the copied-from workspace, so
+// copies start without one and moves take it along with the map nodes.
+Workspace::Workspace(const Workspace& ws) : wsv(ws.wsv) {}
+
+Workspace::Workspace(Workspace&& ws) noexcept
+    : wsv(std::move(ws.wsv)), slots(std::move(ws.slots)) {
+  ws.slots.clear();
+}
+
+Workspace& Workspace::operator=(const Workspace& ws) {
+  if (this != &ws) {
+    wsv = ws.wsv;
+    slots.clear();
+  }
+  return *this;
+}
+
+Workspace& Workspace::operator=(Workspace&& ws) noexcept {
+  if (this != &ws) {
+    wsv   = std::move(ws.wsv);
+    slots = std::move(ws.slots);
+    ws.slots.clear();
+  }
+  return *this;
+}
+
+Wsv* Workspace::find(const WorkspaceSlot& slot) {
+  if (slot.index < slots.size() and slots[slot.index] != nullptr) {
+    return slots[slot.index];
+  }
+
+  auto ptr = wsv.find(slot.name);
+  if (ptr == wsv.end()) return nullptr;
+
+  // Nothing is ever erased from wsv, so the address of the node is stable
+  if (slot.index >= slots.size()) slots.resize(slot.index + 1, nullptr);
+  return slots[slot.index] = &ptr->second;
+}
+
+const Wsv& Workspace::share(const WorkspaceSlot& slot) {
+  if (Wsv* ptr = find(slot); ptr != nullptr) return *ptr;
+  throw std::runtime_error(
+      var_string("Undefined workspace variable ", '"', slot.name, '"'));
+}
+
 const Wsv& Workspace::share(const std::string& name) const try {
   return wsv.at(name);
 } catch (std::out_of_range&) {
@@ -1,24 +1,41 @@
 #pragma once
 
+#include "workspace_slot.h"
 #include "workspace_wsv.h"
 
 #include <format_tags.h>
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 enum class WorkspaceInitialization : bool { FromGlobalDefaults, Empty };
 
 class Workspace {
   std::unordered_map<std::string, Wsv> wsv;
 
+  //! Pointers into wsv by WorkspaceSlot::index, nullptr if not yet looked up
+  std::vector<Wsv*> slots;
+
+  //! The variable of the slot, or nullptr if it is not in the workspace
+  [[nodiscard]] Wsv* find(const WorkspaceSlot& slot);
+
  public:
   Workspace(WorkspaceInitialization how_to_initialize =
                 WorkspaceInitialization::FromGlobalDefaults);
 
+  Workspace(const Workspace&);
+  Workspace(Workspace&&) noexcept;
+  Workspace& operator=(const Workspace&);
+  Workspace& operator=(Workspace&&) noexcept;
+  ~Workspace() = default;
+
   //! Returns a shared pointer to the workspace variable with the given name.
   [[nodiscard]] const Wsv& share(const std::string& name) const;
 
+  //! As share, but looks the variable up via a slot
+  [[nodiscard]] const Wsv& share(const WorkspaceSlot& slot);
+
   //! Returns a copy of the workspace variable with the given name.
   [[nodiscard]] Wsv copy(const std::string& name) const;
 
@@ -76,6 +93,14 @@ class Workspace {
   template <WorkspaceGroup T>
   [[nodiscard]] T& get_or(const std::string& name);
 
+  //! As get, but looks the variable up via a slot
+  template <WorkspaceGroup T>
+  [[nodiscard]] T& get(const WorkspaceSlot& slot);
+
+  //! As get_or, but looks the variable up via a slot
+  template <WorkspaceGroup T>
+  [[nodiscard]] T& get_or(const WorkspaceSlot& slot);
+
   //! Checks if the workspace variable with the given name exists.
   [[nodiscard]] bool contains(const std::string& name) const;
 
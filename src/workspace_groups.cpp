@@ -22,6 +22,12 @@ internal_workspace_groups_creator() {
       .array_depth = 2,
   };
 
+  wsg_data["AbsorptionBandIndex"] = {
+      .file = "lbl.h",
+      .desc =
+          "A lookup of the *AbsorptionBand* that can contribute in a frequency range\n",
+  };
+
   wsg_data["Agenda"] = {
       .file = "workspace_agenda_class.h",
       .desc = "Describes a set of function calls and variable definitions\n",
@@ -547,6 +553,13 @@ Both the data and the grid may be named
 )--",
   };
 
+  wsg_data["LinemixingEcsTables"] = {
+      .file = "lbl.h",
+      .desc =
+          R"--(A map of equivalent lines of ECS bands tabulated in temperature
+)--",
+  };
+
   wsg_data["MCAntenna"] = {
       .file = "mc_antenna.h",
       .desc = "An antenna object used by ``MCGeneral``\n",
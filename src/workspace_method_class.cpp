@@ -71,7 +71,10 @@ Method::Method() : name("this-is-not-a-method") {}
 Method::Method(const std::string& n,
                const std::vector<std::string>& a,
                const std::unordered_map<std::string, std::string>& kw) try
-    : name(n), outargs(wsms.at(name).out), inargs(wsms.at(name).in) {
+    : name(n),
+      outargs(wsms.at(name).out),
+      inargs(wsms.at(name).in),
+      record(&wsms.at(name)) {
   const std::size_t nargout = outargs.size();
   const std::size_t nargin  = inargs.size();
 
@@ -176,7 +179,7 @@ Method::Method(const std::string& n,
 
   // Check that all non-defaulted GINS are set
   for (std::size_t i = 0; i < nargin; i++) {
-    if (inargs[i].front() == '_' and not wsms.at(n).defs.contains(inargs[i])) {
+    if (inargs[i].front() == '_' and not record->defs.contains(inargs[i])) {
       throw std::runtime_error(
           var_string("Missing required generic input argument ",
                      '"',
@@ -184,6 +187,8 @@ Method::Method(const std::string& n,
                      '"'));
     }
   }
+
+  resolve_slots();
 } catch (std::out_of_range&) {
   throw std::runtime_error(var_string("No method named ", '"', n, '"'));
 } catch (std::exception& e) {
@@ -218,8 +223,10 @@ void Method::operator()(Workspace& ws) const try {
         ws.set(name, wsv.copy());
       }
     }
+  } else if (record) {
+    record->func(ws, outslots, inslots);
   } else {
-    wsms.at(name).func(ws, outargs, inargs);
+    wsms.at(name).func(ws, outslots, inslots);
   }
 } catch (std::out_of_range&) {
   throw std::runtime_error(var_string("No method named ", '"', name, '"'));
@@ -230,7 +237,7 @@ void Method::operator()(Workspace& ws) const try {
 
 void Method::add_defaults_to_agenda(Agenda& agenda) const {
   if (not setval) {
-    const auto& map = wsms.at(name).defs;
+    const auto& map = record ? record->defs : wsms.at(name).defs;
     for (auto& arg : inargs) {
       if (arg.front() == '_' and map.contains(arg)) {
         agenda.add(Method{arg, map.at(arg), true});
@@ -248,7 +255,21 @@ Method::Method(const std::string& n,
       outargs(outs),
       inargs(ins),
       setval(wsv),
-      overwrite_setval(overwrite) {}
+      overwrite_setval(overwrite) {
+  if (not setval) {
+    if (auto ptr = wsms.find(name); ptr != wsms.end()) record = &ptr->second;
+    resolve_slots();
+  }
+}
+
+void Method::resolve_slots() {
+  outslots.clear();
+  inslots.clear();
+  outslots.reserve(outargs.size());
+  inslots.reserve(inargs.size());
+  for (auto& arg : outargs) outslots.emplace_back(arg);
+  for (auto& arg : inargs) inslots.emplace_back(arg);
+}
 
 std::string std::formatter<Wsv>::to_string(const Wsv& wsv) const {
   return std::visit(
@@ -7,9 +7,12 @@
 #include <unordered_map>
 #include <vector>
 
+#include "workspace_slot.h"
 #include "workspace_wsv.h"
 #include "format_tags.h"
 
+struct WorkspaceMethodRecord;
+
 class Method {
   std::string name{};
   std::vector<std::string> outargs{};
@@ -17,6 +20,15 @@ class Method {
   std::optional<Wsv> setval{std::nullopt};
   bool overwrite_setval{false};
 
+  //! The method to call, resolved once on construction rather than by name on every call
+  const WorkspaceMethodRecord* record{nullptr};
+
+  //! The arguments, resolved once on construction rather than by name on every call
+  std::vector<WorkspaceSlot> outslots{};
+  std::vector<WorkspaceSlot> inslots{};
+
+  void resolve_slots();
+
  public:
   Method();
   Method(const std::string& name,
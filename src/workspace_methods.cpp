@@ -687,6 +687,28 @@ spherical harmonics and is only valid for a limited time period.
       .gin_desc  = {"Time of data to use"},
   };
 
+  wsm_data["atmospheric_fieldTabulateFunctional"] = {
+      .desc      = R"--(Tabulate all functional data of the field on a grid.
+
+Functional data, such as that of *atmospheric_fieldIGRF*, may be expensive
+to evaluate at every point where the field is used.  This method evaluates
+all of the functional data of the field once at every point of the grid
+and replaces it with gridded data.  The extrapolation settings are kept.
+
+The field is afterwards interpolated between the grid points.  The grid
+must thus be fine enough for the functional data to be represented well.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"atmospheric_field"},
+      .in        = {"atmospheric_field"},
+      .gin       = {"alt", "lat", "lon"},
+      .gin_type  = {"AscendingGrid", "AscendingGrid", "AscendingGrid"},
+      .gin_value = {std::nullopt, std::nullopt, std::nullopt},
+      .gin_desc  = {"Altitude grid [m]",
+                    "Latitude grid [deg]",
+                    "Longitude grid [deg]"},
+  };
+
   wsm_data["atmospheric_fieldInit"] = {
       .desc =
           R"--(Initialize the atmospheric field with some altitude and isotopologue ratios
@@ -850,6 +872,26 @@ Sets N2 and O2 speces
       .out    = {"ecs_data"},
   };
 
+  wsm_data["ecs_tablesTabulate"] = {
+      .desc      = R"--(Tabulates the equivalent lines of all ECS bands in temperature
+
+The relaxation matrix of every band with an ECS lineshape is diagonalized
+once per temperature, at the pressure and broadening species VMRs of the
+*atmospheric_point*.  Line-by-line methods then interpolate the equivalent
+lines in temperature and scale them to the pressure instead of diagonalizing
+the relaxation matrix at every point.
+
+Recompute the tables whenever *absorption_bands* or *ecs_data* is changed.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"ecs_tables"},
+      .in        = {"absorption_bands", "ecs_data", "atmospheric_point"},
+      .gin       = {"temperatures"},
+      .gin_type  = {"AscendingGrid"},
+      .gin_value = {std::nullopt},
+      .gin_desc  = {"The temperature grid of the tables"},
+  };
+
   wsm_data["ecs_dataAddMeanAir"] = {
       .desc      = R"--(Sets ECS data for air from other data if available.
 )--",
@@ -1408,6 +1450,58 @@ this method.
                     R"--(Positive value forces constant temperature [K].)--"},
   };
 
+  wsm_data["propagation_matrixAddParticlesBulk"] = {
+      .desc =
+          R"--(Adds the bulk extinction of one scattering species to *propagation_matrix*.
+
+The particle number densities are the single moment modified gamma PSD,
+evaluated at ``particle_sizes`` and weighted by the trapezoidal size bin
+widths.  The moment is the mass density of ``scat_species`` in
+*atmospheric_point*.
+
+All scattering elements must be totally randomly oriented.  Their
+extinction and absorption are interpolated to *frequency_grid* and linearly
+in temperature.
+
+The temperature and mass density derivatives are computed by perturbation.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"propagation_matrix", "propagation_matrix_jacobian"},
+      .in        = {"propagation_matrix",
+                    "propagation_matrix_jacobian",
+                    "frequency_grid",
+                    "jacobian_targets",
+                    "atmospheric_point"},
+      .gin       = {"scat_data",
+                    "scat_species",
+                    "particle_sizes",
+                    "mass_size_a",
+                    "mass_size_b",
+                    "psd_name",
+                    "use_abs_as_ext"},
+      .gin_type  = {"ArrayOfSingleScatteringData",
+                    "String",
+                    "Vector",
+                    "Numeric",
+                    "Numeric",
+                    "String",
+                    "Index"},
+      .gin_value = {std::nullopt,
+                    std::nullopt,
+                    std::nullopt,
+                    std::nullopt,
+                    std::nullopt,
+                    String{"Abel12"},
+                    Index{0}},
+      .gin_desc  = {R"--(The single scattering data of each element)--",
+                    R"--(The name of the scattering species)--",
+                    R"--(The size of each element, strictly increasing)--",
+                    R"--(The a parameter of the mass-size relationship)--",
+                    R"--(The b parameter of the mass-size relationship)--",
+                    R"--(The PSD, one of "Abel12", "Wang16" or "Field19")--",
+                    R"--(Use absorption instead of extinction)--"},
+  };
+
   wsm_data["propagation_matrix_scatteringInit"] = {
       .desc =
           R"--(Initialize *propagation_matrix_scattering* to zeroes.
@@ -1855,12 +1949,32 @@ Also be aware that *spectral_radiance_jacobianApplyUnit* must be called before *
 
   wsm_data["propagation_matrixAddLines"] = {
       .desc      = R"--(Modern line-by-line calculations
+
+If *line_pruning* is positive, the lines are pruned for the current
+*atmospheric_point* before the calculations.  The contribution of each
+line to the frequency range is estimated from its strength and its
+pressure broadening and Doppler widths.  Half of the relative error budget
+is spent on skipping the weakest lines, the other half on limiting the kept
+lines to a local window by a cutoff.  The estimates are rough, so the
+budget is approximate: the error relative to the strongest absorption may
+exceed *line_pruning* by a small factor.  This cannot be combined with line
+parameter jacobian targets.  The pruning only selects lines, the bands and
+*absorption_band_index* are used as they are.
+
+The bands are looked up in *absorption_band_index* unless it is empty, in
+which case a temporary index is built for the call.
+
+ECS bands with an entry in *ecs_tables* use the tabulated equivalent lines,
+other ECS bands diagonalize their relaxation matrix using *ecs_data*.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"propagation_matrix",
                     "propagation_matrix_source_vector_nonlte",
                     "propagation_matrix_jacobian",
                     "propagation_matrix_source_vector_nonlte_jacobian"},
+      .gout      = {"evaluated_lines"},
+      .gout_type = {"Index"},
+      .gout_desc = {"The number of lines of the species that are evaluated, after pruning"},
       .in        = {"propagation_matrix",
                     "propagation_matrix_source_vector_nonlte",
                     "propagation_matrix_jacobian",
@@ -1869,14 +1983,17 @@ Also be aware that *spectral_radiance_jacobianApplyUnit* must be called before *
                     "jacobian_targets",
                     "propagation_matrix_select_species",
                     "absorption_bands",
+                    "absorption_band_index",
                     "ecs_data",
+                    "ecs_tables",
                     "atmospheric_point",
                     "ray_path_point"},
-      .gin       = {"no_negative_absorption"},
-      .gin_type  = {"Index"},
-      .gin_value = {Index{1}},
+      .gin       = {"no_negative_absorption", "line_pruning"},
+      .gin_type  = {"Index", "Numeric"},
+      .gin_value = {Index{1}, Numeric{0.0}},
       .gin_desc =
-          {"Turn off to allow individual absorbers to have negative absorption"},
+          {"Turn off to allow individual absorbers to have negative absorption",
+           "Relative error budget for skipping weak lines and limiting lines to a local window, no pruning if 0"},
   };
 
   wsm_data["jacobian_targetsInit"] = {
@@ -2020,6 +2137,42 @@ See *SpeciesIsotope* for valid ``species``
            "The perturbation used in methods that cannot compute derivatives analytically"},
   };
 
+  wsm_data["jacobian_targetsAddLineParameter"] = {
+      .desc      = R"--(Set a line parameter derivative
+
+The ``parameter`` is either a *LineByLineVariable* or a
+*LineShapeModelVariable*.  For the latter, one target is added per
+coefficient of the temperature model of ``species`` in the line, in
+order X0, X1, ...
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"jacobian_targets"},
+      .in        = {"jacobian_targets", "absorption_bands"},
+      .gin       = {"id", "line_index", "parameter", "species", "d"},
+      .gin_type  = {"QuantumIdentifier", "Index", "String", "SpeciesEnum", "Numeric"},
+      .gin_value = {std::nullopt,
+                    std::nullopt,
+                    std::nullopt,
+                    SpeciesEnum{SpeciesEnum::Bath},
+                    Numeric{0.1}},
+      .gin_desc =
+          {"The band identifier",
+           "The index of the line in the band",
+           "The line parameter",
+           "The line shape species, only used for line shape parameters",
+           "The perturbation used in methods that cannot compute derivatives analytically"},
+  };
+
+  wsm_data["absorption_band_indexFromBands"] = {
+      .desc   = R"--(Build the *absorption_band_index* of the *absorption_bands*
+
+Call it again whenever *absorption_bands* is changed.
+)--",
+      .author = {"Richard Larsson"},
+      .out    = {"absorption_band_index"},
+      .in     = {"absorption_bands"},
+  };
+
   wsm_data["absorption_bandsSelectFrequency"] = {
       .desc =
           R"--(Remove all lines/bands that strictly falls outside a frequency range
@@ -2124,6 +2277,113 @@ variables are not considered
       .gin_desc  = {"Absolute or relative path to the directory"},
   };
 
+  wsm_data["absorption_bandsReadHITRAN"] = {
+      .desc      = R"--(Reads *absorption_bands* from a HITRAN catalog
+
+The catalog is read in large blocks.  The position and intensity of each
+record are read directly from their fields, and records outside of
+[``fmin``, ``fmax``] or weaker than ``intensity_min`` are skipped without
+being parsed.  The catalog must be sorted by frequency, as reading stops at
+the first record above ``fmax``.  The remaining records of a block are parsed
+in parallel.
+
+``intensity_min`` is in Hz m^2, and like the catalog intensity it includes
+the isotopologue ratio.
+
+All bands are given the ``lineshape`` (see *LineByLineLineshape*), and the
+``cutoff`` (see *LineByLineCutoffType*) with its ``cutoff_value``.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"absorption_bands"},
+      .gin       = {"file",
+                    "fmin",
+                    "fmax",
+                    "intensity_min",
+                    "hitran_type",
+                    "globalquantumnumbers",
+                    "localquantumnumbers",
+                    "lineshape",
+                    "cutoff",
+                    "cutoff_value"},
+      .gin_type  = {"String",
+                    "Numeric",
+                    "Numeric",
+                    "Numeric",
+                    "String",
+                    "String",
+                    "String",
+                    "String",
+                    "String",
+                    "Numeric"},
+      .gin_value = {std::nullopt,
+                    -std::numeric_limits<Numeric>::infinity(),
+                    std::numeric_limits<Numeric>::infinity(),
+                    Numeric{0.0},
+                    String{"Online"},
+                    String{"DEFAULT_GLOBAL"},
+                    String{"DEFAULT_LOCAL"},
+                    String{"VP_LTE"},
+                    String{"None"},
+                    Numeric{std::numeric_limits<Numeric>::infinity()}},
+      .gin_desc  = {"Path to the catalog",
+                    "Minimum frequency to keep",
+                    "Maximum frequency to keep",
+                    "Minimum intensity to keep",
+                    "Type of HITRAN catalog: Pre2004, Post2004, or Online",
+                    "Global quantum numbers that identify a band",
+                    "Local quantum numbers kept per line",
+                    "Line shape of the bands",
+                    "Cutoff type of the bands",
+                    "Cutoff value of the bands"},
+  };
+
+  wsm_data["absorption_bandsReadJPL"] = {
+      .desc      = R"--(Reads *absorption_bands* from a JPL catalog
+
+Works as *absorption_bandsReadHITRAN*, but for a JPL catalog.
+
+``intensity_min`` is in Hz m^2.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"absorption_bands"},
+      .gin       = {"file",
+                    "fmin",
+                    "fmax",
+                    "intensity_min",
+                    "globalquantumnumbers",
+                    "localquantumnumbers",
+                    "lineshape",
+                    "cutoff",
+                    "cutoff_value"},
+      .gin_type  = {"String",
+                    "Numeric",
+                    "Numeric",
+                    "Numeric",
+                    "String",
+                    "String",
+                    "String",
+                    "String",
+                    "Numeric"},
+      .gin_value = {std::nullopt,
+                    -std::numeric_limits<Numeric>::infinity(),
+                    std::numeric_limits<Numeric>::infinity(),
+                    Numeric{0.0},
+                    String{"DEFAULT_GLOBAL"},
+                    String{"DEFAULT_LOCAL"},
+                    String{"VP_LTE"},
+                    String{"None"},
+                    Numeric{std::numeric_limits<Numeric>::infinity()}},
+      .gin_desc  = {"Path to the catalog",
+                    "Minimum frequency to keep",
+                    "Maximum frequency to keep",
+                    "Minimum intensity to keep",
+                    "Global quantum numbers that identify a band",
+                    "Local quantum numbers kept per line",
+                    "Line shape of the bands",
+                    "Cutoff type of the bands",
+                    "Cutoff value of the bands"},
+  };
+
   wsm_data["absorption_bandsSaveSplit"] = {
       .desc      = R"--(Saves all bands fin *absorption_bands* to a directory
 
@@ -2133,13 +2393,18 @@ will be stored as 0.xml, 1.xml, 2.xml, and so on
 
 The ``dir`` path has to be absolute or relative to the working path, the environment
 variables are not considered
+
+With a binary ``output_file_format``, the line data is stored column-wise
+and is much faster to read back than the ascii format.  See *FileType*
+for valid formats.
 )--",
       .author    = {"Richard Larsson"},
       .in        = {"absorption_bands"},
-      .gin       = {"dir"},
-      .gin_type  = {"String"},
-      .gin_value = {std::nullopt},
-      .gin_desc  = {"Absolute or relative path to the directory"},
+      .gin       = {"dir", "output_file_format"},
+      .gin_type  = {"String", "String"},
+      .gin_value = {std::nullopt, String("ascii")},
+      .gin_desc  = {"Absolute or relative path to the directory",
+                    "The format of the output"},
   };
 
   wsm_data["ray_pathGeometricUplooking"] = {
@@ -3025,6 +3290,62 @@ Hence, a temperature of 0 means 0s the edges of the *frequency_grid*.
       .pass_workspace = true,
   };
 
+  wsm_data["ray_path_spectral_radiance_scatteringSunsFirstOrderRayleighFromProfile"] = {
+      .desc     = R"--(Add *suns* to *ray_path_spectral_radiance_source*.
+
+As *ray_path_spectral_radiance_scatteringSunsFirstOrderRayleigh* but the
+transmission along *ray_path_suns_path* is computed from the propagation
+matrices interpolated in altitude from *propagation_matrix_profile*.
+The profile only has to be computed once, e.g., by
+*propagation_matrix_profileFromAltitudeGrid*, and can then be shared
+between all the observer geometries of a scan.  This is much faster than
+executing *propagation_matrix_agenda* along every sun path.
+
+The atmosphere is then assumed to be horizontally homogeneous over the
+region of the sun paths.  The altitude grid must cover all the points of
+the sun paths.
+)--",
+      .author   = {"Richard Larsson"},
+      .out      = {"ray_path_spectral_radiance_scattering"},
+      .in       = {"ray_path_propagation_matrix_scattering",
+                   "ray_path",
+                   "ray_path_suns_path",
+                   "suns",
+                   "frequency_grid",
+                   "surface_field",
+                   "propagation_matrix_profile",
+                   "propagation_matrix_profile_altitude"},
+      .gin      = {"depolarization_factor"},
+      .gin_type = {"Numeric"},
+      .gin_value = {Numeric{0.0}},
+      .gin_desc  = {R"--(The depolarization factor to use.)--"},
+  };
+
+  wsm_data["propagation_matrix_profileFromAltitudeGrid"] = {
+      .desc = R"--(Tabulates the propagation matrix on an altitude grid.
+
+The *propagation_matrix_agenda* is executed once for every altitude of
+the grid at the given latitude and longitude.  The line-of-sight is
+looking straight up and *frequency_grid* is used without Doppler shifts,
+so the profile is not suitable for wind or Zeeman calculations.
+
+The calculations are in parallel if the program is not in parallel already.
+)--",
+      .author         = {"Richard Larsson"},
+      .out            = {"propagation_matrix_profile",
+                         "propagation_matrix_profile_altitude"},
+      .in             = {"propagation_matrix_agenda",
+                         "frequency_grid",
+                         "atmospheric_field"},
+      .gin            = {"altitude_grid", "latitude", "longitude"},
+      .gin_type       = {"AscendingGrid", "Numeric", "Numeric"},
+      .gin_value      = {std::nullopt, Numeric{0.0}, Numeric{0.0}},
+      .gin_desc       = {"The altitude grid [m]",
+                         "The latitude of the profile [deg]",
+                         "The longitude of the profile [deg]"},
+      .pass_workspace = true,
+  };
+
   wsm_data["atmospheric_fieldFromModelState"] = {
       .desc   = R"--(Sets *atmospheric_field* to the state of the model.
 )--",
@@ -3043,12 +3364,35 @@ Hence, a temperature of 0 means 0s the edges of the *frequency_grid*.
 
   wsm_data["absorption_bandsFromModelState"] = {
       .desc   = R"--(Sets *absorption_bands* to the state of the model.
+
+A *spectral_radiance_operator* that uses *absorption_bands* is not updated,
+see *spectral_radiance_operatorFromModelState*.
 )--",
       .author = {"Richard Larsson"},
       .out    = {"absorption_bands"},
       .in     = {"absorption_bands", "model_state_vector", "jacobian_targets"},
   };
 
+  wsm_data["spectral_radiance_operatorFromModelState"] = {
+      .desc   = R"--(Sets *absorption_bands* to the state of the model and updates
+the *spectral_radiance_operator* that uses them.
+
+Only the line shapes of the bands whose parameters changed are recomputed
+in the operator.  This is much faster than setting up a new operator, e.g.,
+in the *inversion_iterate_agenda* of a retrieval of line parameters.
+
+Only the line parameter targets of *jacobian_targets* are applied.  The
+operator must have been set up with the *absorption_bands* of this
+workspace, see *spectral_radiance_operatorClearsky1D*.
+)--",
+      .author = {"Richard Larsson"},
+      .out    = {"spectral_radiance_operator", "absorption_bands"},
+      .in     = {"spectral_radiance_operator",
+                 "absorption_bands",
+                 "model_state_vector",
+                 "jacobian_targets"},
+  };
+
   wsm_data["model_state_vectorSize"] = {
       .desc =
           R"--(Sets *model_state_vector* to the size *jacobian_targets* demand.
@@ -3309,6 +3653,82 @@ Description of the special input arguments:
       .pass_workspace = true,
   };
 
+  wsm_data["OEMMatrixFree"] = {
+      .desc      = R"(Matrix-free inversion by the optimal estimation method (OEM).
+
+As *OEM* with the conjugate gradient methods, but the Jacobian of the
+forward model is never stored.  Instead, the products of the Jacobian
+and its transpose with vectors are computed by
+*measurement_jacobian_product_agenda* as the conjugate gradient solver
+needs them.  The *inversion_iterate_agenda* is only used to compute
+*measurement_vector_fitted*, without Jacobian.
+
+This keeps the memory use proportional to the sizes of
+*measurement_vector* and *model_state_vector* instead of their product,
+at the cost of executing *measurement_jacobian_product_agenda* a few
+times per conjugate gradient iteration.
+
+The ``method`` is one of ``"li_cg"``, ``"gn_cg"`` and ``"lm_cg"``, see
+*OEM* for these and for the other arguments.  No gain matrix is computed,
+since that requires the full Jacobian.
+
+The ``oem_performance`` has 4 elements (0-based index):
+
+    0. The number of Jacobian products.
+    1. The number of transposed Jacobian products.
+    2. The time spent in *measurement_jacobian_product_agenda* [s].
+    3. The average time per iteration [s].
+
+With ``display_progress``, the sizes of the conjugate gradient vectors and
+of the dense Jacobian that is avoided are also printed.  These sizes are
+estimated from *measurement_vector* and *model_state_vector*, they are not
+measured memory use.
+)",
+      .author    = {"Richard Larsson"},
+      .out       = {"model_state_vector", "measurement_vector_fitted"},
+      .gout      = {"oem_diagnostics",
+                    "lm_ga_history",
+                    "oem_performance",
+                    "errors"},
+      .gout_type = {"Vector", "Vector", "Vector", "ArrayOfString"},
+      .gout_desc = {"Basic diagnostics of an OEM type inversion",
+                    "The series of gamma values for a Marquardt-levenberg inversion",
+                    "Counters and timings of the Jacobian products",
+                    "Errors encountered during OEM execution"},
+      .in        = {"model_state_vector",
+                    "measurement_vector_fitted",
+                    "model_state_vector_apriori",
+                    "model_state_covariance_matrix",
+                    "measurement_vector",
+                    "measurement_vector_error_covariance_matrix",
+                    "inversion_iterate_agenda",
+                    "measurement_jacobian_product_agenda"},
+      .gin       = {"method",
+                    "max_start_cost",
+                    "model_state_covariance_matrix_normalization",
+                    "max_iter",
+                    "stop_dx",
+                    "lm_ga_settings",
+                    "display_progress"},
+      .gin_type  = {"String", "Numeric", "Vector", "Index", "Numeric", "Vector", "Index"},
+      .gin_value = {String{"gn_cg"},
+                    Numeric{std::numeric_limits<Numeric>::infinity()},
+                    Vector{},
+                    Index{10},
+                    Numeric{0.01},
+                    Vector{},
+                    Index{0}},
+      .gin_desc =
+          {"Iteration method",
+           "Maximum allowed value of cost function at start",
+           "Normalisation of Sx",
+           "Maximum number of iterations",
+           "Stop criterion for iterative inversions",
+           "Settings associated with the ga factor of the LM method",
+           "Flag to control if inversion diagnostics shall be printed on the screen"},
+      .pass_workspace = true,
+  };
+
   wsm_data["measurement_vector_error_covariance_matrix_observation_systemCalc"] = {
       .desc =
           "Calculates the covariance matrix describing the error due to uncertainties\n"
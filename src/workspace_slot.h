@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/*! The name of a workspace variable together with a process-wide index
+
+Equal names always get the same index, so a workspace can keep the
+variables it has looked up in a plain vector indexed by the slot.  Methods
+resolve their arguments to slots once, when they are constructed, so
+executing them does not hash the argument names.
+*/
+struct WorkspaceSlot {
+  std::string name;
+  std::size_t index;
+
+  explicit WorkspaceSlot(std::string name);
+};
@@ -10,6 +10,21 @@ internal_workspace_variables() {
       .type = "ArrayOfAbsorptionBand",
   };
 
+  wsv_data["absorption_band_index"] = {
+      .desc          = R"--(Lookup of the *absorption_bands* by species and frequency range.
+
+It lets line-by-line methods skip the bands that cannot contribute to
+their *frequency_grid* without looking at every band.  It is built
+by *absorption_band_indexFromBands* and refers to the bands by their
+position, so it must be rebuilt whenever *absorption_bands* is changed.
+Using an index whose species, frequency ranges, cutoffs or Zeeman
+splitting no longer match the bands is an error.
+If it is empty, methods build a temporary index on every call instead.
+)--",
+      .type          = "AbsorptionBandIndex",
+      .default_value = AbsorptionBandIndex{},
+  };
+
   wsv_data["absorption_cia_data"] = {
       .desc = R"--(HITRAN Collision Induced Absorption (CIA) Data.
 
@@ -127,6 +142,16 @@ Used in line-by-line calculations requiring ECS data.
       .default_value = LinemixingEcsData{},
   };
 
+  wsv_data["ecs_tables"] = {
+      .desc          = R"--(Equivalent lines of the ECS bands tabulated in temperature
+
+Bands with an entry in the tables use it instead of diagonalizing their
+relaxation matrix with *ecs_data* in line-by-line calculations.
+)--",
+      .type          = "LinemixingEcsTables",
+      .default_value = LinemixingEcsTables{},
+  };
+
   wsv_data["frequency_grid"] = {
       .desc =
           R"--(The discrete frequency grid.
@@ -589,6 +614,34 @@ In classical ``F(x) = y``-notation, this is the ``y``.
       .default_value = Index{1},
   };
 
+  wsv_data["measurement_jacobian_product"] = {
+      .desc = R"(A product of *measurement_jacobian* with a vector.
+
+This is *measurement_jacobian* times *measurement_jacobian_product_vector*,
+or the transpose of *measurement_jacobian* times it if
+*measurement_jacobian_product_transpose* is true.  The size is that of
+*measurement_vector*, or *model_state_vector* for the transpose.
+)",
+      .type = "Vector",
+  };
+
+  wsv_data["measurement_jacobian_product_vector"] = {
+      .desc = R"(The vector to multiply by *measurement_jacobian*.
+
+See *measurement_jacobian_product*.
+)",
+      .type = "Vector",
+  };
+
+  wsv_data["measurement_jacobian_product_transpose"] = {
+      .desc          = R"(A boolean for if the transpose Jacobian product should be computed.
+
+See *measurement_jacobian_product*.
+)",
+      .type          = "Index",
+      .default_value = Index{0},
+  };
+
   wsv_data["measurement_vector_error_covariance_matrix"] = {
       .desc = R"(Covariance matrix for observation uncertainties.
 )",
@@ -649,6 +702,27 @@ Dimensions: *ray_path* x *suns* x *sun_path*
       .type = "ArrayOfArrayOfArrayOfPropagationPathPoint",
   };
 
+  wsv_data["propagation_matrix_profile"] = {
+      .desc = R"(Propagation matrices tabulated on an altitude grid.
+
+The altitude grid is *propagation_matrix_profile_altitude*.  This is
+used to interpolate the propagation matrix along many paths, e.g., the
+paths to the suns, without executing *propagation_matrix_agenda* for
+every point of every path.
+
+Dimensions: *propagation_matrix_profile_altitude* x *frequency_grid*
+)",
+      .type = "ArrayOfPropmatVector",
+  };
+
+  wsv_data["propagation_matrix_profile_altitude"] = {
+      .desc = R"(The altitude grid of *propagation_matrix_profile*.
+
+Unit: m
+)",
+      .type = "AscendingGrid",
+  };
+
   wsv_data["disort_settings"] = {
       .desc = R"(Contains the full settings of spectral Disort calculations.
 )",
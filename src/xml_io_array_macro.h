@@ -1,7 +1,14 @@
 #pragma once
 
+#include <arts_omp.h>
+
+#include <sstream>
+
 #include "xml_io.h"
 
+//! ASCII arrays with at least this many elements are parsed in parallel
+inline constexpr Index xml_parallel_array_min_nelem = 256;
+
 //! Both T and T{}[0] are ARTS groups exposed to the user if this is true
 template <typename T>
 concept array_of_group = WorkspaceGroup<std::remove_cvref_t<T>> and
@@ -22,17 +29,40 @@ void xml_read(std::istream &is_xml, T &at, bifstream *pbifs) try {
   tag.get_attribute_value("nelem", nelem);
   at.resize(nelem);
 
-  Index n;
-  try {
-    for (n = 0; n < nelem; n++)
-      xml_read_from_stream(is_xml, at[n], pbifs);
-  } catch (const std::runtime_error &e) {
-    std::ostringstream os;
-    os << "Error reading "
-       << WorkspaceGroupInfo<std::remove_cvref_t<T>>::name << ": "
-       << "\n Element: " << n << "\n"
-       << e.what();
-    throw std::runtime_error(os.str());
+  if (pbifs == nullptr and nelem >= xml_parallel_array_min_nelem and
+      not arts_omp_in_parallel() and arts_omp_get_max_threads() > 1) {
+    // Scan the elements first, then parse them in parallel
+    const XMLArrayScan scan = xml_scan_array_elements(is_xml, nelem);
+
+    String error;
+#pragma omp parallel for schedule(dynamic)
+    for (Index i = 0; i < nelem; i++) {
+      try {
+        std::istringstream is_elem{String{scan.element(i)}};
+        xml_read_from_stream(is_elem, at[i], nullptr);
+      } catch (const std::exception &e) {
+#pragma omp critical
+        error += std::format("\n Element: {}\n{}", i, e.what());
+      }
+    }
+
+    ARTS_USER_ERROR_IF(error.size(),
+                       "Error reading {}: {}",
+                       WorkspaceGroupInfo<std::remove_cvref_t<T>>::name,
+                       error)
+  } else {
+    Index n;
+    try {
+      for (n = 0; n < nelem; n++)
+        xml_read_from_stream(is_xml, at[n], pbifs);
+    } catch (const std::runtime_error &e) {
+      std::ostringstream os;
+      os << "Error reading "
+         << WorkspaceGroupInfo<std::remove_cvref_t<T>>::name << ": "
+         << "\n Element: " << n << "\n"
+         << e.what();
+      throw std::runtime_error(os.str());
+    }
   }
 
   tag.read_from_stream(is_xml);
@@ -75,6 +75,8 @@ TMPL_XML_READ_WRITE_STREAM(GridPos)
 TMPL_XML_READ_WRITE_STREAM(PropagationPathPoint)
 TMPL_XML_READ_WRITE_STREAM(SpeciesIsotopologueRatios)
 TMPL_XML_READ_WRITE_STREAM(LinemixingEcsData)
+TMPL_XML_READ_WRITE_STREAM(LinemixingEcsTables)
+TMPL_XML_READ_WRITE_STREAM(AbsorptionBandIndex)
 TMPL_XML_READ_WRITE_STREAM(MCAntenna)
 TMPL_XML_READ_WRITE_STREAM(PredefinedModelData)
 TMPL_XML_READ_WRITE_STREAM(QuantumIdentifier)
@@ -16,7 +16,13 @@
 #include "bofstream.h"
 #include "file.h"
 #include "double_imanip.h"
+#include <array>
+#include <bit>
+#include <cctype>
+#include <format>
+#include <functional>
 #include <iterator>
+#include <numeric>
 #include <string_view>
 
 namespace {
@@ -667,3 +673,159 @@ void parse_xml_tag_content_as_string(std::istream& is_xml, String& content) {
 
   if (!is_xml) throw std::runtime_error("Unexpected end of file.");
 }
+
+XMLArrayScan xml_scan_array_elements(std::istream& is, const Index nelem) {
+  XMLArrayScan scan;
+  scan.offsets.reserve(nelem + 1);
+
+  std::streambuf& buf = *is.rdbuf();
+  const auto next     = [&buf]() {
+    const auto c = buf.sbumpc();
+    if (c == std::char_traits<char>::eof())
+      xml_parse_error("Unexpected end of file while scanning array elements");
+    return static_cast<char>(c);
+  };
+
+  for (Index n = 0; n < nelem; n++) {
+    char c = next();
+    while (std::isspace(static_cast<unsigned char>(c))) c = next();
+    if (c != '<') {
+      xml_parse_error(
+          std::format("Expected a tag at the start of array element {}", n));
+    }
+
+    scan.offsets.push_back(scan.text.size());
+
+    // Quoted attribute values may contain anything, and so may the quoted
+    // text of a String.  Other text between tags is copied as it is.
+    Index depth      = 0;
+    bool in_tag      = false;
+    bool in_name     = false;
+    bool in_quote    = false;
+    bool quoted_text = false;
+    String name;
+    char prev = '\0';
+    for (;;) {
+      scan.text.push_back(c);
+
+      if (in_quote) {
+        in_quote = c != '"';
+      } else if (in_tag) {
+        if (in_name) {
+          in_name = not(std::isspace(static_cast<unsigned char>(c)) or
+                        c == '>' or c == '/');
+          if (in_name) name.push_back(c);
+        }
+
+        if (c == '"') {
+          in_quote = true;
+        } else if (c == '>') {
+          in_tag = false;
+          // A self-closing tag is both opened and closed
+          if (prev == '/') depth--;
+          else quoted_text = name == "String";
+          if (depth == 0) break;
+        }
+      } else if (c == '<') {
+        c = next();
+        scan.text.push_back(c);
+        in_tag       = true;
+        in_name      = c != '/';
+        quoted_text  = false;
+        depth       += in_name ? 1 : -1;
+        name.clear();
+        if (in_name) name.push_back(c);
+      } else if (quoted_text and
+                 not std::isspace(static_cast<unsigned char>(c))) {
+        in_quote    = c == '"';
+        quoted_text = false;
+      }
+
+      prev = c;
+      c    = next();
+    }
+  }
+
+  scan.offsets.push_back(scan.text.size());
+  return scan;
+}
+
+template <Index N>
+XmlMappedData<N> xml_map_from_stream(std::istream& is_xml,
+                                     const String& bfilename) {
+  static_assert(N > 0 and N < 8, "Only Vector, Matrix, and Tensor3-7");
+
+  ARTS_USER_ERROR_IF(std::endian::native != std::endian::little,
+                     "Binary XML files can only be mapped on little endian systems")
+
+  constexpr std::array<std::string_view, 7> names{
+      "Vector", "Matrix", "Tensor3", "Tensor4", "Tensor5", "Tensor6", "Tensor7"};
+  constexpr std::array<std::string_view, 7> sizes{
+      "nlibraries", "nvitrines", "nshelves", "nbooks", "npages", "nrows", "ncols"};
+
+  XMLTag tag;
+  tag.read_from_stream(is_xml);
+  tag.check_name(String{names[N - 1]});
+
+  std::array<Index, N> shape;
+  if constexpr (N == 1) {
+    tag.get_attribute_value("nelem", shape[0]);
+  } else {
+    for (Index i = 0; i < N; i++) {
+      tag.get_attribute_value(String{sizes[7 - N + i]}, shape[i]);
+    }
+  }
+
+  auto map = std::make_shared<const binmap>(bfilename.c_str());
+
+  const Index nelem = std::reduce(
+      shape.begin(), shape.end(), Index{1}, std::multiplies<>());
+  ARTS_USER_ERROR_IF(
+      nelem < 0 or map->size() < static_cast<std::size_t>(nelem) * sizeof(Numeric),
+      "The binary file holds {} bytes, but {} bytes are needed",
+      map->size(),
+      nelem * sizeof(Numeric))
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("/" + String{names[N - 1]});
+
+  auto* data = reinterpret_cast<Numeric*>(map->data());
+  return {.map = std::move(map), .data = {data, shape}};
+}
+
+template <Index N>
+XmlMappedData<N> xml_map_from_file(const String& filename) try {
+  std::ifstream ifs;
+  xml_open_input_file(ifs, filename);
+
+  FileType ftype;
+  NumericType ntype;
+  EndianType etype;
+  xml_read_header_from_stream(ifs, ftype, ntype, etype);
+
+  ARTS_USER_ERROR_IF(ftype != FileType::binary or ntype != NUMERIC_TYPE_DOUBLE,
+                     "Only binary files of double precision can be mapped")
+
+  auto out = xml_map_from_stream<N>(ifs, filename + ".bin");
+  xml_read_footer_from_stream(ifs);
+  return out;
+} catch (const std::exception& e) {
+  throw std::runtime_error(
+      std::format("Error mapping file: {}\n{}", filename, e.what()));
+}
+
+template XmlMappedData<1> xml_map_from_stream<1>(std::istream&, const String&);
+template XmlMappedData<2> xml_map_from_stream<2>(std::istream&, const String&);
+template XmlMappedData<3> xml_map_from_stream<3>(std::istream&, const String&);
+template XmlMappedData<4> xml_map_from_stream<4>(std::istream&, const String&);
+template XmlMappedData<5> xml_map_from_stream<5>(std::istream&, const String&);
+template XmlMappedData<6> xml_map_from_stream<6>(std::istream&, const String&);
+template XmlMappedData<7> xml_map_from_stream<7>(std::istream&, const String&);
+
+template XmlMappedData<1> xml_map_from_file<1>(const String&);
+template XmlMappedData<2> xml_map_from_file<2>(const String&);
+template XmlMappedData<3> xml_map_from_file<3>(const String&);
+template XmlMappedData<4> xml_map_from_file<4>(const String&);
+template XmlMappedData<5> xml_map_from_file<5>(const String&);
+template XmlMappedData<6> xml_map_from_file<6>(const String&);
+template XmlMappedData<7> xml_map_from_file<7>(const String&);
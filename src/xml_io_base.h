@@ -16,7 +16,12 @@
 #include <config.h>
 #include <enumsFileType.h>
 
+#include <binio/binmap.h>
+
+#include <bit>
 #include <memory>
+#include <string_view>
+#include <vector>
 
 #include "xml_io_general_types.h"
 
@@ -114,6 +119,54 @@ void xml_parse_from_stream(std::istream&, Vector&, bifstream*, XMLTag&);
 
 void xml_parse_from_stream(std::istream&, ArrayOfString&, bifstream*, XMLTag&);
 
+//! A Vector, Matrix, or Tensor in a binary XML file mapped into memory
+/*!
+  The data is a view of the memory map of the binary file, so nothing is
+  copied and the pages of the file are shared with every other process
+  that maps or reads the same file.  Writing to the data only copies the
+  pages that are written to.  The file itself is never changed.
+*/
+template <Index N>
+struct XmlMappedData {
+  //! The memory map of the binary file, shared by all copies of this
+  std::shared_ptr<const binmap> map{};
+
+  //! The data in the memory map
+  matpack::matpack_view<Numeric, N, false, false> data{};
+};
+
+//! Maps a Vector, Matrix, or Tensor from a binary XML file into memory
+/*!
+  The file must be a binary XML file of double precision data holding a
+  single Vector (N = 1), Matrix (N = 2), or Tensor3 to Tensor7.  Only little
+  endian systems can use the data without conversion.
+
+  \param filename XML filename
+  \return The data and its memory map
+*/
+template <Index N>
+XmlMappedData<N> xml_map_from_file(const String& filename);
+
+//! Maps the Vector, Matrix, or Tensor of a binary XML stream into memory
+/*!
+  The XML stream must be positioned after the header.  It is left
+  positioned before the footer.
+
+  \param is_xml    XML input stream
+  \param bfilename The binary file of the XML stream
+  \return The data and its memory map
+*/
+template <Index N>
+XmlMappedData<N> xml_map_from_stream(std::istream& is_xml,
+                                     const String& bfilename);
+
+//! The rank of T if binary files of T are mapped when read, otherwise 0
+template <typename T>
+inline constexpr Index xml_mapped_rank = 0;
+
+template <Index N>
+inline constexpr Index xml_mapped_rank<matpack::matpack_data<Numeric, N>> = N;
+
 ////////////////////////////////////////////////////////////////////////////
 //   Generic IO routines for XML files
 ////////////////////////////////////////////////////////////////////////////
@@ -244,8 +297,19 @@ void xml_read_from_file_base(const String& filename, T& type) {
       xml_read_from_stream(*ifs, type, static_cast<bifstream*>(nullptr));
     } else {
       String bfilename = filename + ".bin";
-      bifstream bifs(bfilename.c_str());
-      xml_read_from_stream(*ifs, type, &bifs);
+      bool mapped = false;
+      if constexpr (xml_mapped_rank<T> > 0) {
+        // Copy straight from the memory map of the binary file
+        mapped = ntype == NUMERIC_TYPE_DOUBLE and
+                 std::endian::native == std::endian::little;
+        if (mapped) {
+          type = xml_map_from_stream<xml_mapped_rank<T>>(*ifs, bfilename).data;
+        }
+      }
+      if (not mapped) {
+        bifstream bifs(bfilename.c_str());
+        xml_read_from_stream(*ifs, type, &bifs);
+      }
     }
     xml_read_footer_from_stream(*ifs);
   } catch (const std::runtime_error& e) {
@@ -255,6 +319,34 @@ void xml_read_from_file_base(const String& filename, T& type) {
   }
 }
 
+//! The text of the elements of an XML array
+struct XMLArrayScan {
+  //! The text of all the elements
+  String text{};
+
+  //! Element i is text[offsets[i], offsets[i + 1])
+  std::vector<Size> offsets{};
+
+  //! The text of element i
+  [[nodiscard]] std::string_view element(Size i) const {
+    return std::string_view{text}.substr(offsets[i],
+                                         offsets[i + 1] - offsets[i]);
+  }
+};
+
+//! Scans the elements of an array from an XML stream
+/*!
+  The stream must be positioned after the opening tag of the array.  The
+  text of nelem elements is read, tag by tag, without parsing the content,
+  so that the elements can then be parsed independently of each other.  The
+  stream is left positioned after the last element.
+
+  \param is     Input stream
+  \param nelem  The number of elements
+  \return The text of the elements
+*/
+XMLArrayScan xml_scan_array_elements(std::istream& is, const Index nelem);
+
 //! Write data to XML file
 /*!
   This is a generic functions that is used to write the XML header and
@@ -28,8 +28,10 @@
 #include "gridded_data.h"
 #include "isotopologues.h"
 #include "jacobian.h"
+#include "lbl_band_index.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
+#include "lbl_lineshape_voigt_ecs.h"
 #include "matpack_data.h"
 #include "mystring.h"
 #include "obsel.h"
@@ -2473,13 +2475,121 @@ void xml_write_to_stream(std::ostream&,
   ARTS_USER_ERROR("Method not implemented!");
 }
 
+//=== LinemixingEcsTables =========================================
+
+void xml_read_from_stream(std::istream&,
+                          LinemixingEcsTables&,
+                          bifstream* /* pbifs */) {
+  ARTS_USER_ERROR("Method not implemented!");
+}
+
+void xml_write_to_stream(std::ostream&,
+                         const LinemixingEcsTables&,
+                         bofstream* /* pbofs */,
+                         const String& /* name */) {
+  ARTS_USER_ERROR("Method not implemented!");
+}
+
+//=== AbsorptionBandIndex =========================================
+
+void xml_read_from_stream(std::istream&,
+                          AbsorptionBandIndex&,
+                          bifstream* /* pbifs */) {
+  ARTS_USER_ERROR("Method not implemented!");
+}
+
+void xml_write_to_stream(std::ostream&,
+                         const AbsorptionBandIndex&,
+                         bofstream* /* pbofs */,
+                         const String& /* name */) {
+  ARTS_USER_ERROR("Method not implemented!");
+}
+
 //=== AbsorptionBand =========================================
 
+/* Binary layout of the lines of a band
+
+  The fixed-width data is stored column by column, as a 7-by-nelem matrix of
+  f0, a, e0, gu, gl, and the Zeeman gu and gl, so that it is read in a single
+  block.  It is followed by one variable-width record per line holding the
+  Zeeman flag, the line shape model and the local quantum numbers.  Enums are
+  stored as their integer values and numbers as 64-bit integers and doubles.
+
+  The binary file is memory mapped by bifstream, but a band is still read as
+  a whole.  The records have no stored offsets, so the lines of a frequency
+  window cannot be found without reading the records of all lines before
+  them.  Select a window after reading with absorption_bandsSelectFrequency.
+*/
+namespace {
+constexpr Index band_data_ncols = 7;
+
+void write_line_record(bofstream& bof, const lbl::line& line) {
+  bof << static_cast<std::int64_t>(line.z.on);
+
+  bof << static_cast<std::int64_t>(line.ls.one_by_one) << line.ls.T0
+      << static_cast<std::int64_t>(line.ls.single_models.size());
+  for (auto& spec : line.ls.single_models) {
+    bof << static_cast<std::int64_t>(spec.species)
+        << static_cast<std::int64_t>(spec.data.size());
+    for (auto& [var, tmod] : spec.data) {
+      bof << static_cast<std::int64_t>(var)
+          << static_cast<std::int64_t>(tmod.Type())
+          << static_cast<std::int64_t>(tmod.X().size());
+      for (auto& x : tmod.X()) bof << x;
+    }
+  }
+
+  bof << static_cast<std::int64_t>(line.qn.val.size());
+  for (auto& qn : line.qn.val) {
+    bof << static_cast<std::int64_t>(qn.type);
+    qn.write(bof);
+  }
+}
+
+void read_line_record(bifstream& bif, lbl::line& line) {
+  std::int64_t i, n;
+
+  bif >> i;
+  line.z.on = static_cast<bool>(i);
+
+  bif >> i >> line.ls.T0 >> n;
+  line.ls.one_by_one = static_cast<bool>(i);
+  line.ls.single_models.resize(n);
+  for (auto& spec : line.ls.single_models) {
+    bif >> i >> n;
+    spec.species = static_cast<SpeciesEnum>(i);
+    ARTS_USER_ERROR_IF(not good_enum(spec.species), "Bad species: {}", i)
+
+    spec.data.resize(n);
+    for (auto& [var, tmod] : spec.data) {
+      std::int64_t t;
+      bif >> i >> t >> n;
+      var = static_cast<LineShapeModelVariable>(i);
+      ARTS_USER_ERROR_IF(not good_enum(var), "Bad line shape variable: {}", i)
+
+      Vector x(n);
+      bif.readDoubleArray(x.data_handle(), n);
+      tmod = lbl::temperature::data{static_cast<LineShapeModelType>(t),
+                                    std::move(x)};
+    }
+  }
+
+  bif >> n;
+  line.qn.val.reserve(n);
+  for (std::int64_t j = 0; j < n; j++) {
+    bif >> i;
+    const auto type = static_cast<QuantumNumberType>(i);
+    ARTS_USER_ERROR_IF(not good_enum(type), "Bad quantum number type: {}", i)
+    line.qn.val.emplace_back(type).read(bif);
+  }
+  ARTS_USER_ERROR_IF(
+      not line.qn.val.good(), "Bad quantum numbers in {}", line.qn)
+}
+}  // namespace
+
 void xml_read_from_stream(std::istream& is_xml,
                           lbl::band_data& data,
                           bifstream* pbifs) try {
-  ARTS_USER_ERROR_IF(pbifs not_eq nullptr, "No binary data")
-
   String tag;
   Index nelem;
 
@@ -2499,8 +2609,28 @@ void xml_read_from_stream(std::istream& is_xml,
   data.lines.resize(0);
   data.lines.reserve(nelem);
 
-  for (Index j = 0; j < nelem; j++) {
-    is_xml >> data.lines.emplace_back();
+  if (pbifs) {
+    Matrix cols(band_data_ncols, nelem);
+    pbifs->readDoubleArray(cols.data_handle(), cols.size());
+
+    data.lines.resize(nelem);
+    for (Index j = 0; j < nelem; j++) {
+      auto& line      = data.lines[j];
+      line.f0         = cols(0, j);
+      line.a          = cols(1, j);
+      line.e0         = cols(2, j);
+      line.gu         = cols(3, j);
+      line.gl         = cols(4, j);
+      line.z.mdata.gu = cols(5, j);
+      line.z.mdata.gl = cols(6, j);
+      read_line_record(*pbifs, line);
+    }
+
+    ARTS_USER_ERROR_IF(pbifs->fail(), "Unexpected end of binary data")
+  } else {
+    for (Index j = 0; j < nelem; j++) {
+      is_xml >> data.lines.emplace_back();
+    }
   }
 
   ArtsXMLTag close_tag;
@@ -2513,8 +2643,6 @@ void xml_write_to_stream(std::ostream& os_xml,
                          const lbl::band_data& data,
                          bofstream* pbofs,
                          const String& name) {
-  ARTS_USER_ERROR_IF(pbofs not_eq nullptr, "No binary data")
-
   ArtsXMLTag open_tag;
   open_tag.set_name("AbsorptionBandData");
   if (name.length()) open_tag.add_attribute("name", name);
@@ -2525,8 +2653,27 @@ void xml_write_to_stream(std::ostream& os_xml,
   open_tag.write_to_stream(os_xml);
   os_xml << '\n';
 
-  for (auto& line : data) {
-    os_xml << line << '\n';
+  if (pbofs) {
+    const auto nelem = static_cast<Index>(data.lines.size());
+    Matrix cols(band_data_ncols, nelem);
+    for (Index j = 0; j < nelem; j++) {
+      auto& line = data.lines[j];
+      cols(0, j) = line.f0;
+      cols(1, j) = line.a;
+      cols(2, j) = line.e0;
+      cols(3, j) = line.gu;
+      cols(4, j) = line.gl;
+      cols(5, j) = line.z.mdata.gu;
+      cols(6, j) = line.z.mdata.gl;
+    }
+    pbofs->putRaw(reinterpret_cast<const char*>(cols.data_handle()),
+                  cols.size() * sizeof(Numeric));
+
+    for (auto& line : data) write_line_record(*pbofs, line);
+  } else {
+    for (auto& line : data) {
+      os_xml << line << '\n';
+    }
   }
 
   ArtsXMLTag close_tag;
@@ -0,0 +1,76 @@
+import os
+import subprocess
+import sys
+import tempfile
+
+import pyarts
+
+
+def threaded_read(species, basename, threads):
+    """Read the split catalog in a new process with a fixed number of
+    threads and return what was read as text"""
+    code = f"""
+import pyarts
+ws = pyarts.Workspace()
+ws.absorption_speciesSet(species={species!r})
+ws.absorption_bandsReadSpeciesSplitCatalog(basename={basename!r})
+print(ws.absorption_bands)
+"""
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    out = subprocess.run(
+        [sys.executable, "-c", code], env=env, capture_output=True, check=True
+    )
+    return out.stdout.decode()
+
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmax=120e9)
+
+ascii_bands = str(ws.absorption_bands)
+
+with tempfile.TemporaryDirectory() as tmp:
+    ws.absorption_bandsSaveSplit(dir=tmp, output_file_format="binary")
+    assert os.path.exists(os.path.join(tmp, "O2-66.xml.bin"))
+
+    ws.absorption_bandsReadSplit(dir=tmp)
+
+assert str(ws.absorption_bands) == ascii_bands, "Binary catalog mismatch"
+
+# Several species read in parallel give the same result as a serial read
+species = ["O2-66", "O2-68", "H2O-161"]
+ws.absorption_speciesSet(species=species)
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmax=1e12)
+nbands = len(ws.absorption_bands)
+
+with tempfile.TemporaryDirectory() as tmp:
+    ws.absorption_bandsSaveSplit(dir=tmp, output_file_format="binary")
+
+    serial = threaded_read(species, tmp, 1)
+    threaded = threaded_read(species, tmp, 4)
+    assert threaded == serial, "Threaded split catalog read mismatch"
+
+    ws.absorption_bandsReadSpeciesSplitCatalog(basename=tmp)
+    assert len(ws.absorption_bands) == nbands, "Bands lost in split catalog"
+
+    # A missing file is an error
+    os.remove(os.path.join(tmp, "O2-68.xml"))
+    try:
+        ws.absorption_bandsReadSpeciesSplitCatalog(basename=tmp)
+    except Exception as e:
+        assert "O2-68.xml" in str(e), str(e)
+    else:
+        assert False, "Expected an error for a missing file"
+
+    # So is a broken file, even though it is read by another thread
+    with open(os.path.join(tmp, "O2-68.xml"), "w") as f:
+        f.write("<Array>\n")
+    try:
+        ws.absorption_bandsReadSpeciesSplitCatalog(basename=tmp)
+    except Exception:
+        pass
+    else:
+        assert False, "Expected an error for a broken file"
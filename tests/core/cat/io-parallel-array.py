@@ -0,0 +1,115 @@
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+import numpy as np
+import pyarts
+
+
+def timed_read(group, file, threads):
+    """Time reading the file in a new process with a fixed number of threads"""
+    code = f"""
+import time
+import pyarts
+t0 = time.perf_counter()
+pyarts.arts.{group}.fromxml({file!r})
+print(time.perf_counter() - t0)
+"""
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    out = subprocess.run(
+        [sys.executable, "-c", code], env=env, capture_output=True, check=True
+    )
+    return float(out.stdout)
+
+
+def threaded_copy(group, file, copy, threads):
+    """Read the file in a new process with a fixed number of threads and
+    write what was read to copy"""
+    code = f"""
+import pyarts
+pyarts.arts.{group}.fromxml({file!r}).savexml({copy!r}, "ascii")
+"""
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    subprocess.run([sys.executable, "-c", code], env=env, check=True)
+    with open(copy) as f:
+        return f.read()
+
+
+# Just above the parallel threshold, with quotes, tag characters and
+# self-closing tag endings in the text and nested arrays as elements.
+# Strings are written as they are, so they may even contain tags
+nelem = 260
+small = {
+    "ArrayOfString": pyarts.arts.ArrayOfString(
+        [f"{i} < {i + 1} </String> <String>" for i in range(nelem)]
+    ),
+    "ArrayOfArrayOfString": pyarts.arts.ArrayOfArrayOfString(
+        [[f"it's {i} > {j} /> <{j}" for j in range(i % 4)] for i in range(nelem)]
+    ),
+    "ArrayOfArrayOfGriddedField3": pyarts.arts.ArrayOfArrayOfGriddedField3(
+        [
+            [
+                pyarts.arts.GriddedField3(
+                    name=f"field '{i}' </{j}/",
+                    data=np.full((2, 1, 1), float(i + j)),
+                    grid_names=["Altitude", "Latitude", "Longitude"],
+                    grids=[[0, 1e3], [0], [0]],
+                )
+                for j in range(2)
+            ]
+            for i in range(nelem)
+        ]
+    ),
+}
+
+with tempfile.TemporaryDirectory() as tmp:
+    for group, data in small.items():
+        file = os.path.join(tmp, group + ".xml")
+        data.savexml(file, "ascii")
+
+        serial = threaded_copy(group, file, file + ".serial", 1)
+        parallel = threaded_copy(group, file, file + ".parallel", os.cpu_count())
+        assert serial == parallel, f"Parallel and serial {group} differ"
+
+        with open(file) as f:
+            assert f.read() == serial, f"Mismatch reading {group}"
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+bands = ws.absorption_bands
+
+fields = pyarts.arts.ArrayOfGriddedField3(
+    [
+        pyarts.arts.GriddedField3(
+            name=f"field {i}",
+            data=np.full((4, 3, 2), float(i)),
+            grid_names=["Altitude", "Latitude", "Longitude"],
+            grids=[[0, 1e3, 2e3, 3e3], [-10, 0, 10], [0, 90]],
+        )
+        for i in range(5000)
+    ]
+)
+
+with tempfile.TemporaryDirectory() as tmp:
+    for group, data in [
+        ("ArrayOfAbsorptionBand", bands),
+        ("ArrayOfGriddedField3", fields),
+    ]:
+        for type in ["ascii", "zascii"]:
+            ext = ".xml.gz" if type == "zascii" else ".xml"
+            file = os.path.join(tmp, group + ext)
+            data.savexml(file, type)
+
+            copy = getattr(pyarts.arts, group).fromxml(file)
+            assert str(copy) == str(data), f"Mismatch reading {type} {group}"
+
+            serial = timed_read(group, file, 1)
+            parallel = timed_read(group, file, os.cpu_count())
+            print(
+                f"{group} ({type}, {len(data)} elements): "
+                f"{serial:.3f} s serial, {parallel:.3f} s parallel"
+            )
@@ -0,0 +1,78 @@
+import pyarts
+import numpy as np
+
+# A linear forward model y = K x, so that all methods have the same solution
+rng = np.random.default_rng(42)
+m, n = 40, 6
+K = rng.normal(size=(m, n))
+x_true = rng.normal(size=n)
+
+
+def covariance_matrix(S):
+    covmat = pyarts.arts.CovarianceMatrix()
+    r = pyarts.arts.Range(0, S.shape[0])
+    covmat.blocks = [pyarts.arts.Block(r, r, (0, 0), pyarts.arts.Matrix(S))]
+    return covmat
+
+
+def forward(model_state_vector):
+    measurement_vector_fitted = K @ np.array(model_state_vector)
+    measurement_jacobian = K
+    return measurement_vector_fitted, measurement_jacobian
+
+
+def products(
+    model_state_vector,
+    measurement_jacobian_product_vector,
+    measurement_jacobian_product_transpose,
+):
+    v = np.array(measurement_jacobian_product_vector)
+    if measurement_jacobian_product_transpose:
+        measurement_jacobian_product = K.T @ v
+    else:
+        measurement_jacobian_product = K @ v
+    return measurement_jacobian_product
+
+
+ws = pyarts.Workspace()
+
+# Markov correlated a priori, to not only test a diagonal Sa
+i = np.arange(n)
+ws.model_state_covariance_matrix = covariance_matrix(
+    0.5 ** np.abs(i[:, None] - i[None, :])
+)
+ws.model_state_vector_apriori = np.zeros(n)
+ws.measurement_vector_error_covariance_matrix = covariance_matrix(
+    np.diag(np.full(m, 0.01))
+)
+ws.measurement_vector = K @ x_true + rng.normal(0, 0.1, m)
+
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def inversion_iterate_agenda(ws):
+    forward()
+
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def measurement_jacobian_product_agenda(ws):
+    products()
+
+
+lm_ga_settings = [10.0, 2.0, 2.0, 100.0, 1.0, 99.0]
+for method, cg_method in [("li", "li_cg"), ("gn", "gn_cg"), ("lm", "lm_cg")]:
+    ws.model_state_vector = []
+    ws.measurement_vector_fitted = []
+    ws.measurement_jacobian = [[]]
+    ws.OEM(method=method, stop_dx=1e-6, max_iter=50, lm_ga_settings=lm_ga_settings)
+    ref = np.array(ws.model_state_vector)
+
+    ws.model_state_vector = []
+    ws.measurement_vector_fitted = []
+    ws.OEMMatrixFree(
+        method=cg_method, stop_dx=1e-6, max_iter=50, lm_ga_settings=lm_ga_settings
+    )
+    x = np.array(ws.model_state_vector)
+
+    assert ws.oem_diagnostics[0] == 0, f"{cg_method} did not converge"
+    assert ws.oem_performance[0] > 0 and ws.oem_performance[1] > 0
+    assert np.allclose(x, ref, rtol=1e-4, atol=1e-6), f"{cg_method}:\n{x}\n{ref}"
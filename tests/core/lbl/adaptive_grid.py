@@ -0,0 +1,58 @@
+import pyarts
+import numpy as np
+
+
+def exact(f):
+    """Evaluate the spectrum directly on f, without refinement"""
+    _, pm, _ = pyarts.arts.lbl.adaptive_calculate(
+        pyarts.arts.AscendingGrid(f),
+        ws.absorption_bands,
+        ws.ecs_data,
+        ws.atmospheric_point,
+        max_points=0,
+        add_line_centers=False,
+    )
+    return np.array(pm)[:, 0]
+
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=55e9, fmax=65e9)
+
+ws.ecs_dataInit()
+
+# Mesospheric conditions, where the lines are narrow and Doppler-limited
+ws.atmospheric_pointInit()
+ws.atmospheric_point.temperature = 220
+ws.atmospheric_point.pressure = 1.0
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("Oxygen")] = 0.21
+
+rtol = 1e-3
+coarse = np.linspace(55e9, 65e9, 101)
+f, pm, sv = pyarts.arts.lbl.adaptive_calculate(
+    pyarts.arts.AscendingGrid(coarse),
+    ws.absorption_bands,
+    ws.ecs_data,
+    ws.atmospheric_point,
+    rtol=rtol,
+    min_df=100.0,
+)
+f = np.array(f)
+A = np.array(pm)[:, 0]
+
+assert np.all(np.diff(f) >= 0), "The refined grid must be ascending"
+assert len(f) == len(A) == len(np.array(sv)), "Bad spectrum size"
+assert np.all(np.isin(coarse, f)), "The coarse grid must be kept"
+
+# The lines are resolved with far fewer points than a uniform grid at the finest spacing
+assert len(f) < 1e-2 * (coarse[-1] - coarse[0]) / np.diff(f).min()
+
+# The spectrum is the same as when evaluated directly on the refined grid
+assert np.allclose(A, exact(f), rtol=1e-12)
+
+# Linear interpolation on the refined grid is close to the exact spectrum in between
+fm = 0.5 * (f[1:] + f[:-1])
+err = np.abs(np.interp(fm, f, A) - exact(fm))
+assert err.max() < 4 * rtol * A.max(), f"Refinement too coarse: {err.max() / A.max()}"
@@ -0,0 +1,68 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmax=1200e9)
+for band in ws.absorption_bands:
+    band.data.cutoff = pyarts.arts.LineByLineCutoffType("ByLine")
+    band.data.cutoff_value = 50e9
+
+ws.frequency_grid = np.linspace(50e9, 70e9, 1001)
+ws.jacobian_targets = pyarts.arts.JacobianTargets()
+ws.atmospheric_pointInit()
+ws.atmospheric_point.temperature = 250
+ws.atmospheric_point.pressure = 1e3
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("O2")] = 0.21
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("H2O")] = 1e-3
+ws.atmospheric_point.mag = [40e-6, 20e-6, 10e-6]
+ws.absorption_bandsSetZeeman(species="O2-66", fmin=55e9, fmax=65e9)
+
+ws.ecs_dataInit()
+
+for spec in ["AIR", "O2", "H2O"]:
+    ws.propagation_matrix_select_species = pyarts.arts.SpeciesEnum(spec)
+
+    # An empty index means a temporary index is built for every call
+    ws.absorption_band_index = pyarts.arts.AbsorptionBandIndex()
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines()
+    ref = np.array(ws.propagation_matrix)
+
+    ws.absorption_band_indexFromBands()
+    assert ws.absorption_band_index.size == len(ws.absorption_bands)
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines()
+    assert np.all(np.array(ws.propagation_matrix) == ref), spec
+
+
+def expect_outdated(why):
+    try:
+        ws.propagation_matrixInit()
+        ws.propagation_matrixAddLines()
+    except Exception:
+        pass
+    else:
+        assert False, f"Expected an error for an outdated index after {why}"
+
+
+# An index that does not match the bands is an error, even if the number of
+# bands is unchanged
+ws.propagation_matrix_select_species = pyarts.arts.SpeciesEnum("AIR")
+ws.absorption_band_indexFromBands()
+ws.absorption_bandsSetZeeman(species="O2-66", fmin=0, fmax=1e99)
+expect_outdated("absorption_bandsSetZeeman")
+
+ws.absorption_band_indexFromBands()
+ws.propagation_matrixInit()
+ws.propagation_matrixAddLines()
+
+for band in ws.absorption_bands:
+    band.data.cutoff_value = 10e9
+expect_outdated("changing the cutoff")
+
+ws.absorption_band_indexFromBands()
+ws.absorption_bandsSelectFrequency(fmax=100e9)
+expect_outdated("absorption_bandsSelectFrequency")
@@ -0,0 +1,100 @@
+import pyarts
+import numpy as np
+
+
+def sorted_lines(eqv_str, eqv_val):
+    idx = np.argsort(eqv_val.real, axis=-1)
+    return (
+        np.take_along_axis(eqv_str, idx, axis=-1),
+        np.take_along_axis(eqv_val, idx, axis=-1),
+    )
+
+
+def exact(band, T):
+    ws.atmospheric_point.temperature = T
+    eqv_str, eqv_val = pyarts.arts.lbl.equivalent_lines(
+        band, ws.ecs_data, ws.atmospheric_point, [T]
+    )
+    return sorted_lines(np.array(eqv_str)[0], np.array(eqv_val)[0])
+
+
+def tabulated(band, table, T):
+    ws.atmospheric_point.temperature = T
+    eqv_str, eqv_val = pyarts.arts.lbl.tabulated_equivalent_lines(
+        band, table, ws.atmospheric_point
+    )
+    return sorted_lines(np.array(eqv_str), np.array(eqv_val))
+
+
+ws = pyarts.Workspace()
+ws.absorption_speciesSet(species=["CO2-626"])
+ws.ReadCatalogData()
+
+ws.atmospheric_pointInit()
+ws.atmospheric_point.temperature = 295
+ws.atmospheric_point.pressure = 1e5
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("CO2")] = 400e-6
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("O2")] = 0.21
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("N2")] = 0.79
+
+ws.WignerInit()
+
+ws.ecs_dataInit()
+ws.ecs_dataAddTran2011()
+ws.ecs_dataAddRodrigues1997()
+ws.ecs_dataAddMeanAir(vmrs=[0.21, 0.79], species=["O2", "N2"])
+
+# A small band to keep the diagonalization cheap
+for i in range(len(ws.absorption_bands)):
+    if len(ws.absorption_bands[i].data.lines) < 60:
+        band = pyarts.arts.AbsorptionBand(ws.absorption_bands[i])
+        break
+
+band.data.lineshape = "VP_ECS_HARTMANN"
+for line in band.data.lines:
+    line.ls.one_by_one = True
+
+T = np.linspace(200, 320, 25)
+table = pyarts.arts.lbl.tabulate_equivalent_lines(
+    band, ws.ecs_data, ws.atmospheric_point, T
+)
+
+# On the temperature grid at the table pressure the tabulation is exact
+for t in T[::6]:
+    s, v = tabulated(band, table, t)
+    s_ref, v_ref = exact(band, t)
+    assert np.allclose(v, v_ref, rtol=1e-12), f"Bad equivalent values at {t} K"
+    assert np.allclose(s, s_ref, rtol=1e-8), f"Bad equivalent strengths at {t} K"
+
+# Between the grid points the interpolation is close to the exact solution
+for t in 0.5 * (T[1:] + T[:-1])[::6]:
+    s, v = tabulated(band, table, t)
+    s_ref, v_ref = exact(band, t)
+    assert np.allclose(v, v_ref, rtol=1e-9), f"Bad equivalent values at {t} K"
+    assert np.allclose(s, s_ref, rtol=1e-2), f"Bad equivalent strengths at {t} K"
+
+# Off the table pressure the offsets are scaled by their perturbation order,
+# compare the full line-by-line calculations with and without the tables
+ws.absorption_bands = [band]
+ws.jacobian_targets = pyarts.arts.JacobianTargets()
+f0 = np.array([line.f0 for line in band.data.lines])
+ws.frequency_grid = np.linspace(f0.min() - 5e9, f0.max() + 5e9, 1001)
+
+ws.atmospheric_point.temperature = 295  # On the grid, to only test the pressure
+ws.atmospheric_point.pressure = 1e5
+ws.ecs_tablesTabulate(temperatures=T)
+assert band.key in ws.ecs_tables
+
+for p, rtol in [(1e5, 1e-6), (5e4, 1e-3), (1e4, 1e-3), (2e5, 1e-2)]:
+    ws.atmospheric_point.pressure = p
+
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines(ecs_tables=pyarts.arts.LinemixingEcsTables())
+    ref = np.array(ws.propagation_matrix)[:, 0]
+
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines()
+    tab = np.array(ws.propagation_matrix)[:, 0]
+
+    err = np.abs(tab - ref).max() / np.abs(ref).max()
+    assert err < rtol, f"Tabulated ECS error {err} too large at {p} Pa"
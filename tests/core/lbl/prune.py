@@ -0,0 +1,53 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmax=1200e9)
+
+ws.frequency_grid = np.linspace(55e9, 65e9, 1001)
+ws.jacobian_targets = pyarts.arts.JacobianTargets()
+ws.atmospheric_pointInit()
+ws.atmospheric_point.temperature = 220
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("O2")] = 0.21
+
+ws.ecs_dataInit()
+
+rel_err = 1e-3
+for p in [1e5, 1e2, 1.0]:
+    ws.atmospheric_point.pressure = p
+
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines()
+    ref = np.array(ws.propagation_matrix)[:, 0]
+    nlines = int(np.array(ws.evaluated_lines))
+
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines(line_pruning=rel_err)
+    pruned = np.array(ws.propagation_matrix)[:, 0]
+    nkept = int(np.array(ws.evaluated_lines))
+
+    selection, report = pyarts.arts.lbl.prune(
+        ws.absorption_bands,
+        ws.atmospheric_point,
+        ws.frequency_grid[0],
+        ws.frequency_grid[-1],
+        rel_err,
+    )
+    assert nlines == report.nlines
+    assert nkept == report.nkept
+    assert report.nlines == sum(len(b.data.lines) for b in ws.absorption_bands)
+    assert report.nkept == sum(len(s.lines) for s in selection)
+    assert report.nwindowed <= report.nkept <= report.nlines
+    assert report.error <= rel_err
+
+    # The budget is approximate, as the line estimates are not strict
+    # bounds, so the error is only required to be close to it
+    err = np.abs(pruned - ref).max() / ref.max()
+    assert err < 2 * rel_err, f"Pruning error {err} too large at {p} Pa"
+
+    # Few lines matter where the lines are narrow
+    if p == 1.0:
+        assert report.nkept < report.nlines // 2, f"Too few lines pruned: {report.nkept}"
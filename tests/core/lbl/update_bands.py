@@ -0,0 +1,65 @@
+import pyarts
+import numpy as np
+
+line_f0 = 118750348044.712
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=40e9, fmax=120e9, by_line=1)
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.frequency_grid = np.linspace(-100e6, 100e6, 201) + line_f0
+alt = pyarts.arts.AscendingGrid(np.linspace(0, 100e3, 21))
+zenith = pyarts.arts.AscendingGrid([0.0, 120.0])
+azimuth = pyarts.arts.AscendingGrid([0.0])
+
+# Retrieve the line center and strength of the line closest to line_f0
+_, iband, iline = min(
+    (abs(line.f0 - line_f0), i, j)
+    for i, band in enumerate(ws.absorption_bands)
+    for j, line in enumerate(band.data.lines)
+)
+key = ws.absorption_bands[iband].key
+
+ws.jacobian_targetsInit()
+ws.jacobian_targetsAddLineParameter(id=key, line_index=iline, parameter="f0")
+ws.jacobian_targetsAddLineParameter(id=key, line_index=iline, parameter="a")
+ws.jacobian_targetsFinalize()
+ws.model_state_vectorFromData()
+
+
+def field():
+    ws.spectral_radiance_fieldFromOperatorPlanarGeometric(
+        zenith_grid=zenith, azimuth_grid=azimuth
+    )
+    return np.array(ws.spectral_radiance_field.data)
+
+
+ws.spectral_radiance_operatorClearsky1D(altitude_grid=alt)
+before = field()
+
+f0_target, a_target = ws.jacobian_targets.line
+x = np.array(ws.model_state_vector)
+x[f0_target.x_start] += 2e6
+x[a_target.x_start] *= 1.5
+ws.model_state_vector = x
+
+# Update only the changed band of the operator
+ws.spectral_radiance_operatorFromModelState()
+incremental = field()
+assert not np.array_equal(incremental, before), "The bands were not updated"
+
+# Setting the same state again changes nothing
+ws.spectral_radiance_operatorFromModelState()
+assert np.array_equal(field(), incremental)
+
+# A new operator of the updated bands must give the same result
+ws.spectral_radiance_operatorClearsky1D(altitude_grid=alt)
+assert np.array_equal(field(), incremental), "update_bands differs from a rebuild"
@@ -0,0 +1,71 @@
+import pyarts
+import numpy as np
+
+ANGLE_CUT = 1e-3
+
+ws = pyarts.Workspace()
+
+ws.frequency_grid = [pyarts.arts.convert.wavelen2freq(700e-9)]
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.sunBlackbody()
+ws.suns = [ws.sun]
+
+# Count the executions of ray_path_observer_agenda
+executions = [0]
+
+
+def count_execution():
+    executions[0] += 1
+
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def ray_path_observer_agenda(ws):
+    count_execution()
+    ws.ray_pathGeometric(
+        pos=ws.spectral_radiance_observer_position,
+        los=ws.spectral_radiance_observer_line_of_sight,
+        as_observer=1,
+    )
+
+
+# A path with more points than one warm-started block
+ws.ray_pathGeometric(pos=[0, 10, 20], los=[30, 45], max_step=1000.0)
+assert len(ws.ray_path) > 32
+
+
+def sun_paths():
+    executions[0] = 0
+    ws.ray_path_suns_pathFromPathObserver(angle_cut=ANGLE_CUT, refinement=4)
+    los = np.array([np.array(x[0][0].los) for x in ws.ray_path_suns_path])
+    return los, executions[0]
+
+
+# The warm starts do not depend on the number of threads
+los, n = sun_paths()
+if hasattr(pyarts.arts.globals, "omp_set_num_threads"):
+    nthreads = pyarts.arts.globals.omp_get_max_threads()
+    for threads in {1, 3, nthreads}:
+        pyarts.arts.globals.omp_set_num_threads(threads)
+        los_threads, n_threads = sun_paths()
+        assert np.array_equal(los, los_threads), f"{threads} threads"
+        assert n == n_threads, f"{threads} threads: {n_threads} vs {n} executions"
+    pyarts.arts.globals.omp_set_num_threads(nthreads)
+
+# The same sun is found by cold starts at every point
+executions[0] = 0
+cold_los = []
+for point in ws.ray_path:
+    ws.sun_pathFromObserverAgenda(pos=point.pos, angle_cut=ANGLE_CUT, refinement=4)
+    cold_los.append(np.array(ws.sun_path[0].los))
+n_cold = executions[0]
+
+assert np.allclose(los, cold_los, atol=1e-2), f"{los}\n{cold_los}"
+print(
+    f"ray_path_observer_agenda executions for {len(ws.ray_path)} points: "
+    f"{n} with warm starts, {n_cold} with cold starts"
+)
@@ -0,0 +1,49 @@
+import pyarts
+import numpy as np
+
+# Allowed relative error of the interpolated sun path transmission
+RTOL = 1e-2
+
+ws = pyarts.Workspace()
+
+ws.frequency_grid = [40e9, 50e9, 54e9, 110e9]
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=40e9, fmax=120e9, by_line=1)
+ws.propagation_matrix_agendaAuto()
+ws.propagation_matrix_scattering_agendaSet(option="AirSimple")
+ws.jacobian_targets = pyarts.arts.JacobianTargets()
+
+# The AFGL atmosphere is 1-D, so the profile holds for all sun paths
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.sunBlackbody(latitude=10.0, longitude=20.0)
+ws.suns = [ws.sun]
+ws.ray_path_observer_agendaSet(option="Geometric")
+
+ws.ray_pathGeometric(pos=[0, 0, 0], los=[40, 30], max_step=2000.0)
+ws.ray_path_suns_pathFromPathObserver(just_hit=1)
+ws.ray_path_atmospheric_pointFromPath()
+ws.ray_path_frequency_gridFromPath()
+ws.ray_path_propagation_matrix_scatteringFromPath()
+
+# Executes propagation_matrix_agenda at every point of every sun path
+ws.ray_path_spectral_radiance_scatteringSunsFirstOrderRayleigh()
+exact = np.array(ws.ray_path_spectral_radiance_scattering)
+
+ws.propagation_matrix_profileFromAltitudeGrid(
+    altitude_grid=np.linspace(0, 100e3, 201)
+)
+ws.ray_path_spectral_radiance_scatteringSunsFirstOrderRayleighFromProfile()
+interpolated = np.array(ws.ray_path_spectral_radiance_scattering)
+
+assert exact.shape == interpolated.shape
+assert np.any(exact != 0), "No sun was scattered into the path"
+
+error = np.max(np.abs(interpolated - exact)) / np.max(np.abs(exact))
+print(f"Relative error of the interpolated profile: {error:.3e}")
+assert error < RTOL, f"Relative error {error} exceeds {RTOL}"